@@ -0,0 +1,48 @@
+#pragma once
+
+// std Includes.
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Framework::Benchmark
+{
+	struct Result
+	{
+		std::string label;
+		double milliseconds;
+		std::string detail;
+	};
+
+	using ResultList = std::vector< Result >;
+
+	/* Runs the given function repeat_count times & returns the fastest run, in milliseconds. */
+	template< typename Function >
+	double Measure( Function&& function, const int repeat_count = 3 )
+	{
+		double fastest = std::numeric_limits< double >::max();
+
+		for( int i = 0; i < repeat_count; i++ )
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			function();
+			const auto end   = std::chrono::high_resolution_clock::now();
+
+			fastest = std::min( fastest, std::chrono::duration< double, std::milli >( end - start ).count() );
+		}
+
+		return fastest;
+	}
+
+	/* Keeps the optimizer from discarding results that are otherwise unused. */
+	template< typename Type >
+	void DoNotOptimizeAway( const Type& value )
+	{
+		static volatile char sink;
+		const char* bytes = reinterpret_cast< const char* >( &value );
+		for( std::size_t i = 0; i < sizeof( Type ); i++ )
+			sink = bytes[ i ];
+	}
+}
@@ -0,0 +1,425 @@
+// Framework Includes.
+#include "Benchmark/Benchmark_Math.h"
+
+#include "Math/BoundingVolumeHierarchy.h"
+#include "Math/Bounds.h"
+#include "Math/Frustum.h"
+#include "Math/Matrix.h"
+#include "Math/Matrix.hpp"
+#include "Math/SIMD.h"
+#include "Math/TransformBatch.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+namespace Framework::Benchmark
+{
+	ResultList Matrix4x4Multiplication()
+	{
+		constexpr std::size_t count = 1'000'000;
+
+		std::mt19937 generator( 42 );
+		std::uniform_real_distribution< float > distribution( -10.0f, 10.0f );
+
+		std::vector< Matrix4x4 > lhs( count, Matrix4x4( NO_INITIALIZATION ) ), rhs( count, Matrix4x4( NO_INITIALIZATION ) ), products( count, Matrix4x4( NO_INITIALIZATION ) );
+		std::vector< Vector4 > vectors( count ), transformed_vectors( count );
+
+		for( std::size_t i = 0; i < count; i++ )
+		{
+			for( auto row = 0; row < 4; row++ )
+				for( auto column = 0; column < 4; column++ )
+				{
+					lhs[ i ][ row ][ column ] = distribution( generator );
+					rhs[ i ][ row ][ column ] = distribution( generator );
+				}
+
+			vectors[ i ].Set( distribution( generator ), distribution( generator ), distribution( generator ), distribution( generator ) );
+		}
+
+		ResultList results;
+
+		results.push_back( { "Matrix4x4 * Matrix4x4 (generic)", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+				products[ i ] = lhs[ i ].MultiplyGeneric( rhs[ i ] );
+		} ), "1M multiplications" } );
+		DoNotOptimizeAway( products.back() );
+
+		results.push_back( { std::string( "Matrix4x4 * Matrix4x4 (" ) + Math::SIMD::InstructionSetName() + ")", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+				products[ i ] = lhs[ i ] * rhs[ i ];
+		} ), "1M multiplications" } );
+		DoNotOptimizeAway( products.back() );
+
+		results.push_back( { "Vector4 * Matrix4x4 (generic)", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+			{
+				Vector4 vector_transformed;
+				for( auto j = 0; j < 4; j++ )
+					for( auto k = 0; k < 4; k++ )
+						vector_transformed[ j ] += vectors[ i ][ k ] * lhs[ i ][ k ][ j ];
+
+				transformed_vectors[ i ] = vector_transformed;
+			}
+		} ), "1M transformations" } );
+		DoNotOptimizeAway( transformed_vectors.back() );
+
+		results.push_back( { std::string( "Vector4 * Matrix4x4 (" ) + Math::SIMD::InstructionSetName() + ")", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+				transformed_vectors[ i ] = vectors[ i ] * lhs[ i ];
+		} ), "1M transformations" } );
+		DoNotOptimizeAway( transformed_vectors.back() );
+
+		/* Verify that the SIMD path stays within epsilon of the reference implementation. */
+		bool results_match = true;
+		for( std::size_t i = 0; i < count; i += 997 )
+			results_match &= ( lhs[ i ] * rhs[ i ] ) == lhs[ i ].MultiplyGeneric( rhs[ i ] );
+
+		results.push_back( { "SIMD vs. generic results", 0.0, results_match ? "Match (within epsilon)" : "MISMATCH!" } );
+
+		return results;
+	}
+
+	ResultList BatchTransform()
+	{
+		constexpr std::size_t count = 4'000'000;
+
+		std::mt19937 generator( 42 );
+		std::uniform_real_distribution< float > distribution( -10.0f, 10.0f );
+
+		Matrix4x4 transform;
+		for( auto row = 0; row < 3; row++ )
+			for( auto column = 0; column < 3; column++ )
+				transform[ row ][ column ] = distribution( generator );
+		transform[ 3 ][ 0 ] = distribution( generator ); transform[ 3 ][ 1 ] = distribution( generator ); transform[ 3 ][ 2 ] = distribution( generator );
+		transform[ 3 ][ 3 ] = 1.0f;
+
+		std::vector< Vector3 > points( count ), points_transformed( count ), points_transformed_reference( count );
+		std::vector< Vector4 > points_homogeneous( count ), points_homogeneous_transformed( count );
+		std::vector< float > x( count ), y( count ), z( count ), x_transformed( count ), y_transformed( count ), z_transformed( count );
+
+		for( std::size_t i = 0; i < count; i++ )
+		{
+			points[ i ].Set( distribution( generator ), distribution( generator ), distribution( generator ) );
+			points_homogeneous[ i ] = Vector4( points[ i ].X(), points[ i ].Y(), points[ i ].Z(), 1.0f );
+			x[ i ] = points[ i ].X();
+			y[ i ] = points[ i ].Y();
+			z[ i ] = points[ i ].Z();
+		}
+
+		const std::string thread_detail = std::to_string( Utility::ThreadPool::Default().ThreadCount() + 1 ) + " threads";
+
+		ResultList results;
+
+		results.push_back( { "Vector4 * Matrix4x4 loop", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+			{
+				const Vector4 transformed = Vector4( points[ i ].X(), points[ i ].Y(), points[ i ].Z(), 1.0f ) * transform;
+				points_transformed_reference[ i ] = Vector3( transformed.X(), transformed.Y(), transformed.Z() );
+			}
+		} ), "4M points, 1 thread" } );
+		DoNotOptimizeAway( points_transformed_reference.back() );
+
+		results.push_back( { "TransformPoints (AoS Vector3)", Measure( [ & ]()
+		{
+			Math::TransformPoints( points, points_transformed, transform, Math::Threading::SingleThreaded );
+		} ), "4M points, 1 thread" } );
+		DoNotOptimizeAway( points_transformed.back() );
+
+		results.push_back( { "TransformPoints (AoS Vector4)", Measure( [ & ]()
+		{
+			Math::TransformPoints( points_homogeneous, points_homogeneous_transformed, transform, Math::Threading::SingleThreaded );
+		} ), "4M points, 1 thread" } );
+		DoNotOptimizeAway( points_homogeneous_transformed.back() );
+
+		results.push_back( { "TransformPoints (SoA)", Measure( [ & ]()
+		{
+			Math::TransformPoints( x, y, z, x_transformed, y_transformed, z_transformed, transform, Math::Threading::SingleThreaded );
+		} ), "4M points, 1 thread" } );
+		DoNotOptimizeAway( x_transformed.back() );
+
+		results.push_back( { "TransformPoints (AoS Vector3, threaded)", Measure( [ & ]()
+		{
+			Math::TransformPoints( points, points_transformed, transform, Math::Threading::Automatic );
+		} ), "4M points, " + thread_detail } );
+		DoNotOptimizeAway( points_transformed.back() );
+
+		results.push_back( { "TransformPoints (SoA, threaded)", Measure( [ & ]()
+		{
+			Math::TransformPoints( x, y, z, x_transformed, y_transformed, z_transformed, transform, Math::Threading::Automatic );
+		} ), "4M points, " + thread_detail } );
+		DoNotOptimizeAway( x_transformed.back() );
+
+		/* Verify that all the batch paths agree with the per-vertex reference. */
+		bool results_match = true;
+		for( std::size_t i = 0; i < count; i += 997 )
+		{
+			const Vector3& reference = points_transformed_reference[ i ];
+			results_match &= points_transformed[ i ] == reference;
+			results_match &= Vector3( points_homogeneous_transformed[ i ].X(), points_homogeneous_transformed[ i ].Y(), points_homogeneous_transformed[ i ].Z() ) == reference;
+			results_match &= Vector3( x_transformed[ i ], y_transformed[ i ], z_transformed[ i ] ) == reference;
+		}
+
+		results.push_back( { "Batch vs. per-vertex results", 0.0, results_match ? "Match (within epsilon)" : "MISMATCH!" } );
+
+		return results;
+	}
+
+	ResultList FrustumCulling()
+	{
+		constexpr int grid_size		= 100;
+		constexpr std::size_t count = grid_size * grid_size * grid_size;
+		constexpr float spacing		= 4.0f;
+
+		std::mt19937 generator( 42 );
+		std::uniform_real_distribution< float > distribution_angle( 0.0f, 360.0f );
+
+		/* Unit cubes, rotated randomly, filling a 400 units wide grid; the camera sits at its center, looking down -Z with a 60 degrees field of view. */
+		const Math::AABB local_bounds{ Vector3( UNIFORM_INITIALIZATION, -0.5f ), Vector3( UNIFORM_INITIALIZATION, 0.5f ) };
+		std::vector< Matrix4x4 > world_matrices;
+		world_matrices.reserve( count );
+		const float grid_origin = -( grid_size - 1 ) * spacing / 2.0f;
+		for( int x = 0; x < grid_size; x++ )
+			for( int y = 0; y < grid_size; y++ )
+				for( int z = 0; z < grid_size; z++ )
+					world_matrices.push_back( Matrix::RotationAroundY( Degrees( distribution_angle( generator ) ) ) *
+											  Matrix::Translation( grid_origin + x * spacing, grid_origin + y * spacing, grid_origin + z * spacing ) );
+
+		const Matrix4x4 view_projection = Matrix::LookAt( Vector3::Zero(), Vector3::Forward() ) *
+										  Matrix::PerspectiveProjection( 0.1f, 150.0f, 16.0f / 9.0f, Degrees( 60.0f ) );
+		const Math::Frustum frustum( view_projection );
+
+		std::vector< Math::AABB > world_bounds( count );
+		std::vector< std::uint8_t > visibility_scalar( count ), visibility_simd( count ), visibility_threaded( count );
+
+		const std::string thread_detail = std::to_string( Utility::ThreadPool::Default().ThreadCount() + 1 ) + " threads";
+
+		ResultList results;
+
+		results.push_back( { "World bounds (AABB::Transformed)", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+				world_bounds[ i ] = local_bounds.Transformed( world_matrices[ i ] );
+		} ), "1M boxes, 1 thread" } );
+		DoNotOptimizeAway( world_bounds.back() );
+
+		std::size_t visible_count_scalar = 0;
+		results.push_back( { "Frustum::IsVisible loop", Measure( [ & ]()
+		{
+			visible_count_scalar = 0;
+			for( std::size_t i = 0; i < count; i++ )
+			{
+				visibility_scalar[ i ] = frustum.IsVisible( world_bounds[ i ] );
+				visible_count_scalar  += visibility_scalar[ i ];
+			}
+		} ), "1M boxes, 1 thread" } );
+
+		std::size_t visible_count_simd = 0;
+		results.push_back( { std::string( "Frustum::Cull (" ) + Math::SIMD::InstructionSetName() + ")", Measure( [ & ]()
+		{
+			visible_count_simd = frustum.Cull( world_bounds, visibility_simd, Math::Threading::SingleThreaded );
+		} ), "1M boxes, 1 thread" } );
+
+		std::size_t visible_count_threaded = 0;
+		results.push_back( { std::string( "Frustum::Cull (" ) + Math::SIMD::InstructionSetName() + ", threaded)", Measure( [ & ]()
+		{
+			visible_count_threaded = frustum.Cull( world_bounds, visibility_threaded, Math::Threading::Automatic );
+		} ), "1M boxes, " + thread_detail } );
+
+		results.push_back( { "Visible / culled", 0.0, std::to_string( visible_count_simd ) + " / " + std::to_string( count - visible_count_simd ) } );
+
+		/* Verify that the SIMD & threaded passes agree with the scalar test. Fused multiply-adds may round differently for boxes exactly touching a plane. */
+		std::size_t mismatch_count = 0;
+		for( std::size_t i = 0; i < count; i++ )
+			mismatch_count += ( visibility_simd[ i ] != visibility_scalar[ i ] ) + ( visibility_threaded[ i ] != visibility_scalar[ i ] );
+
+		const bool results_match = mismatch_count == 0 && visible_count_simd == visible_count_scalar && visible_count_threaded == visible_count_scalar;
+		results.push_back( { "SIMD vs. scalar results", 0.0, results_match ? "Match" : "MISMATCH! (" + std::to_string( mismatch_count ) + " boxes)" } );
+
+		return results;
+	}
+
+	ResultList BoundingVolumeHierarchyQueries()
+	{
+		constexpr std::size_t count			  = 250'000;
+		constexpr float world_size			  = 1000.0f;
+		constexpr int view_count			  = 16;
+		constexpr std::size_t ray_count		  = 100'000;
+		constexpr std::size_t ray_count_linear = 100;
+
+		const auto micro_seconds = []( const double milliseconds, const std::size_t count )
+		{
+			char buffer[ 32 ];
+			std::snprintf( buffer, sizeof( buffer ), "%.2f", 1000.0 * milliseconds / count );
+			return std::string( buffer );
+		};
+
+		std::mt19937 generator( 42 );
+		std::uniform_real_distribution< float > distribution_position( -world_size / 2.0f, world_size / 2.0f );
+		std::uniform_real_distribution< float > distribution_size( 0.5f, 2.0f );
+		std::uniform_real_distribution< float > distribution_unit( -1.0f, 1.0f );
+
+		const auto make_box = [ & ]( const Vector3& center )
+		{
+			const Vector3 extents( distribution_size( generator ), distribution_size( generator ), distribution_size( generator ) );
+			return Math::AABB{ center - extents, center + extents };
+		};
+
+		/* Uniform: Evenly spread over the world. Clustered: 64 tight groups (e.g., buildings' furniture), where the tree's boxes overlap the most. */
+		std::vector< Math::AABB > boxes_uniform, boxes_clustered;
+		boxes_uniform.reserve( count );
+		boxes_clustered.reserve( count );
+		for( std::size_t i = 0; i < count; i++ )
+			boxes_uniform.push_back( make_box( Vector3( distribution_position( generator ), distribution_position( generator ), distribution_position( generator ) ) ) );
+
+		std::vector< Vector3 > cluster_center_list( 64 );
+		for( auto& center : cluster_center_list )
+			center.Set( distribution_position( generator ), distribution_position( generator ), distribution_position( generator ) );
+		std::normal_distribution< float > distribution_cluster( 0.0f, 15.0f );
+		for( std::size_t i = 0; i < count; i++ )
+			boxes_clustered.push_back( make_box( cluster_center_list[ i % cluster_center_list.size() ] +
+												 Vector3( distribution_cluster( generator ), distribution_cluster( generator ), distribution_cluster( generator ) ) ) );
+
+		/* Views from the center, turning around the Y axis, & rays from random points in random directions. */
+		std::vector< Math::Frustum > frustum_list;
+		for( int view = 0; view < view_count; view++ )
+		{
+			const float angle = 6.2831853f * view / view_count;
+			frustum_list.emplace_back( Matrix::LookAt( Vector3::Zero(), Vector3( std::sin( angle ), 0.0f, -std::cos( angle ) ) ) *
+									   Matrix::PerspectiveProjection( 0.1f, 300.0f, 16.0f / 9.0f, Degrees( 60.0f ) ) );
+		}
+
+		std::vector< Math::Ray > ray_list( ray_count );
+		for( auto& ray : ray_list )
+		{
+			ray.origin.Set( distribution_position( generator ), distribution_position( generator ), distribution_position( generator ) );
+			do
+				ray.direction.Set( distribution_unit( generator ), distribution_unit( generator ), distribution_unit( generator ) );
+			while( ray.direction.SquareMagnitude() < 0.01f );
+			ray.direction.Normalize();
+		}
+
+		ResultList results;
+
+		bool results_match = true;
+		for( const auto& [ name, boxes ] : { std::pair< const char*, const std::vector< Math::AABB >* >{ "uniform", &boxes_uniform },
+											 std::pair< const char*, const std::vector< Math::AABB >* >{ "clustered", &boxes_clustered } } )
+		{
+			const std::string suffix = std::string( " (" ) + name + ")";
+
+			Math::BoundingVolumeHierarchy hierarchy;
+			results.push_back( { "Build" + suffix, Measure( [ & ]()
+			{
+				hierarchy.Build( *boxes );
+			} ), std::to_string( hierarchy.NodeCount() ) + " nodes, depth " + std::to_string( hierarchy.Depth() ) + ", SAH cost " +
+				 std::to_string( int( hierarchy.Cost() ) ) + " (vs. " + std::to_string( count ) + " for a flat list)" } );
+
+			/* Frustum queries: all boxes through the SIMD pass vs. the hierarchy. */
+			std::vector< std::uint8_t > visibility( count );
+			std::size_t visible_count_linear = 0;
+			results.push_back( { "Frustum, linear Cull()" + suffix, Measure( [ & ]()
+			{
+				visible_count_linear = 0;
+				for( const auto& frustum : frustum_list )
+					visible_count_linear += frustum.Cull( *boxes, visibility, Math::Threading::SingleThreaded );
+			} ), std::to_string( view_count ) + " views, " + std::to_string( visible_count_linear / view_count ) + " visible on average" } );
+
+			std::vector< std::uint32_t > visible_index_list;
+			std::size_t visible_count_hierarchy = 0;
+			results.push_back( { "Frustum, hierarchy Query()" + suffix, Measure( [ & ]()
+			{
+				visible_count_hierarchy = 0;
+				for( const auto& frustum : frustum_list )
+				{
+					visible_index_list.clear();
+					visible_count_hierarchy += hierarchy.Query( frustum, visible_index_list );
+				}
+			} ), std::to_string( view_count ) + " views, " + std::to_string( visible_count_hierarchy / view_count ) + " visible on average" } );
+
+			/* Verify the sets of the last view. */
+			std::vector< std::uint32_t > visible_index_list_linear;
+			frustum_list.back().Cull( *boxes, visibility, Math::Threading::SingleThreaded );
+			for( std::uint32_t i = 0; i < count; i++ )
+				if( visibility[ i ] )
+					visible_index_list_linear.push_back( i );
+			std::sort( visible_index_list.begin(), visible_index_list.end() );
+			results_match &= visible_index_list == visible_index_list_linear && visible_count_hierarchy == visible_count_linear;
+
+			/* Ray queries: the nearest box. */
+			std::vector< std::optional< Math::BoundingVolumeHierarchy::RayHit > > hit_list( ray_count );
+			const double milliseconds_raycast = Measure( [ & ]()
+			{
+				for( std::size_t i = 0; i < ray_count; i++ )
+					hit_list[ i ] = hierarchy.Raycast( ray_list[ i ] );
+			} );
+			const std::size_t hit_count = std::count_if( hit_list.begin(), hit_list.end(), []( const auto& hit ) { return hit.has_value(); } );
+			results.push_back( { "Raycast, hierarchy" + suffix, milliseconds_raycast, "100K rays, " + micro_seconds( milliseconds_raycast, ray_count ) + " us per ray, " +
+								 std::to_string( hit_count ) + " hits" } );
+
+			std::vector< std::optional< float > > distance_list_linear( ray_count_linear );
+			const double milliseconds_raycast_linear = Measure( [ & ]()
+			{
+				for( std::size_t i = 0; i < ray_count_linear; i++ )
+				{
+					const Math::Ray& ray = ray_list[ i ];
+					const Vector3 direction_inverse( 1.0f / ray.direction.X(), 1.0f / ray.direction.Y(), 1.0f / ray.direction.Z() );
+
+					std::optional< float > closest_distance;
+					for( const auto& box : *boxes )
+						if( const auto distance = box.Intersect( ray, direction_inverse ); distance && ( !closest_distance || *distance < *closest_distance ) )
+							closest_distance = distance;
+
+					distance_list_linear[ i ] = closest_distance;
+				}
+			}, 1 );
+			results.push_back( { "Raycast, linear" + suffix, milliseconds_raycast_linear, "100 rays, " + micro_seconds( milliseconds_raycast_linear, ray_count_linear ) +
+								 " us per ray" } );
+
+			for( std::size_t i = 0; i < ray_count_linear; i++ )
+				results_match &= hit_list[ i ].has_value() == distance_list_linear[ i ].has_value() &&
+								 ( !hit_list[ i ] || hit_list[ i ]->distance == *distance_list_linear[ i ] );
+
+			/* Move every box a little (e.g., settling physics objects): refit vs. rebuild, & the query cost after refitting. */
+			std::vector< Math::AABB > boxes_moved( *boxes );
+			for( auto& box : boxes_moved )
+			{
+				const Vector3 offset( distribution_unit( generator ) * 5.0f, distribution_unit( generator ) * 5.0f, distribution_unit( generator ) * 5.0f );
+				box = { box.min + offset, box.max + offset };
+			}
+
+			results.push_back( { "Refit, boxes moved by up to 5" + suffix, Measure( [ & ]()
+			{
+				hierarchy.Refit( boxes_moved );
+			} ), "SAH cost " + std::to_string( int( hierarchy.Cost() ) ) + " after refitting" } );
+
+			results.push_back( { "Frustum, refitted Query()" + suffix, Measure( [ & ]()
+			{
+				for( const auto& frustum : frustum_list )
+				{
+					visible_index_list.clear();
+					hierarchy.Query( frustum, visible_index_list );
+				}
+			} ), std::to_string( view_count ) + " views" } );
+
+			std::sort( visible_index_list.begin(), visible_index_list.end() );
+			visible_index_list_linear.clear();
+			frustum_list.back().Cull( boxes_moved, visibility, Math::Threading::SingleThreaded );
+			for( std::uint32_t i = 0; i < count; i++ )
+				if( visibility[ i ] )
+					visible_index_list_linear.push_back( i );
+			results_match &= visible_index_list == visible_index_list_linear;
+		}
+
+		results.push_back( { "Hierarchy vs. linear results", 0.0, results_match ? "Match" : "MISMATCH!" } );
+
+		return results;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+// Framework Includes.
+#include "Benchmark/Benchmark.h"
+
+namespace Framework::Benchmark
+{
+	/* Compares the generic Matrix template against the SIMD kernels, over a million matrices. */
+	ResultList Matrix4x4Multiplication();
+
+	/* Compares per-vertex Vector * Matrix loops against the batch TransformPoints() kernels (AoS, SoA & multi-threaded), over 4 million points. */
+	ResultList BatchTransform();
+
+	/* Transforms the bounds of a million boxes on a grid around the camera to world space & culls them against its frustum: scalar tests against the 4-wide
+	 * SIMD pass, single- & multi-threaded. */
+	ResultList FrustumCulling();
+
+	/* Builds, queries & refits a BoundingVolumeHierarchy over 250K boxes, spread uniformly & in clusters; frustum & ray queries are compared against
+	 * (& verified by) linear tests of all boxes. */
+	ResultList BoundingVolumeHierarchyQueries();
+}
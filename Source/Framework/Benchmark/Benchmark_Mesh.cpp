@@ -0,0 +1,456 @@
+// Framework Includes.
+#include "Benchmark/Benchmark_Mesh.h"
+#include "Benchmark/GLStub.h"
+
+#include "Math/Math.h"
+#include "Math/Vector.hpp"
+
+#include "Renderer/IndexBuffer.h"
+#include "Renderer/MeshFile.h"
+#include "Renderer/MeshImporter.h"
+#include "Renderer/MeshUtility.hpp"
+#include "Renderer/Primitive/Primitive_Cube.h"
+#include "Renderer/VertexArray.h"
+
+// std Includes.
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace Framework::Benchmark
+{
+	namespace
+	{
+		/* Position, normal & uv. */
+		using SphereVertex = Math::Vector< float, 8 >;
+
+		/* Unrolled (non-indexed) triangle list, as a naive exporter would produce it: every quad is 6 vertices. */
+		std::vector< SphereVertex > MakeUnrolledSphere( const int segment_count_horizontal, const int segment_count_vertical )
+		{
+			const auto make_vertex = [ & ]( const int x, const int y )
+			{
+				const float u = float( x ) / segment_count_horizontal, v = float( y ) / segment_count_vertical;
+				const float azimuth = u * Constants< float >::Two_Pi(), polar = v * Constants< float >::Pi();
+				const float nx = std::sin( polar ) * std::cos( azimuth ), ny = std::cos( polar ), nz = std::sin( polar ) * std::sin( azimuth );
+
+				return SphereVertex( nx * 0.5f, ny * 0.5f, nz * 0.5f, nx, ny, nz, u, v );
+			};
+
+			std::vector< SphereVertex > vertices;
+			vertices.reserve( std::size_t( segment_count_horizontal ) * segment_count_vertical * 6 );
+			for( int y = 0; y < segment_count_vertical; y++ )
+			{
+				for( int x = 0; x < segment_count_horizontal; x++ )
+				{
+					vertices.push_back( make_vertex( x,		y ) );
+					vertices.push_back( make_vertex( x,		y + 1 ) );
+					vertices.push_back( make_vertex( x + 1, y + 1 ) );
+					vertices.push_back( make_vertex( x + 1, y + 1 ) );
+					vertices.push_back( make_vertex( x + 1, y ) );
+					vertices.push_back( make_vertex( x,		y ) );
+				}
+			}
+
+			return vertices;
+		}
+
+		template< typename VertexType >
+		std::string WeldingDetail( const std::size_t vertex_count_unrolled, const MeshUtility::IndexedMesh< VertexType >& mesh )
+		{
+			const std::size_t byte_count_unrolled = vertex_count_unrolled * sizeof( VertexType );
+			const std::size_t byte_count_indexed  = mesh.vertices.size() * sizeof( VertexType ) + mesh.indices.size() * ( mesh.FitsInto16BitIndices() ? 2 : 4 );
+
+			return std::to_string( vertex_count_unrolled ) + " -> " + std::to_string( mesh.vertices.size() ) + " vertices (" +
+				   std::to_string( double( vertex_count_unrolled ) / mesh.vertices.size() ).substr( 0, 4 ) + "x fewer vertex shader runs), " +
+				   std::to_string( byte_count_unrolled ) + " -> " + std::to_string( byte_count_indexed ) + " bytes incl. " +
+				   ( mesh.FitsInto16BitIndices() ? "16" : "32" ) + "-bit indices";
+		}
+
+		/* Positions only; the optimizations only look at the indices anyway. */
+		MeshUtility::IndexedMesh< Vector3 > MakeGrid( const int quad_count_x, const int quad_count_y )
+		{
+			MeshUtility::IndexedMesh< Vector3 > mesh;
+			mesh.vertices.reserve( std::size_t( quad_count_x + 1 ) * ( quad_count_y + 1 ) );
+			mesh.indices.reserve( std::size_t( quad_count_x ) * quad_count_y * 6 );
+
+			for( int y = 0; y <= quad_count_y; y++ )
+				for( int x = 0; x <= quad_count_x; x++ )
+					mesh.vertices.emplace_back( float( x ), 0.0f, float( y ) );
+
+			const auto index_of = [ & ]( const int x, const int y ) { return std::uint32_t( y * ( quad_count_x + 1 ) + x ); };
+			for( int y = 0; y < quad_count_y; y++ )
+			{
+				for( int x = 0; x < quad_count_x; x++ )
+				{
+					mesh.indices.insert( mesh.indices.end(), { index_of( x, y ), index_of( x, y + 1 ), index_of( x + 1, y + 1 ) } );
+					mesh.indices.insert( mesh.indices.end(), { index_of( x + 1, y + 1 ), index_of( x + 1, y ), index_of( x, y ) } );
+				}
+			}
+
+			return mesh;
+		}
+
+		/* Triangle order as it comes out of e.g. a spatially unaware exporter or a parallel tessellator. Fixed seed for reproducible results. */
+		void ShuffleTriangles( std::vector< std::uint32_t >& indices )
+		{
+			std::mt19937 generator( 42 );
+			const std::size_t triangle_count = indices.size() / 3;
+			for( std::size_t i = triangle_count - 1; i > 0; i-- )
+			{
+				const std::size_t j = std::uniform_int_distribution< std::size_t >( 0, i )( generator );
+				std::swap_ranges( indices.begin() + i * 3, indices.begin() + i * 3 + 3, indices.begin() + j * 3 );
+			}
+		}
+
+		/* Indexed the way exporters write it: One position/uv/normal per grid point, faces referencing the same index for all three ("i/i/i"). */
+		void WriteSphereOBJ( const std::string& file_path, const int segment_count_horizontal, const int segment_count_vertical )
+		{
+			std::ofstream stream( file_path, std::ios::binary | std::ios::trunc );
+
+			for( int y = 0; y <= segment_count_vertical; y++ )
+			{
+				for( int x = 0; x <= segment_count_horizontal; x++ )
+				{
+					const float u = float( x ) / segment_count_horizontal, v = float( y ) / segment_count_vertical;
+					const float azimuth = u * Constants< float >::Two_Pi(), polar = v * Constants< float >::Pi();
+					const float nx = std::sin( polar ) * std::cos( azimuth ), ny = std::cos( polar ), nz = std::sin( polar ) * std::sin( azimuth );
+
+					stream << "v " << nx * 0.5f << ' ' << ny * 0.5f << ' ' << nz * 0.5f << '\n'
+						   << "vt " << u << ' ' << v << '\n'
+						   << "vn " << nx << ' ' << ny << ' ' << nz << '\n';
+				}
+			}
+
+			const auto index_of = [ & ]( const int x, const int y ) { return std::to_string( y * ( segment_count_horizontal + 1 ) + x + 1 ); };
+			const auto corner	= [ & ]( const int x, const int y ) { const auto index = index_of( x, y ); return index + '/' + index + '/' + index; };
+			for( int y = 0; y < segment_count_vertical; y++ )
+				for( int x = 0; x < segment_count_horizontal; x++ )
+					stream << "f " << corner( x, y ) << ' ' << corner( x, y + 1 ) << ' ' << corner( x + 1, y + 1 ) << ' ' << corner( x + 1, y ) << '\n';
+		}
+
+		/* The importer's layout (float positions, normals & uvs), as a single interleaved buffer view followed by 32-bit indices. The buffer goes to
+		 * "<file_path without extension>.bin", or into the .gltf itself as a base64 data URI. */
+		void WriteGLTF( const std::string& file_path, const MeshData& mesh_data, const bool embed_buffer )
+		{
+			std::string buffer( reinterpret_cast< const char* >( mesh_data.vertex_data.data() ), mesh_data.vertex_data.size() );
+			buffer.append( reinterpret_cast< const char* >( mesh_data.indices.data() ), mesh_data.indices.size() * sizeof( std::uint32_t ) );
+
+			std::string uri;
+			if( embed_buffer )
+			{
+				const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+				uri = "data:application/octet-stream;base64,";
+				for( std::size_t i = 0; i < buffer.size(); i += 3 )
+				{
+					std::uint32_t bits = std::uint32_t( ( unsigned char )buffer[ i ] ) << 16;
+					if( i + 1 < buffer.size() ) bits |= std::uint32_t( ( unsigned char )buffer[ i + 1 ] ) << 8;
+					if( i + 2 < buffer.size() ) bits |= std::uint32_t( ( unsigned char )buffer[ i + 2 ] );
+
+					uri += alphabet[ ( bits >> 18 ) & 63 ];
+					uri += alphabet[ ( bits >> 12 ) & 63 ];
+					uri += i + 1 < buffer.size() ? alphabet[ ( bits >> 6 ) & 63 ] : '=';
+					uri += i + 2 < buffer.size() ? alphabet[ bits & 63 ] : '=';
+				}
+			}
+			else
+			{
+				const auto buffer_file_path = std::filesystem::path( file_path ).replace_extension( ".bin" );
+				std::ofstream( buffer_file_path, std::ios::binary | std::ios::trunc ).write( buffer.data(), buffer.size() );
+				uri = buffer_file_path.filename().string();
+			}
+
+			const std::string vertex_count = std::to_string( mesh_data.vertex_count ), index_count = std::to_string( mesh_data.indices.size() );
+			const std::string vertex_byte_count = std::to_string( mesh_data.vertex_data.size() );
+			std::ofstream( file_path, std::ios::binary | std::ios::trunc ) <<
+				"{\n"
+				"\t\"asset\": { \"version\": \"2.0\" },\n"
+				"\t\"buffers\": [ { \"byteLength\": " << buffer.size() << ", \"uri\": \"" << uri << "\" } ],\n"
+				"\t\"bufferViews\": [\n"
+				"\t\t{ \"buffer\": 0, \"byteOffset\": 0, \"byteLength\": " << vertex_byte_count << ", \"byteStride\": 32, \"target\": 34962 },\n"
+				"\t\t{ \"buffer\": 0, \"byteOffset\": " << vertex_byte_count << ", \"byteLength\": " << buffer.size() - mesh_data.vertex_data.size() << ", \"target\": 34963 }\n"
+				"\t],\n"
+				"\t\"accessors\": [\n"
+				"\t\t{ \"bufferView\": 0, \"byteOffset\": 0,  \"componentType\": 5126, \"count\": " << vertex_count << ", \"type\": \"VEC3\" },\n"
+				"\t\t{ \"bufferView\": 0, \"byteOffset\": 12, \"componentType\": 5126, \"count\": " << vertex_count << ", \"type\": \"VEC3\" },\n"
+				"\t\t{ \"bufferView\": 0, \"byteOffset\": 24, \"componentType\": 5126, \"count\": " << vertex_count << ", \"type\": \"VEC2\" },\n"
+				"\t\t{ \"bufferView\": 1, \"componentType\": 5125, \"count\": " << index_count << ", \"type\": \"SCALAR\" }\n"
+				"\t],\n"
+				"\t\"meshes\": [ { \"primitives\": [ { \"attributes\": { \"POSITION\": 0, \"NORMAL\": 1, \"TEXCOORD_0\": 2 }, \"indices\": 3 } ] } ]\n"
+				"}\n";
+		}
+
+		template< typename VertexType >
+		Result OptimizeAndMeasure( const char* label, const MeshUtility::IndexedMesh< VertexType >& mesh )
+		{
+			const auto before = MeshUtility::AnalyzeVertexCache( mesh.indices, mesh.vertices.size() );
+
+			MeshUtility::IndexedMesh< VertexType > mesh_optimized;
+			const double milliseconds = Measure( [ & ]()
+			{
+				mesh_optimized = mesh;
+				MeshUtility::Optimize( mesh_optimized );
+			} );
+
+			const auto after = MeshUtility::AnalyzeVertexCache( mesh_optimized.indices, mesh_optimized.vertices.size() );
+
+			const auto format = []( const float value ) { return std::to_string( value ).substr( 0, 5 ); };
+			return { label, milliseconds,
+					 std::to_string( mesh.indices.size() / 3 ) + " triangles: ACMR " + format( before.acmr ) + " -> " + format( after.acmr ) +
+					 ", ATVR " + format( before.atvr ) + " -> " + format( after.atvr ) };
+		}
+	}
+
+	ResultList MeshWelding()
+	{
+		ResultList results;
+
+		{
+			const auto cube_vertices = MeshUtility::Interleave( Primitives::Cube::Positions, Primitives::Cube::UVs );
+
+			MeshUtility::IndexedMesh< std::remove_cv_t< decltype( cube_vertices )::value_type > > cube_mesh;
+			const double milliseconds = Measure( [ & ]() { cube_mesh = MeshUtility::Weld( cube_vertices.data(), cube_vertices.size() ); } );
+			results.push_back( { "Cube (positions & uvs)", milliseconds, WeldingDetail( cube_vertices.size(), cube_mesh ) } );
+		}
+
+		{
+			const auto sphere_vertices = MakeUnrolledSphere( 256, 128 );
+
+			MeshUtility::IndexedMesh< SphereVertex > sphere_mesh;
+			const double milliseconds = Measure( [ & ]() { sphere_mesh = MeshUtility::Weld( sphere_vertices.data(), sphere_vertices.size() ); } );
+			results.push_back( { "UV sphere, 256x128 segments", milliseconds, WeldingDetail( sphere_vertices.size(), sphere_mesh ) } );
+		}
+
+		return results;
+	}
+
+	ResultList VertexCacheOptimization()
+	{
+		ResultList results;
+
+		auto grid_mesh = MakeGrid( 1024, 1024 );
+		results.push_back( OptimizeAndMeasure( "Grid 1024x1024, scanline order", grid_mesh ) );
+
+		ShuffleTriangles( grid_mesh.indices );
+		results.push_back( OptimizeAndMeasure( "Grid 1024x1024, shuffled", grid_mesh ) );
+
+		const auto sphere_vertices = MakeUnrolledSphere( 256, 128 );
+		results.push_back( OptimizeAndMeasure( "UV sphere, 256x128 segments", MeshUtility::Weld( sphere_vertices.data(), sphere_vertices.size() ) ) );
+
+		return results;
+	}
+
+	ResultList VertexQuantization()
+	{
+		ResultList results;
+
+		const auto sphere_vertices = MakeUnrolledSphere( 256, 128 );
+		const auto sphere_mesh	   = MeshUtility::Weld( sphere_vertices.data(), sphere_vertices.size() );
+		const unsigned int vertex_count = ( unsigned int )sphere_mesh.vertices.size();
+
+		GLStub gl_stub( {} );
+
+		/* Returns the uploaded byte count. */
+		const auto upload = []( const std::byte* data, const unsigned int vertex_count, const VertexBufferLayout& vertex_buffer_layout )
+		{
+			GLStub::ResetStatistics();
+			VertexBuffer vertex_buffer( data, vertex_count, vertex_buffer_layout.GetStride() );
+			VertexArray vertex_array( vertex_buffer, vertex_buffer_layout );
+			return GLStub::GetStatistics().buffer_upload_byte_count;
+		};
+
+		{
+			VertexBufferLayout vertex_buffer_layout;
+			vertex_buffer_layout.Push< float >( 3 );
+			vertex_buffer_layout.Push< float >( 3 );
+			vertex_buffer_layout.Push< float >( 2 );
+
+			const auto byte_count = upload( reinterpret_cast< const std::byte* >( sphere_mesh.vertices.data() ), vertex_count, vertex_buffer_layout );
+			results.push_back( { "UV sphere, float", 0.0,
+								 std::to_string( vertex_count ) + " vertices, " + std::to_string( vertex_buffer_layout.GetStride() ) + " bytes/vertex, " +
+								 std::to_string( byte_count ) + " bytes uploaded" } );
+		}
+
+		{
+			using namespace MeshUtility;
+
+			QuantizedVertices quantized_vertices;
+			const double milliseconds = Measure( [ & ]()
+			{
+				quantized_vertices = Quantize( sphere_mesh.vertices,
+											   { { 3, AttributeFormat::Half }, { 3, AttributeFormat::SNorm10_10_10_2 }, { 2, AttributeFormat::UNorm16 } } );
+			} );
+
+			const auto byte_count = upload( quantized_vertices.data.data(), quantized_vertices.vertex_count, quantized_vertices.layout );
+
+			const auto format = []( const float value ) { return std::to_string( value ).substr( 0, 8 ); };
+			results.push_back( { "UV sphere, quantized", milliseconds,
+								 std::to_string( quantized_vertices.vertex_count ) + " vertices, " + std::to_string( quantized_vertices.layout.GetStride() ) + " bytes/vertex, " +
+								 std::to_string( byte_count ) + " bytes uploaded; max. error: position " + format( quantized_vertices.max_error_list[ 0 ] ) +
+								 ", normal " + format( quantized_vertices.max_error_list[ 1 ] ) + ", uv " + format( quantized_vertices.max_error_list[ 2 ] ) } );
+		}
+
+		return results;
+	}
+
+	ResultList MeshLoading()
+	{
+		const auto directory			= std::filesystem::temp_directory_path();
+		const std::string obj_file_path	= ( directory / "Benchmark_MeshLoading.obj" ).string();
+		const std::string mesh_file_path			= ( directory / "Benchmark_MeshLoading.mesh" ).string();
+		const std::string mesh_file_path_quantized	= ( directory / "Benchmark_MeshLoading_Quantized.mesh" ).string();
+
+		WriteSphereOBJ( obj_file_path, 512, 256 );
+
+		/* What the mesh converter does (MeshConverter's --optimize & --quantize). */
+		{
+			auto mesh_data = *MeshImporter::ImportOBJ( obj_file_path );
+			MeshUtility::OptimizeVertexCache( mesh_data.indices, mesh_data.vertex_count );
+			MeshUtility::RemapVertices( mesh_data.vertex_data, mesh_data.layout.GetStride(), MeshUtility::OptimizeVertexFetch( mesh_data.indices, mesh_data.vertex_count ) );
+			MeshFile::Write( mesh_file_path, mesh_data );
+
+			auto quantized_vertices = MeshUtility::Quantize( reinterpret_cast< const float* >( mesh_data.vertex_data.data() ), mesh_data.vertex_count, 8,
+															 { { 3, MeshUtility::AttributeFormat::Half },
+															   { 3, MeshUtility::AttributeFormat::SNorm10_10_10_2 },
+															   { 2, MeshUtility::AttributeFormat::UNorm16 } } );
+			mesh_data.vertex_data = std::move( quantized_vertices.data );
+			mesh_data.layout	  = quantized_vertices.layout;
+			MeshFile::Write( mesh_file_path_quantized, mesh_data );
+		}
+
+		GLStub gl_stub( {} );
+
+		const auto detail = []( const std::string& file_path, const unsigned int vertex_count, const unsigned int index_count )
+		{
+			return std::to_string( std::filesystem::file_size( file_path ) ) + " bytes on disk, " + std::to_string( vertex_count ) + " vertices, " +
+				   std::to_string( index_count / 3 ) + " triangles, " + std::to_string( GLStub::GetStatistics().buffer_upload_byte_count ) + " bytes uploaded";
+		};
+
+		ResultList results;
+
+		{
+			unsigned int vertex_count = 0, index_count = 0;
+			const double milliseconds = Measure( [ & ]()
+			{
+				GLStub::ResetStatistics();
+
+				const auto mesh_data = MeshImporter::ImportOBJ( obj_file_path );
+				VertexBuffer vertex_buffer( mesh_data->vertex_data.data(), mesh_data->vertex_count, mesh_data->layout.GetStride() );
+				IndexBuffer index_buffer( mesh_data->indices );
+				VertexArray vertex_array( vertex_buffer, mesh_data->layout, &index_buffer );
+
+				vertex_count = mesh_data->vertex_count;
+				index_count	 = ( unsigned int )mesh_data->indices.size();
+			} );
+
+			results.push_back( { "OBJ: Parse & upload", milliseconds, detail( obj_file_path, vertex_count, index_count ) } );
+		}
+
+		for( const auto& [ label, file_path ] : { std::pair{ "MeshFile: Map & upload", mesh_file_path }, std::pair{ "MeshFile (quantized): Map & upload", mesh_file_path_quantized } } )
+		{
+			unsigned int vertex_count = 0, index_count = 0;
+			const double milliseconds = Measure( [ & ]()
+			{
+				GLStub::ResetStatistics();
+
+				const MeshFile mesh_file( file_path );
+				VertexBuffer vertex_buffer( mesh_file.VertexData(), mesh_file.VertexCount(), mesh_file.Stride() );
+				IndexBuffer index_buffer( mesh_file.IndexData(), mesh_file.IndexCount(), mesh_file.IndexType() );
+				VertexArray vertex_array( vertex_buffer, mesh_file.Layout(), &index_buffer );
+
+				vertex_count = mesh_file.VertexCount();
+				index_count	 = mesh_file.IndexCount();
+			} );
+
+			results.push_back( { label, milliseconds, detail( file_path, vertex_count, index_count ) } );
+		}
+
+		/* Indices past the vertex count would have the GPU read past the vertex buffer; such files have to be rejected at load. */
+		{
+			MeshData mesh_data;
+			mesh_data.vertex_count = 3;
+			mesh_data.layout.Push< float >( 3 );
+			mesh_data.vertex_data.resize( mesh_data.vertex_count * mesh_data.layout.GetStride() );
+			mesh_data.indices = { 0, 1, 3 };
+			MeshFile::Write( mesh_file_path, mesh_data );
+
+			const bool is_rejected = !MeshFile( mesh_file_path ).IsValid();
+			results.push_back( { "MeshFile: Index out of range", 0.0, is_rejected ? "Rejected" : "NOT REJECTED!" } );
+		}
+
+		std::filesystem::remove( obj_file_path );
+		std::filesystem::remove( mesh_file_path );
+		std::filesystem::remove( mesh_file_path_quantized );
+
+		return results;
+	}
+
+	ResultList MeshImport()
+	{
+		const auto directory				= std::filesystem::temp_directory_path();
+		const std::string obj_file_path		= ( directory / "Benchmark_MeshImport.obj" ).string();
+		const std::string gltf_file_path	= ( directory / "Benchmark_MeshImport.gltf" ).string();
+		const std::string bin_file_path		= ( directory / "Benchmark_MeshImport.bin" ).string();
+		const std::string gltf_embedded_file_path = ( directory / "Benchmark_MeshImport_Embedded.gltf" ).string();
+		const std::string cache_file_path	= obj_file_path + ".mesh";
+
+		WriteSphereOBJ( obj_file_path, 768, 384 );
+		{
+			const auto mesh_data = *MeshImporter::ImportOBJ( obj_file_path );
+			WriteGLTF( gltf_file_path, mesh_data, false );
+			WriteGLTF( gltf_embedded_file_path, mesh_data, true );
+		}
+
+		const auto megabytes = []( const std::string& file_path ) { return double( std::filesystem::file_size( file_path ) ) / ( 1024.0 * 1024.0 ); };
+
+		const auto detail = []( const double megabyte_count, const double milliseconds, const std::optional< MeshData >& mesh_data )
+		{
+			return std::to_string( megabyte_count ).substr( 0, 5 ) + " MB at " + std::to_string( megabyte_count / ( milliseconds / 1000.0 ) ).substr( 0, 6 ) + " MB/s, " +
+				   ( mesh_data ? std::to_string( mesh_data->vertex_count ) + " vertices, " + std::to_string( mesh_data->indices.size() / 3 ) + " triangles"
+							   : std::string( "FAILED" ) );
+		};
+
+		ResultList results;
+
+		const unsigned int hardware_thread_count = std::max( std::thread::hardware_concurrency(), 1u );
+		for( const unsigned int worker_count : { 0u, 1u, 3u, 7u } )
+		{
+			/* More workers than hardware threads would only measure the OS scheduler. */
+			if( worker_count != 0 && worker_count >= hardware_thread_count )
+				continue;
+
+			Utility::ThreadPool thread_pool( worker_count );
+			const std::string threads = " (" + std::to_string( worker_count + 1 ) + " threads)";
+
+			const auto measure = [ & ]( const std::string& label, const std::string& file_path, const double megabyte_count,
+										std::optional< MeshData >( *import )( const std::string&, Utility::ThreadPool& ) )
+			{
+				std::optional< MeshData > mesh_data;
+				const double milliseconds = Measure( [ & ]() { mesh_data = import( file_path, thread_pool ); } );
+				results.push_back( { label + threads, milliseconds, detail( megabyte_count, milliseconds, mesh_data ) } );
+			};
+
+			measure( "OBJ",									obj_file_path,			 megabytes( obj_file_path ),						  MeshImporter::ImportOBJ );
+			measure( "glTF, external .bin",					gltf_file_path,			 megabytes( gltf_file_path ) + megabytes( bin_file_path ), MeshImporter::ImportGLTF );
+			measure( "glTF, embedded base64 buffer",		gltf_embedded_file_path, megabytes( gltf_embedded_file_path ),				  MeshImporter::ImportGLTF );
+		}
+
+		{
+			std::filesystem::remove( cache_file_path );
+			MeshImporter::Import( obj_file_path, { .use_cache = true } ); // Writes the cache.
+
+			std::optional< MeshData > mesh_data;
+			const double milliseconds = Measure( [ & ]() { mesh_data = MeshImporter::Import( obj_file_path, { .use_cache = true } ); } );
+			results.push_back( { "OBJ, cached (.mesh)", milliseconds, detail( megabytes( cache_file_path ), milliseconds, mesh_data ) } );
+		}
+
+		for( const auto& file_path : { obj_file_path, gltf_file_path, bin_file_path, gltf_embedded_file_path, cache_file_path } )
+			std::filesystem::remove( file_path );
+
+		return results;
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Framework Includes.
+#include "Benchmark/Benchmark.h"
+
+namespace Framework::Benchmark
+{
+	/* Vertex & index counts, GPU memory & welding time for the cube primitive & a non-indexed 256x128-segment UV sphere (position, normal & uv per vertex),
+	 * before & after MeshUtility::Weld(). */
+	ResultList MeshWelding();
+
+	/* Post-transform cache efficiency (ACMR & ATVR of a simulated 16-entry FIFO) before & after MeshUtility::Optimize(), & its run time,
+	 * for a 1024x1024-quad grid (~2M triangles) in scanline & in shuffled triangle order & for the welded 256x128-segment UV sphere. */
+	ResultList VertexCacheOptimization();
+
+	/* Vertex size, GPU memory (as uploaded through GLStub), largest errors & run time of MeshUtility::Quantize() for the welded 256x128-segment UV sphere:
+	 * Half positions, SNorm10_10_10_2 normals & UNorm16 uvs vs. floats. */
+	ResultList VertexQuantization();
+
+	/* Load & upload (through GLStub) time of a 512x256-segment UV sphere (131k vertices, 262k triangles) from an OBJ file vs. from MeshFiles (as written by
+	 * the mesh converter, with & without quantization). Files are written to the temp. directory; timings are with a warm OS file cache.
+	 * Also checks that MeshFiles with out of range indices are rejected. */
+	ResultList MeshLoading();
+
+	/* Import throughput (MB/s) of MeshImporter for a 768x384-segment UV sphere (~296k vertices, ~590k triangles) as OBJ, as glTF with an external .bin
+	 * & as glTF with an embedded base64 buffer, on thread pools of 1, 2, 4 & 8 threads (as far as the hardware has them), & the import through the cache. */
+	ResultList MeshImport();
+}
@@ -0,0 +1,922 @@
+// Framework Includes.
+#include "Benchmark/Benchmark_Renderer.h"
+#include "Benchmark/GLStub.h"
+
+#include "Renderer/Drawable.h"
+#include "Renderer/Graphics.h"
+#include "Renderer/Material.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/Shader.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/StreamingBuffer.h"
+#include "Renderer/UniformBlock.h"
+#include "Renderer/UniformBuffer.h"
+
+#include "Scene/Transform.h"
+
+#include "Utility/RadixSort.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Framework::Benchmark
+{
+	namespace
+	{
+		/* GL state as modeled by the fake function table of StateCacheRedundancy(). */
+		struct FakeGLState
+		{
+			static constexpr std::size_t OBJECT_COUNT = 9; // Names 0-8.
+
+			GLuint program;
+			GLuint vertex_array;
+			GLenum texture_unit_active;
+			GLuint texture_binding_list[ StateCache::MAX_TEXTURE_UNIT_COUNT ];
+			GLuint array_buffer;
+			GLuint element_array_buffer_per_vertex_array[ OBJECT_COUNT ];
+			GLuint uniform_buffer;
+			GLuint uniform_buffer_binding_list[ StateCache::MAX_UNIFORM_BUFFER_COUNT ];
+			bool depth_test;
+			GLenum polygon_mode;
+
+			std::size_t call_count;
+		};
+
+		FakeGLState fake_gl_state;
+
+		const StateCache::FunctionTable fake_gl_function_table
+		{
+			.UseProgram			= []( GLuint program_id )							{ fake_gl_state.call_count++; fake_gl_state.program = program_id; },
+			.BindVertexArray	= []( GLuint vertex_array_id )						{ fake_gl_state.call_count++; fake_gl_state.vertex_array = vertex_array_id; },
+			.ActiveTexture		= []( GLenum texture_unit )							{ fake_gl_state.call_count++; fake_gl_state.texture_unit_active = texture_unit; },
+			.BindTexture		= []( GLenum, GLuint texture_id )
+			{
+				fake_gl_state.call_count++;
+				fake_gl_state.texture_binding_list[ fake_gl_state.texture_unit_active - GL_TEXTURE0 ] = texture_id;
+			},
+			.BindBuffer			= []( GLenum target, GLuint buffer_id )
+			{
+				fake_gl_state.call_count++;
+				switch( target )
+				{
+					case GL_ARRAY_BUFFER:			fake_gl_state.array_buffer = buffer_id;														 break;
+					case GL_ELEMENT_ARRAY_BUFFER:	fake_gl_state.element_array_buffer_per_vertex_array[ fake_gl_state.vertex_array ] = buffer_id; break;
+					case GL_UNIFORM_BUFFER:			fake_gl_state.uniform_buffer = buffer_id;													 break;
+				}
+			},
+			.BindBufferBase		= []( GLenum, GLuint index, GLuint buffer_id )
+			{
+				fake_gl_state.call_count++;
+				fake_gl_state.uniform_buffer_binding_list[ index ] = buffer_id;
+				fake_gl_state.uniform_buffer					   = buffer_id;
+			},
+			.Enable				= []( GLenum )										{ fake_gl_state.call_count++; fake_gl_state.depth_test = true; },
+			.Disable			= []( GLenum )										{ fake_gl_state.call_count++; fake_gl_state.depth_test = false; },
+			.PolygonMode		= []( GLenum, GLenum mode )							{ fake_gl_state.call_count++; fake_gl_state.polygon_mode = mode; }
+		};
+	}
+
+	ResultList UniformSetters()
+	{
+		constexpr std::size_t draw_count = 100'000;
+
+		GLStub gl_stub( { { "transform_world", GL_FLOAT_MAT4 }, { "transform_view", GL_FLOAT_MAT4 }, { "transform_projection", GL_FLOAT_MAT4 } } );
+
+		Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+		Material material( &shader );
+		material.Bind(); // Regular uniforms are only sent right away while their Material is bound.
+
+		const Matrix4x4 transform_world, transform_view, transform_projection;
+
+		const auto per_draw_detail = []( const double milliseconds )
+		{
+			return std::to_string( milliseconds * 1'000'000.0 / draw_count ) + " ns/draw, " +
+				   std::to_string( GLStub::GetStatistics().uniform_call_count ) + " uniform calls recorded";
+		};
+
+		ResultList results;
+
+		GLStub::ResetStatistics();
+		const double milliseconds_string = Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < draw_count; i++ )
+			{
+				material.SetMatrix( "transform_world",		transform_world );
+				material.SetMatrix( "transform_view",		transform_view );
+				material.SetMatrix( "transform_projection", transform_projection );
+			}
+		}, 1 );
+		results.push_back( { "std::string lookups", milliseconds_string, per_draw_detail( milliseconds_string ) } );
+
+		const UniformHandle handle_world      = shader.GetUniformHandle( "transform_world" );
+		const UniformHandle handle_view       = shader.GetUniformHandle( "transform_view" );
+		const UniformHandle handle_projection = shader.GetUniformHandle( "transform_projection" );
+
+		GLStub::ResetStatistics();
+		const double milliseconds_handle = Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < draw_count; i++ )
+			{
+				material.SetMatrix( handle_world,	   transform_world );
+				material.SetMatrix( handle_view,	   transform_view );
+				material.SetMatrix( handle_projection, transform_projection );
+			}
+		}, 1 );
+		results.push_back( { "UniformHandle", milliseconds_handle, per_draw_detail( milliseconds_handle ) } );
+
+		using namespace Literals;
+
+		GLStub::ResetStatistics();
+		const double milliseconds_hashed = Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < draw_count; i++ )
+			{
+				material.SetMatrix( "transform_world"_uniform,		transform_world );
+				material.SetMatrix( "transform_view"_uniform,		transform_view );
+				material.SetMatrix( "transform_projection"_uniform, transform_projection );
+			}
+		}, 1 );
+		results.push_back( { "_uniform literals (hashed)", milliseconds_hashed, per_draw_detail( milliseconds_hashed ) } );
+
+		/* Unknown uniforms: Resolving their names throws in debug builds & yields an invalid handle in release, which all setters have to ignore. */
+		const UniformHandle handle_unknown;
+		GLStub::ResetStatistics();
+		material.SetMatrix( handle_unknown, transform_world ).SetFloat( handle_unknown, 1.0f ).SetVector( handle_unknown, Vector4::One() ).SetTextureSampler2D( handle_unknown, 0 );
+		shader.SetMatrix( handle_unknown, transform_world );
+		shader.SetInt( handle_unknown, 0 );
+	#ifndef _DEBUG
+		material.SetFloat( "does_not_exist", 1.0f ).SetFloat( "does_not_exist"_uniform, 1.0f );
+	#endif // _DEBUG
+		const bool unknown_uniforms_ignored = GLStub::GetStatistics().uniform_call_count == 0;
+		results.push_back( { "Unknown uniform", 0.0, unknown_uniforms_ignored ? "Ignored (no uniform calls)" : "NOT IGNORED!" } );
+
+		return results;
+	}
+
+	ResultList CameraUniforms()
+	{
+		constexpr std::size_t drawable_count = 1000;
+		constexpr std::size_t frame_count    = 100;
+
+		const Matrix4x4 transform_view, transform_projection;
+
+		const auto per_frame_detail = []( const double milliseconds )
+		{
+			const auto& statistics = GLStub::GetStatistics();
+			return std::to_string( milliseconds * 1'000.0 / frame_count ) + " us/frame, " +
+				   std::to_string( statistics.call_count / frame_count ) + " GL calls/frame (" +
+				   std::to_string( statistics.uniform_call_count / frame_count ) + " uniform, " +
+				   std::to_string( statistics.buffer_upload_count / frame_count ) + " buffer uploads)";
+		};
+
+		const auto make_vertex_array = []()
+		{
+			const float vertices[ 9 ] = {};
+			VertexBuffer vertex_buffer( vertices, 3 );
+			VertexBufferLayout vertex_buffer_layout;
+			vertex_buffer_layout.Push< float >( 3 );
+			return std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout );
+		};
+
+		std::vector< Transform > transform_list( drawable_count );
+
+		ResultList results;
+
+		/* Before: view & projection as regular uniforms, set for every Drawable. */
+		{
+			GLStub gl_stub( { { "transform_world", GL_FLOAT_MAT4 }, { "transform_view", GL_FLOAT_MAT4 }, { "transform_projection", GL_FLOAT_MAT4 } } );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			Material material( &shader );
+			const auto vertex_array = make_vertex_array();
+
+			const UniformHandle handle_world      = shader.GetUniformHandle( "transform_world" );
+			const UniformHandle handle_view       = shader.GetUniformHandle( "transform_view" );
+			const UniformHandle handle_projection = shader.GetUniformHandle( "transform_projection" );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					for( auto& transform : transform_list )
+					{
+						vertex_array->Bind();
+						material.Bind();
+
+						material.SetMatrix( handle_world,	   transform.GetWorldMatrix() );
+						material.SetMatrix( handle_view,	   transform_view );
+						material.SetMatrix( handle_projection, transform_projection );
+
+						GLCALL( glDrawArrays( GL_TRIANGLES, 0, vertex_array->VertexCount() ) );
+					}
+				}
+			}, 1 );
+			results.push_back( { "Per-draw view & projection", milliseconds, per_frame_detail( milliseconds ) } );
+		}
+
+		/* After: view & projection in the shared Camera uniform block, uploaded once per frame. */
+		{
+			GLStub gl_stub( { { "transform_world",		GL_FLOAT_MAT4 },
+							  { "transform_view",		GL_FLOAT_MAT4, UniformBlock::Camera::NAME },
+							  { "transform_projection", GL_FLOAT_MAT4, UniformBlock::Camera::NAME } } );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			Material material( &shader );
+			const auto vertex_array = make_vertex_array();
+
+			UniformBuffer camera_uniform_buffer( sizeof( UniformBlock::Camera ) );
+			camera_uniform_buffer.BindToBindingPoint( ( GLuint )UniformBlock::Camera::BINDING_POINT );
+
+			std::vector< std::unique_ptr< Drawable > > drawable_list;
+			drawable_list.reserve( drawable_count );
+			for( auto& transform : transform_list )
+				drawable_list.push_back( std::make_unique< Drawable >( &material, &transform, vertex_array.get() ) );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					camera_uniform_buffer.Update( UniformBlock::Camera{ transform_view, transform_projection } );
+
+					for( auto& drawable : drawable_list )
+						drawable->Submit();
+				}
+			}, 1 );
+			results.push_back( { "Camera uniform buffer", milliseconds, per_frame_detail( milliseconds ) } );
+		}
+
+		return results;
+	}
+
+	ResultList MaterialSwitching()
+	{
+		constexpr std::size_t material_count = 100;
+		constexpr std::size_t draw_count     = 10'000;
+		constexpr std::size_t frame_count    = 10;
+
+		const char* parameter_names[ 4 ] = { "color_diffuse", "color_specular", "color_emissive", "uv_scale_offset" };
+
+		const auto per_frame_detail = []( const double milliseconds )
+		{
+			const auto& statistics = GLStub::GetStatistics();
+			return std::to_string( milliseconds * 1'000.0 / frame_count ) + " us/frame, " +
+				   std::to_string( double( statistics.call_count ) / ( frame_count * draw_count ) ).substr( 0, 4 ) + " GL calls/draw (" +
+				   std::to_string( statistics.uniform_call_count / frame_count ) + " uniform calls & " +
+				   std::to_string( statistics.buffer_upload_byte_count / frame_count ) + " bytes uploaded per frame)";
+		};
+
+		const auto make_stub_description = [ & ]( const std::string& block_name )
+		{
+			std::vector< GLStub::UniformDescription > description;
+			for( const auto parameter_name : parameter_names )
+				description.push_back( { parameter_name, GL_FLOAT_VEC4, block_name } );
+			return description;
+		};
+
+		const auto make_vertex_array = []()
+		{
+			const float vertices[ 9 ] = {};
+			VertexBuffer vertex_buffer( vertices, 3 );
+			VertexBufferLayout vertex_buffer_layout;
+			vertex_buffer_layout.Push< float >( 3 );
+			return std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout );
+		};
+
+		const auto make_materials = [ & ]( Shader& shader )
+		{
+			std::vector< std::unique_ptr< Material > > material_list;
+			for( std::size_t i = 0; i < material_count; i++ )
+			{
+				material_list.push_back( std::make_unique< Material >( &shader ) );
+				for( const auto parameter_name : parameter_names )
+					material_list.back()->SetVector( parameter_name, Vector4( float( i ), 0.0f, 0.0f, 1.0f ) );
+			}
+			return material_list;
+		};
+
+		ResultList results;
+
+		/* Before: parameters as regular uniforms, which have to be re-sent whenever a different Material of the same Shader is bound. */
+		{
+			GLStub gl_stub( make_stub_description( "" ) );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			const auto vertex_array  = make_vertex_array();
+			const auto material_list = make_materials( shader );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					for( std::size_t draw = 0; draw < draw_count; draw++ )
+					{
+						vertex_array->Bind();
+						material_list[ draw % material_count ]->Bind();
+
+						GLCALL( glDrawArrays( GL_TRIANGLES, 0, vertex_array->VertexCount() ) );
+					}
+				}
+			}, 1 );
+			results.push_back( { "Re-send uniforms on switch", milliseconds, per_frame_detail( milliseconds ) } );
+		}
+
+		/* After: parameters in the Material block; each Material uploads its own buffer only when changed. */
+		{
+			GLStub gl_stub( make_stub_description( UniformBlock::Material::NAME ) );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			const auto vertex_array  = make_vertex_array();
+			const auto material_list = make_materials( shader );
+
+			const UniformHandle handle_changing = shader.GetUniformHandle( parameter_names[ 0 ] );
+
+			for( bool change_parameter_every_frame : { false, true } )
+			{
+				/* Initial uploads. */
+				for( auto& material : material_list )
+					material->Bind();
+
+				GLStub::ResetStatistics();
+				const double milliseconds = Measure( [ & ]()
+				{
+					for( std::size_t frame = 0; frame < frame_count; frame++ )
+					{
+						if( change_parameter_every_frame )
+							for( auto& material : material_list )
+								material->SetVector( handle_changing, Vector4( float( frame ), 0.0f, 0.0f, 1.0f ) );
+
+						for( std::size_t draw = 0; draw < draw_count; draw++ )
+						{
+							vertex_array->Bind();
+							material_list[ draw % material_count ]->Bind();
+
+							GLCALL( glDrawArrays( GL_TRIANGLES, 0, vertex_array->VertexCount() ) );
+						}
+					}
+				}, 1 );
+				results.push_back( { change_parameter_every_frame ? "Material buffers, 1 change/frame" : "Material buffers", milliseconds, per_frame_detail( milliseconds ) } );
+			}
+		}
+
+		/* Regular uniforms are program state, shared by the Materials of a Shader: a Material's have to be sent again when it is bound after another one's,
+		 * & can not be sent right away while another Material is bound. */
+		{
+			GLStub gl_stub( { { "color_diffuse", GL_FLOAT_VEC4 } } );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			Material material_a( &shader ), material_b( &shader );
+
+			GLStub::ResetStatistics();
+			material_a.SetVector( "color_diffuse", Vector4( 1.0f, 0.0f, 0.0f, 1.0f ) );
+			material_b.SetVector( "color_diffuse", Vector4( 0.0f, 1.0f, 0.0f, 1.0f ) );
+			const bool deferred_until_bound = GLStub::GetStatistics().uniform_call_count == 0;
+
+			material_a.Bind();																// Sent: 1.
+			material_a.SetVector( "color_diffuse", Vector4( 0.0f, 0.0f, 1.0f, 1.0f ) );	// Sent right away: 2.
+			material_b.Bind();																// Sent: 3.
+			material_b.Bind();																// Already applied.
+			material_a.SetVector( "color_diffuse", Vector4( 1.0f, 0.0f, 1.0f, 1.0f ) );	// Deferred.
+			material_a.Bind();																// Sent: 4.
+			const bool re_sent_on_switch = GLStub::GetStatistics().uniform_call_count == 4;
+
+			results.push_back( { "Regular uniforms of 2 Materials", 0.0, deferred_until_bound && re_sent_on_switch ? "Re-sent on switch" : "NOT RE-SENT CORRECTLY!" } );
+		}
+
+		/* Bools inside the Material block: std140 stores them as 4 byte ints, so the blob (which is uploaded as is) has to as well. */
+		{
+			GLStub gl_stub( { { "is_lit", GL_BOOL, UniformBlock::Material::NAME }, { "channel_mask", GL_BOOL_VEC3, UniformBlock::Material::NAME } } );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			Material material( &shader );
+
+			material.SetBool( "is_lit", true ).SetVector( "channel_mask", Vector3B( true, false, true ) );
+
+			const bool is_std140 = shader.GetUniformInformation( "channel_mask" ).size == sizeof( Vector3I ) &&
+								   material.GetUniformValue< int >( shader.GetUniformInformation( "is_lit" ) ) == 1 && material.GetBool( "is_lit" ) &&
+								   material.GetVector< int, 3 >( "channel_mask" ) == Vector3I( 1, 0, 1 );
+			results.push_back( { "Bools in Material block", 0.0, is_std140 ? "Stored as 4 byte ints (std140)" : "NOT STD140!" } );
+		}
+
+		return results;
+	}
+
+	ResultList RenderQueueSorting()
+	{
+		constexpr std::size_t shader_count					= 8;
+		constexpr std::size_t material_count_per_shader	= 8;
+		constexpr std::size_t vertex_array_count			= 16;
+		constexpr std::size_t drawable_count				= 10'000;
+		constexpr std::size_t frame_count					= 10;
+		constexpr std::size_t key_count						= 100'000;
+
+		std::mt19937 generator( 42 );
+
+		ResultList results;
+
+		{
+			GLStub gl_stub( { { "transform_world", GL_FLOAT_MAT4 }, { "color_diffuse", GL_FLOAT_VEC4, UniformBlock::Material::NAME } } );
+
+			std::vector< std::unique_ptr< Shader > > shader_list;
+			std::vector< std::unique_ptr< Material > > material_list;
+			for( std::size_t i = 0; i < shader_count; i++ )
+			{
+				shader_list.push_back( std::make_unique< Shader >( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" ) );
+				for( std::size_t j = 0; j < material_count_per_shader; j++ )
+				{
+					material_list.push_back( std::make_unique< Material >( shader_list.back().get() ) );
+					material_list.back()->SetVector( "color_diffuse", Vector4( float( j ), 0.0f, 0.0f, 1.0f ) );
+					material_list.back()->Bind(); // Initial upload.
+				}
+			}
+
+			std::vector< std::unique_ptr< VertexArray > > vertex_array_list;
+			for( std::size_t i = 0; i < vertex_array_count; i++ )
+			{
+				const float vertices[ 9 ] = {};
+				VertexBuffer vertex_buffer( vertices, 3 );
+				VertexBufferLayout vertex_buffer_layout;
+				vertex_buffer_layout.Push< float >( 3 );
+				vertex_array_list.push_back( std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout ) );
+			}
+
+			std::uniform_int_distribution< std::size_t > distribution_material( 0, material_list.size() - 1 );
+			std::uniform_int_distribution< std::size_t > distribution_vertex_array( 0, vertex_array_count - 1 );
+			std::uniform_real_distribution< float > distribution_depth( 0.0f, 1.0f );
+
+			std::vector< Transform > transform_list;
+			std::vector< std::unique_ptr< Drawable > > drawable_list;
+			std::vector< float > depth_list;
+			transform_list.reserve( drawable_count ); // Drawables point into this; must not reallocate.
+			for( std::size_t i = 0; i < drawable_count; i++ )
+			{
+				depth_list.push_back( distribution_depth( generator ) );
+				transform_list.emplace_back( Vector3::One(), Vector3( 0.0f, 0.0f, -depth_list.back() ) );
+				drawable_list.push_back( std::make_unique< Drawable >( material_list[ distribution_material( generator ) ].get(), &transform_list.back(),
+																	   vertex_array_list[ distribution_vertex_array( generator ) ].get() ) );
+			}
+
+			auto& state_cache = StateCache::Instance();
+
+			const auto per_frame_detail = [ & ]( const double milliseconds )
+			{
+				const auto& statistics = state_cache.GetStatistics();
+				return std::to_string( milliseconds * 1'000.0 / frame_count ) + " us/frame, " +
+					   std::to_string( double( GLStub::GetStatistics().call_count ) / ( frame_count * drawable_count ) ).substr( 0, 4 ) + " GL calls/draw, " +
+					   std::to_string( statistics.StateChangeCount() / frame_count ) + " state changes/frame (" +
+					   std::to_string( statistics.program_change_count / frame_count ) + " program, " +
+					   std::to_string( statistics.uniform_buffer_change_count / frame_count ) + " uniform buffer, " +
+					   std::to_string( statistics.vertex_array_change_count / frame_count ) + " vertex array)";
+			};
+
+			GLStub::ResetStatistics();
+			state_cache.ResetStatistics();
+			const double milliseconds_unsorted = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+					for( auto& drawable : drawable_list )
+						drawable->Submit();
+			}, 1 );
+			results.push_back( { "Submission order", milliseconds_unsorted, per_frame_detail( milliseconds_unsorted ) } );
+
+			RenderQueue render_queue;
+
+			GLStub::ResetStatistics();
+			state_cache.ResetStatistics();
+			const double milliseconds_sorted = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					render_queue.Clear();
+					render_queue.Reserve( drawable_list.size() );
+					for( std::size_t i = 0; i < drawable_count; i++ )
+					{
+						const auto& drawable = *drawable_list[ i ];
+						render_queue.Push( RenderQueue::MakeKey( drawable.GetRenderPass(), drawable.GetShader()->ProgramID(), drawable.GetMaterial()->ID(),
+																 drawable.GetVertexArray()->ID(), depth_list[ i ] ),
+										   drawable_list[ i ].get() );
+					}
+
+					render_queue.Sort();
+
+					for( const auto& item : render_queue )
+						item.drawable->Submit();
+				}
+			}, 1 );
+			results.push_back( { "Sorted by RenderQueue keys", milliseconds_sorted, per_frame_detail( milliseconds_sorted ) } );
+		}
+
+		/* Sorting alone. Keys are built the same way, from 8 shaders, 64 materials, 16 vertex arrays & random depths. */
+		{
+			std::uniform_int_distribution< unsigned int > distribution_shader( 1, shader_count );
+			std::uniform_int_distribution< unsigned int > distribution_material( 1, shader_count * material_count_per_shader );
+			std::uniform_int_distribution< unsigned int > distribution_vertex_array( 1, vertex_array_count );
+			std::uniform_real_distribution< float > distribution_depth( 0.0f, 1.0f );
+
+			std::vector< RenderQueue::Item > item_list_source( key_count );
+			for( auto& item : item_list_source )
+				item = { RenderQueue::MakeKey( RenderPass::Opaque, distribution_shader( generator ), distribution_material( generator ),
+											   distribution_vertex_array( generator ), distribution_depth( generator ) ),
+						 nullptr };
+
+			std::vector< RenderQueue::Item > item_list, scratch_list;
+
+			const double milliseconds_std_sort = Measure( [ & ]()
+			{
+				item_list = item_list_source;
+				std::sort( item_list.begin(), item_list.end(), []( const auto& a, const auto& b ) { return a.key < b.key; } );
+			} );
+			DoNotOptimizeAway( item_list.front() );
+			results.push_back( { "std::sort", milliseconds_std_sort, "100K keys (copy included)" } );
+
+			const double milliseconds_radix_sort = Measure( [ & ]()
+			{
+				item_list = item_list_source;
+				Utility::RadixSort( item_list, scratch_list, []( const RenderQueue::Item& item ) { return item.key; } );
+			} );
+			DoNotOptimizeAway( item_list.front() );
+			results.push_back( { "Radix sort", milliseconds_radix_sort, "100K keys (copy included)" } );
+		}
+
+		return results;
+	}
+
+	ResultList StateCacheRedundancy()
+	{
+		constexpr std::size_t request_count = 1'000'000;
+
+		enum class RequestType { Program, VertexArray, Texture, ArrayBuffer, ElementArrayBuffer, UniformBuffer, UniformBufferBase, DepthTest, PolygonMode, Count };
+
+		struct Request
+		{
+			RequestType type;
+			GLuint index;	// Texture unit or uniform buffer binding point.
+			GLuint value;	// Object name, depth test on/off or polygon mode.
+		};
+
+		/* Roughly what a draw loop asks for: mostly binds of a handful of objects & rare render state changes. */
+		std::mt19937 generator( 42 );
+		std::uniform_int_distribution< int > distribution_type( 0, int( RequestType::Count ) - 1 );
+		std::uniform_int_distribution< GLuint > distribution_program( 1, 4 );
+		std::uniform_int_distribution< GLuint > distribution_object( 1, FakeGLState::OBJECT_COUNT - 1 );
+		std::uniform_int_distribution< GLuint > distribution_texture_unit( 0, 3 );
+		std::uniform_int_distribution< GLuint > distribution_binding_point( 0, 1 );
+		std::uniform_int_distribution< int > distribution_percentage( 0, 99 );
+
+		std::vector< Request > request_list( request_count );
+		for( auto& request : request_list )
+		{
+			request.type = RequestType( distribution_type( generator ) );
+			switch( request.type )
+			{
+				case RequestType::Program:			 request.value = distribution_program( generator );											 break;
+				case RequestType::Texture:			 request.index = distribution_texture_unit( generator ); request.value = distribution_object( generator );	 break;
+				case RequestType::UniformBufferBase: request.index = distribution_binding_point( generator ); request.value = distribution_object( generator ); break;
+				case RequestType::DepthTest:		 request.value = distribution_percentage( generator ) < 95;									 break;
+				case RequestType::PolygonMode:		 request.value = distribution_percentage( generator ) < 95 ? GL_FILL : GL_LINE;				 break;
+				default:							 request.value = distribution_object( generator );											 break;
+			}
+		}
+
+		const auto issue = []( StateCache& state_cache, const Request& request )
+		{
+			switch( request.type )
+			{
+				case RequestType::Program:				state_cache.UseProgram( request.value );										break;
+				case RequestType::VertexArray:			state_cache.BindVertexArray( request.value );									break;
+				case RequestType::Texture:				state_cache.BindTexture( GL_TEXTURE0 + request.index, GL_TEXTURE_2D, request.value ); break;
+				case RequestType::ArrayBuffer:			state_cache.BindBuffer( GL_ARRAY_BUFFER, request.value );						break;
+				case RequestType::ElementArrayBuffer:	state_cache.BindBuffer( GL_ELEMENT_ARRAY_BUFFER, request.value );				break;
+				case RequestType::UniformBuffer:		state_cache.BindBuffer( GL_UNIFORM_BUFFER, request.value );						break;
+				case RequestType::UniformBufferBase:	state_cache.BindUniformBuffer( request.index, request.value );					break;
+				case RequestType::DepthTest:			state_cache.SetDepthTest( request.value );										break;
+				case RequestType::PolygonMode:			state_cache.SetPolygonMode( request.value );									break;
+			}
+		};
+
+		const auto issue_directly = []( const Request& request )
+		{
+			const auto& gl = fake_gl_function_table;
+			switch( request.type )
+			{
+				case RequestType::Program:				gl.UseProgram( request.value );												break;
+				case RequestType::VertexArray:			gl.BindVertexArray( request.value );										break;
+				case RequestType::Texture:				gl.ActiveTexture( GL_TEXTURE0 + request.index ); gl.BindTexture( GL_TEXTURE_2D, request.value ); break;
+				case RequestType::ArrayBuffer:			gl.BindBuffer( GL_ARRAY_BUFFER, request.value );							break;
+				case RequestType::ElementArrayBuffer:	gl.BindBuffer( GL_ELEMENT_ARRAY_BUFFER, request.value );					break;
+				case RequestType::UniformBuffer:		gl.BindBuffer( GL_UNIFORM_BUFFER, request.value );							break;
+				case RequestType::UniformBufferBase:	gl.BindBufferBase( GL_UNIFORM_BUFFER, request.index, request.value );		break;
+				case RequestType::DepthTest:			request.value ? gl.Enable( GL_DEPTH_TEST ) : gl.Disable( GL_DEPTH_TEST );	break;
+				case RequestType::PolygonMode:			gl.PolygonMode( GL_FRONT_AND_BACK, request.value );							break;
+			}
+		};
+
+		/* Whether the modeled GL state reflects the given request, i.e. whether skipping (or issuing) it left GL in the requested state. */
+		const auto is_in_requested_state = []( const Request& request )
+		{
+			const auto& state = fake_gl_state;
+			switch( request.type )
+			{
+				case RequestType::Program:				return state.program == request.value;
+				case RequestType::VertexArray:			return state.vertex_array == request.value;
+				case RequestType::Texture:				return state.texture_binding_list[ request.index ] == request.value;
+				case RequestType::ArrayBuffer:			return state.array_buffer == request.value;
+				case RequestType::ElementArrayBuffer:	return state.element_array_buffer_per_vertex_array[ state.vertex_array ] == request.value;
+				case RequestType::UniformBuffer:		return state.uniform_buffer == request.value;
+				case RequestType::UniformBufferBase:	return state.uniform_buffer_binding_list[ request.index ] == request.value;
+				case RequestType::DepthTest:			return state.depth_test == bool( request.value );
+				case RequestType::PolygonMode:			return state.polygon_mode == request.value;
+				default:								return false;
+			}
+		};
+
+		ResultList results;
+
+		fake_gl_state = {};
+		const double milliseconds_direct = Measure( [ & ]()
+		{
+			for( const auto& request : request_list )
+				issue_directly( request );
+		}, 1 );
+		results.push_back( { "Direct GL calls", milliseconds_direct,
+							 std::to_string( request_count / 1'000 ) + "K requests -> " + std::to_string( fake_gl_state.call_count ) + " GL calls" } );
+
+		{
+			fake_gl_state = {};
+			StateCache state_cache( fake_gl_function_table );
+
+			const double milliseconds_cached = Measure( [ & ]()
+			{
+				for( const auto& request : request_list )
+					issue( state_cache, request );
+			}, 1 );
+
+			const auto& statistics = state_cache.GetStatistics();
+			results.push_back( { "StateCache", milliseconds_cached,
+								 std::to_string( request_count / 1'000 ) + "K requests -> " + std::to_string( fake_gl_state.call_count ) + " GL calls (" +
+								 std::to_string( statistics.StateChangeCount() ) + " state changes, " + std::to_string( statistics.redundant_bind_count ) + " skipped)" } );
+		}
+
+		/* Verification pass (untimed): after every request, GL must be in the requested state, whether the call was issued or skipped. */
+		{
+			fake_gl_state = {};
+			StateCache state_cache( fake_gl_function_table );
+
+			std::size_t mismatch_count = 0;
+			for( const auto& request : request_list )
+			{
+				issue( state_cache, request );
+				mismatch_count += !is_in_requested_state( request );
+			}
+
+			results.push_back( { "StateCache, verified", 0.0, std::to_string( mismatch_count ) + " requests left GL in a different state than requested" } );
+		}
+
+		return results;
+	}
+
+	ResultList GLCallOverhead()
+	{
+		constexpr std::size_t call_count = 1'000'000;
+
+		GLStub gl_stub( {} );
+
+		const auto per_call_detail = []( const double milliseconds )
+		{
+			return std::to_string( milliseconds * 1'000'000.0 / call_count ) + " ns/call, " +
+				   std::to_string( double( GLStub::GetStatistics().error_query_count ) / call_count ).substr( 0, 4 ) + " glGetError()/call";
+		};
+
+		ResultList results;
+
+		GLStub::ResetStatistics();
+		const double milliseconds_raw = Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < call_count; i++ )
+				glUniform1i( 0, GLint( i ) );
+		}, 1 );
+		results.push_back( { "Raw call", milliseconds_raw, per_call_detail( milliseconds_raw ) } );
+
+		const GLErrorCheckMode mode_original = GetGLErrorCheckMode();
+		for( const auto mode : { GLErrorCheckMode::Disabled, GLErrorCheckMode::Synchronous } )
+		{
+			/* Synchronous checking is compiled out of GLCALL in release builds. */
+			if( SetGLErrorCheckMode( mode ) != mode )
+				continue;
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t i = 0; i < call_count; i++ )
+					GLCALL( glUniform1i( 0, GLint( i ) ) );
+			}, 1 );
+			results.push_back( { std::string( "GLCALL, mode: " ) + ( mode == GLErrorCheckMode::Synchronous ? "Synchronous" : "Disabled" ),
+								 milliseconds, per_call_detail( milliseconds ) } );
+		}
+		SetGLErrorCheckMode( mode_original );
+
+		GLStub::ResetStatistics();
+		const double milliseconds_synchronous = Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < call_count; i++ )
+				GLCALL_SYNCHRONOUS( glUniform1i( 0, GLint( i ) ) );
+		}, 1 );
+		results.push_back( { "GLCALL_SYNCHRONOUS", milliseconds_synchronous, per_call_detail( milliseconds_synchronous ) } );
+
+		return results;
+	}
+
+	ResultList Instancing()
+	{
+		constexpr std::size_t drawable_count = 100'000;
+		constexpr std::size_t frame_count    = 10;
+
+		const auto per_frame_detail = []( const double milliseconds )
+		{
+			const auto& statistics = GLStub::GetStatistics();
+			return std::to_string( milliseconds * 1'000.0 / frame_count ) + " us/frame, " +
+				   std::to_string( statistics.draw_call_count / frame_count ) + " draw calls & " +
+				   std::to_string( statistics.call_count / frame_count ) + " GL calls per frame, " +
+				   std::to_string( statistics.buffer_upload_byte_count / frame_count ) + " bytes uploaded per frame";
+		};
+
+		const auto make_vertex_array = []()
+		{
+			const float vertices[ 9 ] = {};
+			VertexBuffer vertex_buffer( vertices, 3 );
+			VertexBufferLayout vertex_buffer_layout;
+			vertex_buffer_layout.Push< float >( 3 );
+			return std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout );
+		};
+
+		std::vector< Transform > transform_list;
+		transform_list.reserve( drawable_count ); // Drawables point into this; must not reallocate.
+		for( std::size_t i = 0; i < drawable_count; i++ )
+			transform_list.emplace_back( Vector3::One(), Vector3( float( i % 100 ), float( i / 100 % 10 ), float( i / 1000 ) ) );
+
+		ResultList results;
+
+		/* Before: world matrix as a uniform, one draw call per Drawable. */
+		{
+			GLStub gl_stub( { { "transform_world", GL_FLOAT_MAT4 } } );
+
+			Shader shader( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
+			Material material( &shader );
+			const auto vertex_array = make_vertex_array();
+
+			std::vector< Drawable > drawable_list;
+			drawable_list.reserve( drawable_count );
+			for( auto& transform : transform_list )
+				drawable_list.emplace_back( &material, &transform, vertex_array.get() );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+					for( auto& drawable : drawable_list )
+						drawable.Submit();
+			}, 1 );
+			results.push_back( { "Draw call per Drawable", milliseconds, per_frame_detail( milliseconds ) } );
+		}
+
+		/* After: world matrices as a per-instance attribute, written straight into a StreamingBuffer; one instanced draw call for all. */
+		{
+			GLStub gl_stub( {}, { "transform_world" } );
+
+			Shader shader( "Source/Asset/Shader/textured_mix_instanced.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix (Instanced)" );
+			Material material( &shader );
+			const auto vertex_array = make_vertex_array();
+
+			std::vector< Drawable > drawable_list;
+			drawable_list.reserve( drawable_count );
+			for( auto& transform : transform_list )
+				drawable_list.emplace_back( &material, &transform, vertex_array.get() );
+
+			StreamingBuffer instance_buffer( GL_ARRAY_BUFFER, Renderer::INSTANCE_BUFFER_INITIAL_CAPACITY * sizeof( Matrix4x4 ) );
+			VertexBufferLayout instance_buffer_layout;
+			for( int row = 0; row < 4; row++ )
+				instance_buffer_layout.Push< float >( 4, 1 );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					instance_buffer.BeginFrame();
+
+					const unsigned int size_needed = ( unsigned int )( drawable_list.size() * sizeof( Matrix4x4 ) );
+					unsigned int capacity = instance_buffer.FrameSize();
+					while( capacity < size_needed )
+						capacity *= 2;
+
+					instance_buffer.Reserve( capacity );
+
+					const auto allocation = instance_buffer.Allocate( size_needed );
+					Matrix4x4* instance_transforms = static_cast< Matrix4x4* >( allocation.data );
+					for( const auto& drawable : drawable_list )
+						*instance_transforms++ = drawable.transform->GetWorldMatrix();
+					instance_buffer.Commit( allocation );
+
+					drawable_list.front().SubmitInstanced( instance_buffer.ID(), instance_buffer.Generation(), instance_buffer_layout, allocation.offset,
+														   ( unsigned int )drawable_list.size() );
+
+					instance_buffer.EndFrame();
+				}
+			}, 1 );
+			results.push_back( { "Single instanced draw call", milliseconds, per_frame_detail( milliseconds ) } );
+
+			/* A re-created instance buffer (PersistentMapped Reserve()) may get a name GL handed out before; the stub never reuses names, so simulate that by
+			 * attaching the same name with the next generation. */
+			const GLuint instance_buffer_id = instance_buffer.ID();
+			const unsigned int instance_buffer_generation = instance_buffer.Generation();
+			const GLint first_location = shader.InstanceTransformAttributeLocation();
+
+			GLStub::ResetStatistics();
+			vertex_array->AttachInstanceBuffer( instance_buffer_id, instance_buffer_generation, instance_buffer_layout, first_location, 0 );
+			const std::size_t call_count_same = GLStub::GetStatistics().call_count;
+			vertex_array->AttachInstanceBuffer( instance_buffer_id, instance_buffer_generation + 1, instance_buffer_layout, first_location, 0 );
+			const bool is_reattached = GLStub::GetStatistics().call_count > call_count_same;
+
+			results.push_back( { "Instance buffer name reused", 0.0, is_reattached ? "Re-attached (new generation)" : "NOT RE-ATTACHED!" } );
+		}
+
+		return results;
+	}
+
+	ResultList StreamingUploads()
+	{
+		constexpr std::size_t frame_count = 1'000;
+		constexpr std::size_t chunk_count = 64;
+		constexpr unsigned int chunk_size = 1024;
+
+		std::vector< std::byte > chunk_data( chunk_size, std::byte( 42 ) );
+
+		GLStub gl_stub( {} );
+
+		const auto per_frame_detail = [ & ]( const double milliseconds, const StreamingBuffer::Statistics* streaming_statistics = nullptr )
+		{
+			const auto& statistics = GLStub::GetStatistics();
+			std::string detail = std::to_string( milliseconds * 1'000.0 / frame_count ) + " us/frame, " +
+								 std::to_string( statistics.call_count / frame_count ) + " GL calls per frame";
+			if( streaming_statistics )
+				detail += ", " + std::to_string( streaming_statistics->orphan_count ) + " orphans & " +
+						  std::to_string( streaming_statistics->stall_count ) + " stalls in " + std::to_string( frame_count ) + " frames";
+			return detail;
+		};
+
+		ResultList results;
+
+		/* Before: orphaning once per frame, then one glBufferSubData() per chunk; every chunk is a separate driver call & copy. */
+		{
+			VertexBuffer buffer( chunk_count * chunk_size, GL_STREAM_DRAW );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					buffer.Orphan( chunk_count * chunk_size );
+					for( std::size_t chunk = 0; chunk < chunk_count; chunk++ )
+						buffer.Update( chunk_data.data(), chunk_size, ( unsigned int )( chunk * chunk_size ) );
+				}
+			}, 1 );
+			results.push_back( { "Orphan + glBufferSubData", milliseconds, per_frame_detail( milliseconds ) } );
+
+			buffer.CleanUp();
+		}
+
+		/* After: a StreamingBuffer; PersistentMapped needs glBufferStorage (GL 4.4), which the stub does not provide, so this is the Orphaning (GL 3.3) path.
+		 * With the GPU 2 frames behind, the 3 regions are never contended; at 3 frames behind, the buffer is orphaned every 3rd frame (orphaning drops all fences). */
+		for( const std::size_t fence_latency : { 2, 3 } )
+		{
+			StreamingBuffer buffer( GL_ARRAY_BUFFER, chunk_count * chunk_size );
+			GLStub::SetFenceLatency( fence_latency );
+
+			GLStub::ResetStatistics();
+			const double milliseconds = Measure( [ & ]()
+			{
+				for( std::size_t frame = 0; frame < frame_count; frame++ )
+				{
+					buffer.BeginFrame();
+					for( std::size_t chunk = 0; chunk < chunk_count; chunk++ )
+					{
+						const auto allocation = buffer.Allocate( chunk_size );
+						std::memcpy( allocation.data, chunk_data.data(), chunk_size );
+						buffer.Commit( allocation );
+					}
+					buffer.EndFrame();
+				}
+			}, 1 );
+			results.push_back( { "StreamingBuffer, GPU " + std::to_string( fence_latency ) + " frames behind", milliseconds, per_frame_detail( milliseconds, &buffer.GetStatistics() ) } );
+		}
+
+		return results;
+	}
+}
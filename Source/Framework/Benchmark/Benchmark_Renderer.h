@@ -0,0 +1,45 @@
+#pragma once
+
+// Framework Includes.
+#include "Benchmark/Benchmark.h"
+
+namespace Framework::Benchmark
+{
+	/* Per-draw CPU cost of setting the 3 transform uniforms through std::string lookups vs. resolved UniformHandles, over 100K draws.
+	 * Runs against the recording GL stub, so only the framework's own overhead is measured. Also checks that setters ignore unknown uniforms. */
+	ResultList UniformSetters();
+
+	/* Per-frame CPU cost & GL call counts of uploading view & projection matrices per Drawable vs. once per frame via the shared Camera uniform buffer,
+	 * for 1000 Drawables over 100 frames. Runs against the recording GL stub. */
+	ResultList CameraUniforms();
+
+	/* Cost of switching between 100 Materials sharing a Shader (4 vec4 parameters each) on every draw; 10K draws per frame.
+	 * Compares re-sending every parameter via glUniform* on each switch with binding each Material's uniform buffer, with & without per-frame parameter changes.
+	 * Also checks that Materials re-send their regular uniforms when switched to & that bools in the Material block are stored as 4 byte ints, as std140
+	 * requires. Runs against the recording GL stub. */
+	ResultList MaterialSwitching();
+
+	/* Per-frame cost & GL state changes of drawing 10K Drawables spread over 8 Shaders, 64 Materials & 16 vertex arrays in submission order vs. sorted by
+	 * RenderQueue keys (building the keys & sorting included), plus the cost of sorting 100K keys via radix sort vs. std::sort.
+	 * Runs against the recording GL stub; redundant binds are skipped by the StateCache in all cases. */
+	ResultList RenderQueueSorting();
+
+	/* Replays 1M random bind & render state requests (4 programs, 8 vertex arrays, 8 textures on 4 units, 8 vertex/index/uniform buffers, depth test & polygon mode)
+	 * through a StateCache backed by a fake GL function table, which models the resulting GL state. Reports how many requests reach GL & verifies after every request
+	 * that the modeled state matches what was requested. Compared with issuing every request directly. Needs no GL context. */
+	ResultList StateCacheRedundancy();
+
+	/* Per-call overhead of GLCALL over 1M glUniform1i calls: raw call vs. GLCALL in the current build configuration & GLErrorCheckMode vs. synchronous checking.
+	 * Runs against the recording GL stub, where glGetError() is nearly free; on a real driver each query is a round-trip that may also stall the pipeline. */
+	ResultList GLCallOverhead();
+
+	/* Per-frame cost of drawing 100K Drawables sharing a Material & a VertexArray: one draw call per Drawable (world matrix as a uniform) vs.
+	 * a single instanced draw call (world matrices gathered & streamed into an orphaned instance buffer, as Renderer::DrawFrame() does).
+	 * Runs against the recording GL stub, so driver-side per-draw costs (usually the dominant ones) are not included.
+	 * Also checks that a vertex array re-attaches an instance buffer whose name was reused by a newer buffer. */
+	ResultList Instancing();
+
+	/* Per-frame cost of streaming 64 1 KiB chunks (e.g., dynamic vertices or uniform block chunks): orphaning a buffer & glBufferSubData() per chunk vs.
+	 * sub-allocating from a StreamingBuffer, with the (simulated) GPU 2 & 3 frames behind. Runs against the recording GL stub. */
+	ResultList StreamingUploads();
+}
\ No newline at end of file
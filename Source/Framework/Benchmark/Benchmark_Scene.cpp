@@ -0,0 +1,187 @@
+// Framework Includes.
+#include "Benchmark/Benchmark_Scene.h"
+
+#include "Math/Math.h"
+#include "Math/Matrix.h"
+
+#include "Scene/Transform.h"
+#include "Scene/TransformSystem.h"
+
+// std Includes.
+#include <random>
+
+namespace Framework::Benchmark
+{
+	ResultList TransformUpdate()
+	{
+		constexpr std::size_t count = 50'000;
+
+		std::mt19937 generator( 42 );
+		std::uniform_real_distribution< float > distribution( -10.0f, 10.0f );
+		std::uniform_real_distribution< float > distribution_scale( 0.1f, 2.0f );
+
+		struct TransformData
+		{
+			Vector3 scale;
+			Quaternion rotation;
+			Vector3 translation;
+		};
+
+		std::vector< TransformData > transform_data_list( count );
+		std::vector< Matrix4x4 > final_matrix_list( count );
+
+		TransformSystem transform_system;
+		std::vector< TransformSystem::Index > index_list( count );
+
+		for( std::size_t i = 0; i < count; i++ )
+		{
+			auto& data = transform_data_list[ i ];
+			data.scale       = Vector3( distribution_scale( generator ), distribution_scale( generator ), distribution_scale( generator ) );
+			data.rotation    = Quaternion( Radians( distribution( generator ) ), Vector3( distribution( generator ), distribution( generator ), distribution( generator ) ).Normalized() );
+			data.translation = Vector3( distribution( generator ), distribution( generator ), distribution( generator ) );
+
+			index_list[ i ] = transform_system.Allocate( data.scale, data.rotation, data.translation );
+		}
+
+		ResultList results;
+
+		results.push_back( { "Per-object rebuild, all dirty", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+			{
+				const auto& data = transform_data_list[ i ];
+				final_matrix_list[ i ] = Matrix4x4( Vector4( data.scale.X(), data.scale.Y(), data.scale.Z(), 1.0f ) )
+										 * Matrix4x4( Math::QuaternionToMatrix3x3( data.rotation ), data.translation );
+			}
+		} ), "50K transforms" } );
+		DoNotOptimizeAway( final_matrix_list.back() );
+
+		results.push_back( { "TransformSystem bulk rebuild, all dirty", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i++ )
+				transform_system.SetTranslation( index_list[ i ], transform_data_list[ i ].translation );
+
+			transform_system.UpdateDirtyFinalMatrices();
+		} ), "50K transforms" } );
+		DoNotOptimizeAway( transform_system.GetFinalMatrix( index_list.back() ) );
+
+		results.push_back( { "TransformSystem bulk rebuild, 10% dirty", Measure( [ & ]()
+		{
+			for( std::size_t i = 0; i < count; i += 10 )
+				transform_system.SetTranslation( index_list[ i ], transform_data_list[ i ].translation );
+
+			transform_system.UpdateDirtyFinalMatrices();
+		} ), "50K transforms, every 10th modified" } );
+		DoNotOptimizeAway( transform_system.GetFinalMatrix( index_list.back() ) );
+
+		/* Verify that the bulk rebuild agrees with the per-object reference. */
+		for( std::size_t i = 0; i < count; i++ )
+			transform_system.SetTranslation( index_list[ i ], transform_data_list[ i ].translation );
+		transform_system.UpdateDirtyFinalMatrices();
+
+		bool results_match = true;
+		for( std::size_t i = 0; i < count; i += 97 )
+			results_match &= transform_system.GetFinalMatrix( index_list[ i ] ) == final_matrix_list[ i ];
+
+		results.push_back( { "Bulk vs. per-object results", 0.0, results_match ? "Match (within epsilon)" : "MISMATCH!" } );
+
+		return results;
+	}
+
+	ResultList TransformHierarchyUpdate()
+	{
+		constexpr std::size_t count        = 100'000;
+		constexpr std::size_t moving_count = count / 100;
+
+		std::mt19937 generator( 42 );
+		std::uniform_real_distribution< float > distribution( -10.0f, 10.0f );
+
+		TransformSystem transform_system;
+		std::vector< TransformSystem::Index > index_list( count );
+
+		/* Random tree: each node is parented to a random, previously created node. */
+		for( std::size_t i = 0; i < count; i++ )
+		{
+			index_list[ i ] = transform_system.Allocate( Vector3( 1.0f, 1.0f, 1.0f ),
+														 Quaternion( Radians( distribution( generator ) ), Vector3( 0.0f, 1.0f, 0.0f ) ),
+														 Vector3( distribution( generator ), distribution( generator ), distribution( generator ) ) );
+			if( i > 0 )
+				transform_system.SetParent( index_list[ i ], index_list[ std::uniform_int_distribution< std::size_t >( 0, i - 1 )( generator ) ] );
+		}
+
+		transform_system.UpdateWorldMatrices();
+
+		std::uniform_int_distribution< std::size_t > distribution_node( 0, count - 1 );
+		const auto move_random_nodes = [ & ]()
+		{
+			for( std::size_t i = 0; i < moving_count; i++ )
+			{
+				const auto index = index_list[ distribution_node( generator ) ];
+				transform_system.SetTranslation( index, transform_system.GetTranslation( index ) + Vector3( 0.1f, 0.0f, 0.0f ) );
+			}
+		};
+
+		ResultList results;
+
+		results.push_back( { "Full rebuild", Measure( [ & ]()
+		{
+			move_random_nodes();
+			transform_system.RebuildAllWorldMatrices();
+		} ), "100K nodes, 1% moving" } );
+		DoNotOptimizeAway( transform_system.GetWorldMatrix( index_list.back() ) );
+
+		results.push_back( { "Incremental propagation", Measure( [ & ]()
+		{
+			move_random_nodes();
+			transform_system.UpdateWorldMatrices();
+		} ), "100K nodes, 1% moving" } );
+		DoNotOptimizeAway( transform_system.GetWorldMatrix( index_list.back() ) );
+
+		/* Verify that the incremental path ends up with the same matrices as a full rebuild. */
+		move_random_nodes();
+		transform_system.UpdateWorldMatrices();
+
+		std::vector< Matrix4x4 > world_matrices_incremental;
+		for( std::size_t i = 0; i < count; i += 97 )
+			world_matrices_incremental.push_back( transform_system.GetWorldMatrix( index_list[ i ] ) );
+
+		transform_system.RebuildAllWorldMatrices();
+
+		bool results_match = true;
+		for( std::size_t i = 0, j = 0; i < count; i += 97, j++ )
+			results_match &= transform_system.GetWorldMatrix( index_list[ i ] ) == world_matrices_incremental[ j ];
+
+		results.push_back( { "Incremental vs. full rebuild results", 0.0, results_match ? "Match (within epsilon)" : "MISMATCH!" } );
+
+		/* Freeing in creation order frees every parent before its children, so each Free() has to detach children. */
+		results.push_back( { "Free all, parents first", Measure( [ & ]()
+		{
+			for( const auto index : index_list )
+				transform_system.Free( index );
+		}, 1 ), "100K nodes" } );
+
+		results.push_back( { "Freed transforms", 0.0, transform_system.Count() == 0 ? "All freed" : "LEAK!" } );
+
+		/* Parents are moved to new storage each time the vector reallocates; their children must stay attached. */
+		{
+			constexpr std::size_t parent_count = 100;
+
+			std::vector< Transform > child_list( parent_count );
+			std::vector< Transform > parent_list;
+			for( std::size_t i = 0; i < parent_count; i++ )
+			{
+				parent_list.emplace_back();
+				child_list[ i ].SetParent( &parent_list.back() );
+			}
+
+			bool children_attached = true;
+			for( std::size_t i = 0; i < parent_count; i++ )
+				children_attached &= child_list[ i ].HasParent() &&
+									 TransformSystem::Instance().GetParent( child_list[ i ].GetIndex() ) == parent_list[ i ].GetIndex();
+
+			results.push_back( { "Children of moved parents", 0.0, children_attached ? "Attached" : "ORPHANED!" } );
+		}
+
+		return results;
+	}
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+// Framework Includes.
+#include "Benchmark/Benchmark.h"
+
+namespace Framework::Benchmark
+{
+	/* Compares per-object final matrix rebuilds (the previous lazy Transform approach) against the bulk TransformSystem rebuild, over 50K transforms. */
+	ResultList TransformUpdate();
+
+	/* Compares the incremental world matrix propagation against a full rebuild, over a 100K-node hierarchy with 1% of the nodes moving per frame.
+	 * Also times tearing the hierarchy down parents first & checks that Transform handles moved by a growing std::vector keep their children. */
+	ResultList TransformHierarchyUpdate();
+}
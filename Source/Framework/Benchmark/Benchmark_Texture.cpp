@@ -0,0 +1,697 @@
+// Framework Includes.
+#include "Benchmark/Benchmark_Texture.h"
+#include "Benchmark/GLStub.h"
+
+#include "Renderer/AsyncTextureLoader.h"
+#include "Renderer/MipmapGenerator.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/Texture.h"
+#include "Renderer/TextureAtlas.h"
+#include "Renderer/TextureCache.h"
+#include "Renderer/TextureCompression.h"
+#include "Renderer/TextureFile.h"
+
+#include "Math/SIMD.h"
+
+#include "Utility/ThreadPool.h"
+
+// Vendor Includes.
+#include "Vendor/stb/stb_image.h"
+
+// std Includes.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Framework::Benchmark
+{
+	namespace
+	{
+		constexpr int COPY_COUNT = 8;
+
+		std::vector< std::string > TextureFilePathList()
+		{
+			std::vector< std::string > file_path_list;
+			for( int i = 0; i < COPY_COUNT; i++ )
+				for( const char* file_path : { "Asset/Texture/container.jpg", "Asset/Texture/awesomeface.png", "Asset/Texture/test_tex_cube.png" } )
+					file_path_list.push_back( file_path );
+
+			return file_path_list;
+		}
+
+		/* Returns the decoded byte count; 0 if the image could not be read. */
+		std::size_t Decode( const std::string& file_path )
+		{
+			int width, height, channels_in_file;
+			stbi_uc* pixels = stbi_load( file_path.c_str(), &width, &height, &channels_in_file, 4 );
+			const std::size_t byte_count = pixels ? std::size_t( width ) * height * 4 : 0;
+			stbi_image_free( pixels );
+			return byte_count;
+		}
+
+		std::string MegaBytes( const std::size_t byte_count )
+		{
+			return std::to_string( double( byte_count ) / ( 1024.0 * 1024.0 ) ).substr( 0, 5 ) + " MB";
+		}
+
+		struct Image
+		{
+			int width;
+			int height;
+			std::vector< unsigned char > pixels;
+		};
+
+		/* RGBA8, bottom row first (as Texture uploads them). */
+		std::vector< Image > LoadTestImages()
+		{
+			stbi_set_flip_vertically_on_load( 1 );
+
+			std::vector< Image > image_list;
+			for( const char* file_path : { "Asset/Texture/container.jpg", "Asset/Texture/awesomeface.png", "Asset/Texture/test_tex_cube.png" } )
+			{
+				int width, height, channels_in_file;
+				if( stbi_uc* pixels = stbi_load( file_path, &width, &height, &channels_in_file, 4 ) )
+				{
+					image_list.push_back( { width, height, std::vector< unsigned char >( pixels, pixels + std::size_t( width ) * height * 4 ) } );
+					stbi_image_free( pixels );
+				}
+			}
+
+			return image_list;
+		}
+
+		float SRGBToLinear( const unsigned char value )
+		{
+			const float srgb = value / 255.0f;
+			return srgb <= 0.04045f ? srgb / 12.92f : std::pow( ( srgb + 0.055f ) / 1.055f, 2.4f );
+		}
+
+		/* Of the color channels, in linear space; i.e., the light the level actually emits. */
+		double AverageLinearBrightness( const MipmapGenerator::Level& level )
+		{
+			double sum = 0.0;
+			for( std::size_t i = 0; i < level.pixels.size(); i += 4 )
+				sum += SRGBToLinear( level.pixels[ i ] ) + SRGBToLinear( level.pixels[ i + 1 ] ) + SRGBToLinear( level.pixels[ i + 2 ] );
+
+			return sum / ( 3.0 * level.width * level.height );
+		}
+
+		/* Fraction of texels that pass an alpha test against reference. */
+		double AlphaCoverage( const MipmapGenerator::Level& level, const float reference )
+		{
+			std::size_t count = 0;
+			for( std::size_t i = 3; i < level.pixels.size(); i += 4 )
+				count += level.pixels[ i ] / 255.0f > reference;
+
+			return double( count ) / ( std::size_t( level.width ) * level.height );
+		}
+
+		std::string Percent( const double fraction )
+		{
+			return std::to_string( fraction * 100.0 ).substr( 0, 5 ) + "%";
+		}
+
+		/* What entering one of the textured tests amounts to: a fresh loader (Test owns one), the test's textures loaded & uploaded until all are in,
+		 * then everything released again on leaving. Returns the time until all textures were loaded. */
+		double EnterAndLeaveTest( TextureCache* texture_cache )
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			AsyncTextureLoader texture_loader( AsyncTextureLoader::DEFAULT_UPLOAD_BUDGET, Utility::ThreadPool::Default(), texture_cache );
+
+			/* The cube test's texture is requested twice, as by two materials sharing it. */
+			const std::shared_ptr< Texture > texture_list[] =
+			{
+				texture_loader.Load( "Asset/Texture/container.jpg",		GL_RGB ),
+				texture_loader.Load( "Asset/Texture/awesomeface.png",	GL_RGBA ),
+				texture_loader.Load( "Asset/Texture/test_tex_cube.png", GL_RGBA ),
+				texture_loader.Load( "Asset/Texture/test_tex_cube.png", GL_RGBA )
+			};
+
+			while( !texture_loader.IsIdle() )
+			{
+				texture_loader.Update();
+				std::this_thread::yield();
+			}
+
+			return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+		}
+	}
+
+	ResultList TextureLoading()
+	{
+		const auto file_path_list = TextureFilePathList();
+
+		ResultList results;
+
+		/* Decoding only: */
+		{
+			std::size_t byte_count = 0;
+			const double milliseconds = Measure( [ & ]()
+			{
+				byte_count = 0;
+				for( const auto& file_path : file_path_list )
+					byte_count += Decode( file_path );
+			} );
+
+			results.push_back( { "Decode on the calling thread", milliseconds,
+								 std::to_string( file_path_list.size() ) + " images, " + MegaBytes( byte_count ) + " decoded" } );
+		}
+
+		const unsigned int hardware_thread_count = std::max( std::thread::hardware_concurrency(), 1u );
+		for( const unsigned int worker_count : { 1u, 3u, 7u } )
+		{
+			/* More workers than hardware threads would only measure the OS scheduler. */
+			if( worker_count != 1 && worker_count >= hardware_thread_count )
+				continue;
+
+			Utility::ThreadPool thread_pool( worker_count );
+
+			std::size_t byte_count = 0;
+			const double milliseconds = Measure( [ & ]()
+			{
+				std::vector< std::future< std::size_t > > future_list;
+				for( const auto& file_path : file_path_list )
+					future_list.push_back( thread_pool.Enqueue( [ &file_path ]() { return Decode( file_path ); } ) );
+
+				byte_count = 0;
+				for( auto& future : future_list )
+					byte_count += future.get();
+			} );
+
+			results.push_back( { "Decode on " + std::to_string( worker_count ) + " worker(s)", milliseconds,
+								 std::to_string( file_path_list.size() ) + " images, " + MegaBytes( byte_count ) + " decoded; render thread free meanwhile" } );
+		}
+
+		/* Uploading: */
+		GLStub gl_stub( {} );
+
+		{
+			std::size_t byte_count = 0;
+			const double milliseconds = Measure( [ & ]()
+			{
+				GLStub::ResetStatistics();
+
+				std::vector< std::unique_ptr< Texture > > texture_list;
+				for( const auto& file_path : file_path_list )
+					texture_list.push_back( std::make_unique< Texture >( file_path.c_str(), GL_RGBA ) );
+
+				byte_count = GLStub::GetStatistics().texture_upload_byte_count;
+			} );
+
+			results.push_back( { "Texture (synchronous): 1 frame", milliseconds, "Decode & upload of " + MegaBytes( byte_count ) + " block a single frame" } );
+		}
+
+		{
+			constexpr unsigned int UPLOAD_BUDGET = 1024 * 1024;
+
+			double load_milliseconds = 0.0, upload_frame_milliseconds_total = 0.0, upload_frame_milliseconds_worst = 0.0, total_milliseconds = 0.0;
+			std::size_t upload_frame_count = 0, byte_count = 0, loaded_count = 0;
+			{
+				AsyncTextureLoader texture_loader( UPLOAD_BUDGET, Utility::ThreadPool::Default(), nullptr );
+
+				const auto start = std::chrono::steady_clock::now();
+
+				std::vector< std::shared_ptr< Texture > > texture_list;
+				for( const auto& file_path : file_path_list )
+					texture_list.push_back( texture_loader.Load( file_path, GL_RGBA ) );
+
+				load_milliseconds = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+
+				/* Frames are simulated back to back; yielding stands in for the rest of the frame, during which the decoders get to run. */
+				while( !texture_loader.IsIdle() )
+				{
+					const std::size_t uploaded_byte_count = texture_loader.GetStatistics().uploaded_byte_count;
+
+					const auto frame_start = std::chrono::steady_clock::now();
+					texture_loader.Update();
+					const double milliseconds = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - frame_start ).count();
+
+					if( texture_loader.GetStatistics().uploaded_byte_count != uploaded_byte_count )
+					{
+						upload_frame_milliseconds_total += milliseconds;
+						upload_frame_milliseconds_worst  = std::max( upload_frame_milliseconds_worst, milliseconds );
+					}
+
+					std::this_thread::yield();
+				}
+
+				total_milliseconds = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+
+				upload_frame_count	= texture_loader.GetStatistics().upload_frame_count;
+				byte_count			= texture_loader.GetStatistics().uploaded_byte_count;
+				loaded_count		= texture_loader.GetStatistics().loaded_count;
+			}
+
+			results.push_back( { "AsyncTextureLoader: Load() calls", load_milliseconds,
+								 std::to_string( file_path_list.size() ) + " placeholder textures returned" } );
+			results.push_back( { "AsyncTextureLoader: Avg. upload frame", upload_frame_milliseconds_total / std::max< std::size_t >( upload_frame_count, 1 ),
+								 std::to_string( loaded_count ) + " textures, " + MegaBytes( byte_count ) + " uploaded over " + std::to_string( upload_frame_count ) +
+								 " frames at <= " + MegaBytes( UPLOAD_BUDGET ) + " each; worst frame " + std::to_string( upload_frame_milliseconds_worst ).substr( 0, 5 ) +
+								 " ms; all loaded after " + std::to_string( total_milliseconds ).substr( 0, 6 ) + " ms" } );
+		}
+
+		return results;
+	}
+
+	ResultList TextureCaching()
+	{
+		constexpr int ENTRY_COUNT = 4;
+
+		GLStub gl_stub( {} );
+
+		ResultList results;
+
+		{
+			double milliseconds = 0.0;
+			for( int entry = 0; entry < ENTRY_COUNT; entry++ )
+				milliseconds += EnterAndLeaveTest( nullptr );
+
+			results.push_back( { "No cache: Per test entry", milliseconds / ENTRY_COUNT, "4 loads & 4 decodes each time" } );
+		}
+
+		{
+			/* Not the shared instance, so that the results do not depend on what ran before. */
+			TextureCache texture_cache;
+
+			const double first_milliseconds = EnterAndLeaveTest( &texture_cache );
+			const auto first_statistics		= texture_cache.GetStatistics();
+
+			texture_cache.ResetStatistics();
+			double milliseconds = 0.0;
+			for( int entry = 1; entry < ENTRY_COUNT; entry++ )
+				milliseconds += EnterAndLeaveTest( &texture_cache );
+
+			const auto& statistics = texture_cache.GetStatistics();
+
+			results.push_back( { "TextureCache: First entry", first_milliseconds,
+								 std::to_string( first_statistics.miss_count ) + " decodes, " + std::to_string( first_statistics.texture_hit_count ) + " texture hit(s); " +
+								 std::to_string( texture_cache.ImageCount() ) + " images (" + MegaBytes( texture_cache.ImageByteCount() ) + ") cached" } );
+			results.push_back( { "TextureCache: Per re-entry", milliseconds / ( ENTRY_COUNT - 1 ),
+								 std::to_string( statistics.miss_count ) + " decodes, " + std::to_string( statistics.image_hit_count ) + " image hits, " +
+								 std::to_string( statistics.texture_hit_count ) + " texture hits over " + std::to_string( ENTRY_COUNT - 1 ) + " re-entries" } );
+
+			/* A budget below what the test needs: the LRU evicts on every entry & decodes come back. */
+			texture_cache.SetImageBudget( texture_cache.ImageByteCount() / 2 );
+			texture_cache.ResetStatistics();
+			const double tight_milliseconds = EnterAndLeaveTest( &texture_cache );
+
+			results.push_back( { "TextureCache: Re-entry, budget halved", tight_milliseconds,
+								 std::to_string( texture_cache.GetStatistics().miss_count ) + " decodes, " +
+								 std::to_string( texture_cache.GetStatistics().eviction_count ) + " evictions; " + MegaBytes( texture_cache.ImageByteCount() ) + " cached" } );
+		}
+
+		return results;
+	}
+
+	ResultList TextureEncoding()
+	{
+		using namespace Framework::TextureCompression;
+
+		const auto image_list = LoadTestImages();
+
+		std::size_t pixel_count = 0, rgba_byte_count = 0;
+		for( const auto& image : image_list )
+		{
+			pixel_count		+= std::size_t( image.width ) * image.height;
+			rgba_byte_count += image.pixels.size();
+		}
+
+		ResultList results;
+
+		const auto encode_all = [ & ]( const Format format, Utility::ThreadPool& thread_pool, std::vector< std::vector< std::byte > >& block_list )
+		{
+			return Measure( [ & ]()
+			{
+				block_list.clear();
+				for( const auto& image : image_list )
+					block_list.push_back( Encode( image.pixels.data(), image.width, image.height, format, thread_pool ) );
+			} );
+		};
+
+		const auto mega_pixels_per_second = [ & ]( const double milliseconds ) { return std::to_string( pixel_count / ( milliseconds * 1000.0 ) ).substr( 0, 5 ) + " MP/s"; };
+
+		for( const Format format : { Format::BC1, Format::BC3, Format::BC5, Format::BC7, Format::ETC2_RGB } )
+		{
+			std::vector< std::vector< std::byte > > block_list;
+			const double milliseconds = encode_all( format, Utility::ThreadPool::Default(), block_list );
+
+			/* Weighted by pixel count, i.e., over all 3 images. */
+			double psnr_sum = 0.0;
+			std::size_t compressed_byte_count = 0;
+			for( std::size_t i = 0; i < image_list.size(); i++ )
+			{
+				const auto& image  = image_list[ i ];
+				const auto decoded = Decode( block_list[ i ].data(), image.width, image.height, format );
+
+				psnr_sum			  += PSNR( image.pixels.data(), decoded.data(), image.width, image.height, format ) * image.width * image.height;
+				compressed_byte_count += block_list[ i ].size();
+			}
+
+			results.push_back( { std::string( "Encode " ) + NameOf( format ), milliseconds,
+								 mega_pixels_per_second( milliseconds ) + ", PSNR " + std::to_string( psnr_sum / pixel_count ).substr( 0, 5 ) + " dB, " +
+								 MegaBytes( rgba_byte_count ) + " -> " + MegaBytes( compressed_byte_count ) } );
+		}
+
+		{
+			Utility::ThreadPool thread_pool( 1 );
+
+			std::vector< std::vector< std::byte > > block_list;
+			const double milliseconds = encode_all( Format::BC7, thread_pool, block_list );
+
+			results.push_back( { "Encode BC7 on 1 worker", milliseconds,
+								 mega_pixels_per_second( milliseconds ) + "; the pool above has " + std::to_string( Utility::ThreadPool::Default().ThreadCount() ) +
+								 " worker(s), plus the calling thread in both cases" } );
+		}
+
+		/* Offline conversion & loading: */
+		const auto& image				= image_list.front();
+		const std::string file_path		= ( std::filesystem::temp_directory_path() / "benchmark_texture.ktx" ).string();
+		const std::string source_path	= "Asset/Texture/container.jpg";
+
+		{
+			const double milliseconds = Measure( [ & ]()
+			{
+				std::vector< std::vector< std::byte > > level_list;
+				for( const auto& mip_level : MipmapGenerator::Generate( image.pixels.data(), image.width, image.height, 4 ) )
+					level_list.push_back( Encode( mip_level.pixels.data(), mip_level.width, mip_level.height, Format::BC1 ) );
+
+				TextureFile::Write( file_path, InternalFormatOf( Format::BC1 ), image.width, image.height, level_list );
+			} );
+
+			results.push_back( { "Convert to BC1 .ktx (offline)", milliseconds, "Mipmaps generated & compressed, file written" } );
+		}
+
+		GLStub gl_stub( {} );
+
+		{
+			std::size_t byte_count = 0;
+			const double milliseconds = Measure( [ & ]()
+			{
+				GLStub::ResetStatistics();
+				Texture texture( source_path.c_str(), GL_RGB );
+				byte_count = GLStub::GetStatistics().texture_upload_byte_count;
+			} );
+
+			results.push_back( { "Texture: .jpg (decode & upload)", milliseconds,
+								 MegaBytes( byte_count ) + " uploaded, ~" + MegaBytes( byte_count * 4 / 3 ) + " of VRAM once the driver generates the mipmaps" } );
+		}
+
+		{
+			std::size_t byte_count = 0, upload_count = 0;
+			bool is_loaded = false;
+			const double milliseconds = Measure( [ & ]()
+			{
+				GLStub::ResetStatistics();
+				const TextureFile texture_file( file_path );
+				Texture texture( texture_file );
+				is_loaded	 = texture.IsLoaded();
+				byte_count	 = GLStub::GetStatistics().texture_upload_byte_count;
+				upload_count = GLStub::GetStatistics().texture_upload_count;
+			} );
+
+			results.push_back( { "Texture: BC1 .ktx (map & upload)", milliseconds,
+								 ( is_loaded ? MegaBytes( byte_count ) + " uploaded in " + std::to_string( upload_count ) + " levels, all mipmaps included"
+											 : std::string( "FAILED TO LOAD" ) ) } );
+		}
+
+		std::filesystem::remove( file_path );
+
+		return results;
+	}
+
+	ResultList MipmapGeneration()
+	{
+		using MipmapGenerator::Filter;
+
+		const auto image_list = LoadTestImages();
+
+		std::size_t pixel_count = 0;
+		for( const auto& image : image_list )
+			pixel_count += std::size_t( image.width ) * image.height;
+
+		ResultList results;
+
+		const auto generate_all = [ & ]( const MipmapGenerator::Settings& settings, Utility::ThreadPool& thread_pool )
+		{
+			return Measure( [ & ]()
+			{
+				for( const auto& image : image_list )
+					MipmapGenerator::Generate( image.pixels.data(), image.width, image.height, 4, settings, thread_pool );
+			} );
+		};
+
+		const auto mega_pixels_per_second = [ & ]( const double milliseconds ) { return std::to_string( pixel_count / ( milliseconds * 1000.0 ) ).substr( 0, 5 ) + " MP/s"; };
+
+		for( const auto& [ filter, name ] : { std::pair{ Filter::Box, "Box" }, std::pair{ Filter::Kaiser, "Kaiser" }, std::pair{ Filter::Lanczos, "Lanczos" } } )
+		{
+			const double milliseconds = generate_all( { .filter = filter }, Utility::ThreadPool::Default() );
+			results.push_back( { std::string( "Generate: " ) + name + " (" + Math::SIMD::InstructionSetName() + ")", milliseconds,
+								 mega_pixels_per_second( milliseconds ) + " of level 0, RGBA8, full chains" } );
+		}
+
+		{
+			const double milliseconds = generate_all( { .filter = Filter::Kaiser, .is_srgb = true }, Utility::ThreadPool::Default() );
+			results.push_back( { "Generate: Kaiser, sRGB", milliseconds, mega_pixels_per_second( milliseconds ) + "; decoded & encoded again through tables" } );
+		}
+
+		{
+			Utility::ThreadPool thread_pool( 1 );
+
+			const double milliseconds = generate_all( { .filter = Filter::Kaiser }, thread_pool );
+			results.push_back( { "Generate: Kaiser on 1 worker", milliseconds,
+								 mega_pixels_per_second( milliseconds ) + "; the pool above has " + std::to_string( Utility::ThreadPool::Default().ThreadCount() ) +
+								 " worker(s), plus the calling thread in both cases" } );
+		}
+
+		/* Gamma: Averaging sRGB values as if they were linear darkens the levels (most visibly where bright & dark texels meet). container.jpg is sRGB. */
+		if( !image_list.empty() )
+		{
+			const auto& image = image_list.front();
+
+			std::vector< MipmapGenerator::Level > linear_level_list, srgb_level_list;
+			const double milliseconds = Measure( [ & ]()
+			{
+				linear_level_list = MipmapGenerator::Generate( image.pixels.data(), image.width, image.height, 4, { .filter = Filter::Box } );
+				srgb_level_list	  = MipmapGenerator::Generate( image.pixels.data(), image.width, image.height, 4, { .filter = Filter::Box, .is_srgb = true } );
+			} );
+
+			const double reference_brightness = AverageLinearBrightness( linear_level_list.front() );
+			const auto drift = [ & ]( const MipmapGenerator::Level& level ) { return Percent( AverageLinearBrightness( level ) / reference_brightness - 1.0 ); };
+
+			const std::size_t level = std::min< std::size_t >( 4, linear_level_list.size() - 1 );
+			results.push_back( { "Brightness drift, container.jpg", milliseconds,
+								 "Level " + std::to_string( level ) + ": " + drift( linear_level_list[ level ] ) + " as linear, " + drift( srgb_level_list[ level ] ) +
+								 " as sRGB; 1x1: " + drift( linear_level_list.back() ) + " vs. " + drift( srgb_level_list.back() ) } );
+		}
+
+		/* Alpha testing: awesomeface.png is opaque inside the face & transparent around it. */
+		if( image_list.size() > 1 )
+		{
+			constexpr float ALPHA_REFERENCE = 0.5f;
+
+			const auto& image = image_list[ 1 ];
+
+			std::vector< MipmapGenerator::Level > plain_level_list, preserved_level_list;
+			const double milliseconds = Measure( [ & ]()
+			{
+				plain_level_list	 = MipmapGenerator::Generate( image.pixels.data(), image.width, image.height, 4, { .filter = Filter::Kaiser } );
+				preserved_level_list = MipmapGenerator::Generate( image.pixels.data(), image.width, image.height, 4,
+																  { .filter = Filter::Kaiser, .preserve_alpha_coverage = true, .alpha_reference = ALPHA_REFERENCE } );
+			} );
+
+			std::string detail = "Level 0: " + Percent( AlphaCoverage( plain_level_list.front(), ALPHA_REFERENCE ) );
+			for( std::size_t level = std::min< std::size_t >( 5, plain_level_list.size() - 1 ); level + 1 < plain_level_list.size() && level <= 7; level++ )
+				detail += "; " + std::to_string( level ) + ": " + Percent( AlphaCoverage( plain_level_list[ level ], ALPHA_REFERENCE ) ) + " -> " +
+						  Percent( AlphaCoverage( preserved_level_list[ level ], ALPHA_REFERENCE ) );
+
+			results.push_back( { "Alpha coverage, awesomeface.png", milliseconds, detail + " (plain -> preserved)" } );
+		}
+
+		/* Loading: CPU mipmaps are generated on the decoding worker & uploaded along with level 0. */
+		GLStub gl_stub( {} );
+
+		const auto load_all = [ & ]( const std::optional< MipmapGenerator::Settings >& mipmap_settings, std::size_t& byte_count, std::size_t& frame_count )
+		{
+			return Measure( [ & ]()
+			{
+				AsyncTextureLoader texture_loader( AsyncTextureLoader::DEFAULT_UPLOAD_BUDGET, Utility::ThreadPool::Default(), nullptr );
+
+				const std::shared_ptr< Texture > texture_list[] =
+				{
+					texture_loader.Load( "Asset/Texture/container.jpg",		GL_RGBA, mipmap_settings ),
+					texture_loader.Load( "Asset/Texture/awesomeface.png",	GL_RGBA, mipmap_settings ),
+					texture_loader.Load( "Asset/Texture/test_tex_cube.png", GL_RGBA, mipmap_settings )
+				};
+
+				while( !texture_loader.IsIdle() )
+				{
+					texture_loader.Update();
+					std::this_thread::yield();
+				}
+
+				byte_count	= texture_loader.GetStatistics().uploaded_byte_count;
+				frame_count = texture_loader.GetStatistics().upload_frame_count;
+			} );
+		};
+
+		{
+			std::size_t byte_count = 0, frame_count = 0;
+			const double milliseconds = load_all( std::nullopt, byte_count, frame_count );
+			results.push_back( { "AsyncTextureLoader: glGenerateMipmap()", milliseconds,
+								 MegaBytes( byte_count ) + " uploaded over " + std::to_string( frame_count ) + " frame(s); the driver filters in linear space" } );
+		}
+
+		{
+			std::size_t byte_count = 0, frame_count = 0;
+			const double milliseconds = load_all( MipmapGenerator::Settings{ .filter = Filter::Kaiser, .is_srgb = true }, byte_count, frame_count );
+			results.push_back( { "AsyncTextureLoader: CPU mipmaps (Kaiser, sRGB)", milliseconds,
+								 MegaBytes( byte_count ) + " uploaded over " + std::to_string( frame_count ) + " frame(s), all levels included" } );
+		}
+
+		return results;
+	}
+
+	ResultList TextureAtlasPacking()
+	{
+		/* Random sizes (& contents, for the upload); the same every run. */
+		const auto make_image_list = []( const std::size_t count, const int min_size, const int max_size, std::vector< unsigned char >& pixels )
+		{
+			std::mt19937 generator( 42 );
+			std::uniform_int_distribution< int > size_distribution( min_size, max_size );
+
+			std::vector< std::pair< int, int > > size_list( count );
+			std::size_t byte_count = 0;
+			for( auto& [ width, height ] : size_list )
+			{
+				width		= size_distribution( generator );
+				height		= size_distribution( generator );
+				byte_count += std::size_t( width ) * height * 4;
+			}
+
+			pixels.resize( byte_count );
+			for( auto& value : pixels )
+				value = ( unsigned char )generator();
+
+			std::vector< TextureAtlas::Image > image_list;
+			std::size_t offset = 0;
+			for( const auto& [ width, height ] : size_list )
+			{
+				image_list.push_back( { width, height, pixels.data() + offset } );
+				offset += std::size_t( width ) * height * 4;
+			}
+
+			return image_list;
+		};
+
+		ResultList results;
+
+		std::vector< unsigned char > small_pixels, mixed_pixels;
+		const auto small_image_list = make_image_list( 4096, 8, 64,	 small_pixels );
+		const auto mixed_image_list = make_image_list( 2048, 8, 256, mixed_pixels );
+
+		for( const auto& [ image_list, name ] : { std::pair{ &small_image_list, "4096 images, 8-64" }, std::pair{ &mixed_image_list, "2048 images, 8-256" } } )
+		{
+			std::optional< TextureAtlas::Layout > layout;
+			const double milliseconds = Measure( [ & ]() { layout = TextureAtlas::Pack( *image_list ); } );
+
+			results.push_back( { std::string( "Pack: " ) + name, milliseconds,
+								 layout ? std::to_string( layout->layer_count ) + " layers of " + std::to_string( layout->layer_size ) + "^2, " +
+										  Percent( layout->Efficiency() ) + " covered (padding " + std::to_string( TextureAtlas::DEFAULT_PADDING ) + ")"
+										: std::string( "FAILED" ) } );
+		}
+
+		GLStub gl_stub( {} );
+
+		{
+			std::size_t byte_count = 0, upload_count = 0;
+			bool is_loaded = false;
+			const double milliseconds = Measure( [ & ]()
+			{
+				GLStub::ResetStatistics();
+				TextureAtlas texture_atlas( small_image_list, GL_RGBA );
+				is_loaded	 = texture_atlas.IsLoaded();
+				byte_count	 = GLStub::GetStatistics().texture_upload_byte_count;
+				upload_count = GLStub::GetStatistics().texture_upload_count;
+			} );
+
+			results.push_back( { "Build: 4096 images, 8-64", milliseconds,
+								 is_loaded ? std::to_string( upload_count ) + " uploads, " + MegaBytes( byte_count ) + " with padding"
+										   : std::string( "FAILED TO LOAD" ) } );
+		}
+
+		/* Draws cycling through 64 images, as sprites sorted by anything but their texture would. */
+		{
+			constexpr int DRAW_COUNT = 4096, IMAGE_COUNT = 64;
+
+			const std::vector< TextureAtlas::Image > image_list( small_image_list.begin(), small_image_list.begin() + IMAGE_COUNT );
+			TextureAtlas texture_atlas( image_list, GL_RGBA );
+
+			std::vector< GLuint > texture_id_list( IMAGE_COUNT );
+			GLCALL( glGenTextures( IMAGE_COUNT, texture_id_list.data() ) );
+
+			auto& state_cache = StateCache::Instance();
+
+			std::size_t separate_bind_count = 0;
+			const double separate_milliseconds = Measure( [ & ]()
+			{
+				state_cache.Invalidate();
+				state_cache.ResetStatistics();
+				for( int draw = 0; draw < DRAW_COUNT; draw++ )
+					state_cache.BindTexture( GL_TEXTURE0, GL_TEXTURE_2D, texture_id_list[ draw % IMAGE_COUNT ] );
+
+				separate_bind_count = state_cache.GetStatistics().texture_change_count;
+			} );
+
+			std::size_t atlas_bind_count = 0;
+			std::vector< TextureAtlas::Region > instance_region_list( DRAW_COUNT ); // What each draw's instance data would carry.
+			const double atlas_milliseconds = Measure( [ & ]()
+			{
+				state_cache.Invalidate();
+				state_cache.ResetStatistics();
+				for( int draw = 0; draw < DRAW_COUNT; draw++ )
+				{
+					texture_atlas.GetTextureArray()->ActivateAndBind( GL_TEXTURE0 );
+					instance_region_list[ draw ] = texture_atlas.GetRegion( draw % IMAGE_COUNT );
+				}
+
+				atlas_bind_count = state_cache.GetStatistics().texture_change_count;
+			} );
+
+			state_cache.Invalidate();
+
+			results.push_back( { "Binds: Separate textures", separate_milliseconds,
+								 std::to_string( separate_bind_count ) + " texture binds for " + std::to_string( DRAW_COUNT ) + " draws over " + std::to_string( IMAGE_COUNT ) + " images" } );
+			results.push_back( { "Binds: Atlas", atlas_milliseconds,
+								 std::to_string( atlas_bind_count ) + " texture bind(s); " + std::to_string( texture_atlas.GetTextureArray()->LayerCount() ) + " layer(s), " +
+								 "images told apart by their regions instead" } );
+		}
+
+		/* Neither should touch GL; an unsupported format used to be caught only after the array was allocated. */
+		{
+			GLStub::ResetStatistics();
+			const TextureAtlas texture_atlas_empty( {}, GL_RGBA );
+			const bool is_empty_skipped = !texture_atlas_empty.GetTextureArray() && !texture_atlas_empty.IsLoaded() &&
+										  GLStub::GetStatistics().call_count == 0;
+
+			GLStub::ResetStatistics();
+			const TextureAtlas texture_atlas_bgra( { small_image_list.front() }, GL_BGRA );
+			const bool is_bgra_rejected = !texture_atlas_bgra.GetTextureArray() && !texture_atlas_bgra.IsLoaded() &&
+										  GLStub::GetStatistics().call_count == 0;
+
+			results.push_back( { "Build: Empty image list", 0.0, is_empty_skipped ? "No texture array created" : "GL CALLS MADE!" } );
+			results.push_back( { "Build: Unsupported color format", 0.0, is_bgra_rejected ? "Rejected before any GL call" : "GL CALLS MADE!" } );
+		}
+
+		return results;
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+// Framework Includes.
+#include "Benchmark/Benchmark.h"
+
+namespace Framework::Benchmark
+{
+	/* Startup cost of loading the 3 test textures 8 times each (24 images, decoded to RGBA): decoding on the calling thread vs. on thread pools of 1, 3 & 7 workers
+	 * (as far as the hardware has them), the time Load() blocks the render thread for, & the frame hitches of uploading (through GLStub): all at once through
+	 * synchronous Textures vs. spread over frames by AsyncTextureLoader with a 1 MB budget. Headless; the image files are read from Asset/Texture. */
+	ResultList TextureLoading();
+
+	/* Entering & leaving a textured test 4 times (container.jpg, awesomeface.png & test_tex_cube.png twice; uploads through GLStub), without a TextureCache vs. with one:
+	 * time until all textures are loaded, decodes & hits, & the effect of an image budget too small to hold them all. */
+	ResultList TextureCaching();
+
+	/* The CPU block compressor on the 3 test textures (level 0): encode time & throughput (megapixels/s) per format on the shared thread pool, with the PSNR
+	 * of the decoded result; BC7 on 1 worker vs. the pool for the scaling across block rows. Then container.jpg as a BC1 .ktx with precomputed mipmaps:
+	 * converting, opening & uploading it (through GLStub), vs. the RGBA8 upload & glGenerateMipmap() of Texture. */
+	ResultList TextureEncoding();
+
+	/* CPU mipmap generation (MipmapGenerator) on the 3 test textures: time & throughput per filter on the shared thread pool (& the box filter on 1 worker);
+	 * the brightness of container.jpg's smallest levels filtered in sRGB vs. linear space; the alpha coverage of awesomeface.png's smaller levels with & without
+	 * coverage preservation; & loading all 3 through AsyncTextureLoader (uploads through GLStub) with CPU mipmaps vs. glGenerateMipmap(). */
+	ResultList MipmapGeneration();
+
+	/* TextureAtlas: packing 4096 small (8-64 texels) & 2048 mixed (8-256) random sizes into 1024x1024 layers: pack time, layers & efficiency (texels covered
+	 * by images); building the 4096 image atlas (padding & uploads through GLStub); & the texture binds of 4096 draws over 64 images, from separate textures
+	 * vs. the atlas' array. Also checks that empty image lists & unsupported color formats create no array. */
+	ResultList TextureAtlasPacking();
+}
@@ -0,0 +1,526 @@
+// Framework Includes.
+#include "Benchmark/GLStub.h"
+
+#include "Core/Assert.h"
+
+#include "Renderer/StateCache.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+namespace Framework::Benchmark
+{
+	namespace
+	{
+		GLStub::Statistics statistics{};
+		std::vector< GLStub::UniformDescription > uniform_list;
+		std::vector< std::string > uniform_block_name_list;
+		std::vector< std::string > attribute_list;
+		GLuint program_id_last      = 0;
+		GLuint buffer_id_last       = 0;
+		GLuint vertex_array_id_last = 0;
+		GLuint texture_id_last      = 0;
+		std::size_t fence_id_last   = 0;
+		std::size_t fence_latency   = 0;
+		std::vector< std::byte > upload_memory;
+		std::vector< std::byte > mapped_memory;
+		bool is_installed = false;
+
+	/* Generic: */
+		GLenum APIENTRY Stub_glGetError()
+		{
+			statistics.error_query_count++;
+			return GL_NO_ERROR;
+		}
+
+		/* The texture compression extensions, so that compressed textures of all formats TextureCompression produces can be created. */
+		constexpr const char* EXTENSION_LIST[] = { "GL_EXT_texture_compression_s3tc", "GL_ARB_texture_compression_bptc", "GL_ARB_ES3_compatibility" };
+
+		void APIENTRY Stub_glGetIntegerv( GLenum name, GLint* data )
+		{
+			statistics.call_count++;
+			switch( name )
+			{
+				case GL_NUM_EXTENSIONS:				*data = GLint( std::size( EXTENSION_LIST ) ); break;
+				/* The GL 3.3 minimums. */
+				case GL_MAX_TEXTURE_SIZE:			*data = 1024; break;
+				case GL_MAX_ARRAY_TEXTURE_LAYERS:	*data = 256; break;
+				default:							*data = 0; break;
+			}
+		}
+
+		const GLubyte* APIENTRY Stub_glGetStringi( GLenum, GLuint index )
+		{
+			statistics.call_count++;
+			return reinterpret_cast< const GLubyte* >( EXTENSION_LIST[ index ] );
+		}
+
+	/* Shader & Program: */
+		GLuint APIENTRY Stub_glCreateShader( GLenum )												{ statistics.call_count++; return 1; }
+		void APIENTRY Stub_glShaderSource( GLuint, GLsizei, const GLchar* const*, const GLint* )	{ statistics.call_count++; }
+		void APIENTRY Stub_glCompileShader( GLuint )												{ statistics.call_count++; }
+		void APIENTRY Stub_glDeleteShader( GLuint )													{ statistics.call_count++; }
+		GLuint APIENTRY Stub_glCreateProgram()														{ statistics.call_count++; return ++program_id_last; }
+		void APIENTRY Stub_glAttachShader( GLuint, GLuint )											{ statistics.call_count++; }
+		void APIENTRY Stub_glLinkProgram( GLuint )													{ statistics.call_count++; }
+		void APIENTRY Stub_glDeleteProgram( GLuint )												{ statistics.call_count++; }
+		void APIENTRY Stub_glUseProgram( GLuint )													{ statistics.call_count++; }
+
+		void APIENTRY Stub_glGetShaderiv( GLuint, GLenum, GLint* params )
+		{
+			statistics.call_count++;
+			*params = GL_TRUE; // Only GL_COMPILE_STATUS is queried.
+		}
+
+		void APIENTRY Stub_glGetProgramiv( GLuint, GLenum parameter_name, GLint* params )
+		{
+			statistics.call_count++;
+
+			switch( parameter_name )
+			{
+				case GL_ACTIVE_UNIFORMS:
+					*params = ( GLint )uniform_list.size();
+					break;
+				case GL_ACTIVE_UNIFORM_MAX_LENGTH:
+					*params = 1;
+					for( const auto& uniform : uniform_list )
+						*params = std::max( *params, ( GLint )uniform.name.size() + 1 );
+					break;
+				case GL_ACTIVE_UNIFORM_BLOCKS:
+					*params = ( GLint )uniform_block_name_list.size();
+					break;
+				case GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH:
+					*params = 1;
+					for( const auto& block_name : uniform_block_name_list )
+						*params = std::max( *params, ( GLint )block_name.size() + 1 );
+					break;
+				default:
+					*params = GL_TRUE;
+					break;
+			}
+		}
+
+		void APIENTRY Stub_glGetActiveUniform( GLuint, GLuint index, GLsizei buffer_size, GLsizei* length, GLint* size, GLenum* type, GLchar* name )
+		{
+			statistics.call_count++;
+
+			const auto& uniform = uniform_list[ index ];
+			const GLsizei name_length = std::min( ( GLsizei )uniform.name.size(), buffer_size - 1 );
+
+			std::memcpy( name, uniform.name.c_str(), name_length );
+			name[ name_length ] = '\0';
+
+			if( length )
+				*length = name_length;
+			*size = 1;
+			*type = uniform.type;
+		}
+
+		GLint APIENTRY Stub_glGetUniformLocation( GLuint, const GLchar* name )
+		{
+			statistics.call_count++;
+
+			for( GLint location = 0; location < ( GLint )uniform_list.size(); location++ )
+				if( uniform_list[ location ].name == name && uniform_list[ location ].block_name.empty() )
+					return location;
+
+			return -1;
+		}
+
+		GLint UniformBlockIndex( const std::string& block_name )
+		{
+			const auto iterator = std::find( uniform_block_name_list.cbegin(), uniform_block_name_list.cend(), block_name );
+			return iterator == uniform_block_name_list.cend() ? -1 : ( GLint )( iterator - uniform_block_name_list.cbegin() );
+		}
+
+		/* std140 base alignment & size; only the types used by the benchmarks (scalars, vectors & mat4) are covered. */
+		std::pair< GLint, GLint > Std140AlignmentAndSize( const GLenum type )
+		{
+			switch( type )
+			{
+				case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2:	return { 8, 8 };
+				case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3:	return { 16, 12 };
+				case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4:	return { 16, 16 };
+				case GL_FLOAT_MAT4:																	return { 16, 64 };
+				default:																			return { 4, 4 };
+			}
+		}
+
+		/* Offset of the given uniform inside its block if member_index is valid; otherwise the total (padded) size of the block. */
+		GLint Std140Offset( const std::string& block_name, const std::size_t member_index )
+		{
+			GLint offset = 0;
+			for( std::size_t i = 0; i < uniform_list.size(); i++ )
+			{
+				if( uniform_list[ i ].block_name != block_name )
+					continue;
+
+				const auto [ alignment, size ] = Std140AlignmentAndSize( uniform_list[ i ].type );
+				offset = ( offset + alignment - 1 ) / alignment * alignment;
+
+				if( i == member_index )
+					return offset;
+
+				offset += size;
+			}
+
+			return ( offset + 15 ) / 16 * 16;
+		}
+
+		void APIENTRY Stub_glGetActiveUniformsiv( GLuint, GLsizei count, const GLuint* indices, GLenum parameter_name, GLint* params )
+		{
+			statistics.call_count++;
+
+			for( GLsizei i = 0; i < count; i++ )
+			{
+				const auto& uniform = uniform_list[ indices[ i ] ];
+
+				switch( parameter_name )
+				{
+					case GL_UNIFORM_BLOCK_INDEX:
+						params[ i ] = uniform.block_name.empty() ? -1 : UniformBlockIndex( uniform.block_name );
+						break;
+					case GL_UNIFORM_OFFSET:
+						params[ i ] = uniform.block_name.empty() ? -1 : Std140Offset( uniform.block_name, indices[ i ] );
+						break;
+					default:
+						params[ i ] = 0;
+						break;
+				}
+			}
+		}
+
+		void APIENTRY Stub_glGetActiveUniformBlockiv( GLuint, GLuint block_index, GLenum parameter_name, GLint* params )
+		{
+			statistics.call_count++;
+
+			*params = parameter_name == GL_UNIFORM_BLOCK_DATA_SIZE
+						? Std140Offset( uniform_block_name_list[ block_index ], uniform_list.size() )
+						: 0;
+		}
+
+		GLuint APIENTRY Stub_glGetUniformBlockIndex( GLuint, const GLchar* block_name )
+		{
+			statistics.call_count++;
+
+			const GLint index = UniformBlockIndex( block_name );
+			return index == -1 ? GL_INVALID_INDEX : ( GLuint )index;
+		}
+
+		void APIENTRY Stub_glUniformBlockBinding( GLuint, GLuint, GLuint )							{ statistics.call_count++; }
+
+		GLint APIENTRY Stub_glGetAttribLocation( GLuint, const GLchar* name )
+		{
+			statistics.call_count++;
+
+			const auto iterator = std::find( attribute_list.cbegin(), attribute_list.cend(), name );
+			return iterator == attribute_list.cend() ? -1 : 3 + ( GLint )( iterator - attribute_list.cbegin() );
+		}
+
+	/* Uniforms: */
+		void APIENTRY Stub_glUniform1f( GLint, GLfloat )											{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniform1i( GLint, GLint )												{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniform2fv( GLint, GLsizei, const GLfloat* )							{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniform3fv( GLint, GLsizei, const GLfloat* )							{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniform4fv( GLint, GLsizei, const GLfloat* )							{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniformMatrix2fv( GLint, GLsizei, GLboolean, const GLfloat* )			{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniformMatrix3fv( GLint, GLsizei, GLboolean, const GLfloat* )			{ statistics.call_count++; statistics.uniform_call_count++; }
+		void APIENTRY Stub_glUniformMatrix4fv( GLint, GLsizei, GLboolean, const GLfloat* )			{ statistics.call_count++; statistics.uniform_call_count++; }
+
+	/* Buffers: */
+		void APIENTRY Stub_glGenBuffers( GLsizei count, GLuint* buffers )
+		{
+			statistics.call_count++;
+
+			for( GLsizei i = 0; i < count; i++ )
+				buffers[ i ] = ++buffer_id_last;
+		}
+
+		void APIENTRY Stub_glDeleteBuffers( GLsizei, const GLuint* )								{ statistics.call_count++; }
+		void APIENTRY Stub_glBindBuffer( GLenum, GLuint )											{ statistics.call_count++; }
+		void APIENTRY Stub_glBindBufferBase( GLenum, GLuint, GLuint )								{ statistics.call_count++; }
+
+		/* Copies the data aside, as a driver has to before the call returns. */
+		void CopyUploadedData( const void* data, const GLsizeiptr size )
+		{
+			if( upload_memory.size() < ( std::size_t )size )
+				upload_memory.resize( size );
+
+			std::memcpy( upload_memory.data(), data, size );
+		}
+
+		void APIENTRY Stub_glBufferData( GLenum, GLsizeiptr size, const void* data, GLenum )
+		{
+			statistics.call_count++;
+
+			/* Allocation (or orphaning) without data is not an upload. */
+			if( data )
+			{
+				statistics.buffer_upload_count++;
+				statistics.buffer_upload_byte_count += size;
+				CopyUploadedData( data, size );
+			}
+		}
+
+		void APIENTRY Stub_glBufferSubData( GLenum, GLintptr, GLsizeiptr size, const void* data )
+		{
+			statistics.call_count++;
+			statistics.buffer_upload_count++;
+			statistics.buffer_upload_byte_count += size;
+			CopyUploadedData( data, size );
+		}
+
+		void* APIENTRY Stub_glMapBufferRange( GLenum, GLintptr, GLsizeiptr length, GLbitfield )
+		{
+			statistics.call_count++;
+			statistics.buffer_upload_count++;
+			statistics.buffer_upload_byte_count += length;
+
+			if( mapped_memory.size() < ( std::size_t )length )
+				mapped_memory.resize( length );
+
+			return mapped_memory.data();
+		}
+
+		GLboolean APIENTRY Stub_glUnmapBuffer( GLenum )												{ statistics.call_count++; return GL_TRUE; }
+
+	/* Sync Objects: */
+		/* Fences are just their sequence numbers. */
+		GLsync APIENTRY Stub_glFenceSync( GLenum, GLbitfield )
+		{
+			statistics.call_count++;
+			return reinterpret_cast< GLsync >( ++fence_id_last );
+		}
+
+		void APIENTRY Stub_glDeleteSync( GLsync )													{ statistics.call_count++; }
+
+		GLenum APIENTRY Stub_glClientWaitSync( GLsync sync, GLbitfield, GLuint64 timeout )
+		{
+			statistics.call_count++;
+
+			const std::size_t fence_id = reinterpret_cast< std::size_t >( sync );
+			if( fence_id + fence_latency <= fence_id_last )
+				return GL_ALREADY_SIGNALED;
+
+			if( timeout == 0 )
+				return GL_TIMEOUT_EXPIRED;
+
+			/* Blocking; the "GPU" catches up. */
+			statistics.blocking_wait_count++;
+			fence_id_last += fence_latency;
+			return GL_CONDITION_SATISFIED;
+		}
+
+	/* Vertex Arrays: */
+		void APIENTRY Stub_glGenVertexArrays( GLsizei count, GLuint* arrays )
+		{
+			statistics.call_count++;
+
+			for( GLsizei i = 0; i < count; i++ )
+				arrays[ i ] = ++vertex_array_id_last;
+		}
+
+		void APIENTRY Stub_glDeleteVertexArrays( GLsizei, const GLuint* )							{ statistics.call_count++; }
+		void APIENTRY Stub_glEnableVertexAttribArray( GLuint )										{ statistics.call_count++; }
+		void APIENTRY Stub_glVertexAttribPointer( GLuint, GLint, GLenum, GLboolean, GLsizei, const void* )	{ statistics.call_count++; }
+		void APIENTRY Stub_glVertexAttribDivisor( GLuint, GLuint )									{ statistics.call_count++; }
+		void APIENTRY Stub_glBindVertexArray( GLuint )												{ statistics.call_count++; }
+
+	/* Textures: */
+		void APIENTRY Stub_glGenTextures( GLsizei count, GLuint* textures )
+		{
+			statistics.call_count++;
+
+			for( GLsizei i = 0; i < count; i++ )
+				textures[ i ] = ++texture_id_last;
+		}
+
+		void APIENTRY Stub_glDeleteTextures( GLsizei, const GLuint* )								{ statistics.call_count++; }
+		void APIENTRY Stub_glActiveTexture( GLenum )												{ statistics.call_count++; }
+		void APIENTRY Stub_glBindTexture( GLenum, GLuint )											{ statistics.call_count++; }
+
+		std::size_t ByteCountOf( const GLsizei width, const GLsizei height, const GLenum format )
+		{
+			const std::size_t channel_count = format == GL_RED ? 1 : format == GL_RG ? 2 : format == GL_RGB ? 3 : 4;
+			return std::size_t( width ) * height * channel_count;
+		}
+
+		void APIENTRY Stub_glTexImage2D( GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum, const void* data )
+		{
+			statistics.call_count++;
+
+			/* Allocation without data is not an upload. */
+			if( data )
+			{
+				statistics.texture_upload_count++;
+				statistics.texture_upload_byte_count += ByteCountOf( width, height, format );
+			}
+		}
+
+		void APIENTRY Stub_glTexSubImage2D( GLenum, GLint, GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum, const void* )
+		{
+			statistics.call_count++;
+			statistics.texture_upload_count++;
+			statistics.texture_upload_byte_count += ByteCountOf( width, height, format );
+		}
+
+		void APIENTRY Stub_glTexImage3D( GLenum, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLint, GLenum format, GLenum, const void* data )
+		{
+			statistics.call_count++;
+
+			if( data )
+			{
+				statistics.texture_upload_count++;
+				statistics.texture_upload_byte_count += ByteCountOf( width, height, format ) * depth;
+			}
+		}
+
+		void APIENTRY Stub_glTexSubImage3D( GLenum, GLint, GLint, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum, const void* )
+		{
+			statistics.call_count++;
+			statistics.texture_upload_count++;
+			statistics.texture_upload_byte_count += ByteCountOf( width, height, format ) * depth;
+		}
+
+		void APIENTRY Stub_glCompressedTexImage2D( GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei image_size, const void* )
+		{
+			statistics.call_count++;
+			statistics.texture_upload_count++;
+			statistics.texture_upload_byte_count += image_size;
+		}
+
+		void APIENTRY Stub_glTexParameteri( GLenum, GLenum, GLint )									{ statistics.call_count++; }
+		void APIENTRY Stub_glTexParameterfv( GLenum, GLenum, const GLfloat* )						{ statistics.call_count++; }
+		void APIENTRY Stub_glGenerateMipmap( GLenum )												{ statistics.call_count++; }
+		void APIENTRY Stub_glPixelStorei( GLenum, GLint )											{ statistics.call_count++; }
+
+	/* Drawing: */
+		void APIENTRY Stub_glDrawArrays( GLenum, GLint, GLsizei )									{ statistics.call_count++; statistics.draw_call_count++; }
+		void APIENTRY Stub_glDrawElements( GLenum, GLsizei, GLenum, const void* )					{ statistics.call_count++; statistics.draw_call_count++; }
+		void APIENTRY Stub_glDrawArraysInstanced( GLenum, GLint, GLsizei, GLsizei )					{ statistics.call_count++; statistics.draw_call_count++; }
+		void APIENTRY Stub_glDrawElementsInstanced( GLenum, GLsizei, GLenum, const void*, GLsizei )	{ statistics.call_count++; statistics.draw_call_count++; }
+	}
+
+	GLStub::GLStub( const std::vector< UniformDescription >& active_uniforms, const std::vector< std::string >& active_attributes )
+	{
+		ASSERT_DEBUG_ONLY( !is_installed && "GLStub: Only one instance can be alive at a time." );
+
+		is_installed   = true;
+		uniform_list   = active_uniforms;
+		attribute_list = active_attributes;
+		fence_latency  = 0;
+
+		uniform_block_name_list.clear();
+		for( const auto& uniform : uniform_list )
+			if( !uniform.block_name.empty() && UniformBlockIndex( uniform.block_name ) == -1 )
+				uniform_block_name_list.push_back( uniform.block_name );
+
+		ResetStatistics();
+
+		/* Stub object ids overlap with real ones; forget any state cached while the real functions were in place. */
+		StateCache::Instance().Invalidate();
+
+		Install( glad_glGetError,			Stub_glGetError );
+		Install( glad_glGetIntegerv,		Stub_glGetIntegerv );
+		Install( glad_glGetStringi,			Stub_glGetStringi );
+
+		/* Reported as a GL 3.3 context, as the window's context is (headless, GLAD never set the version). */
+		restore_list.push_back( [ version = GLVersion ]() { GLVersion = version; } );
+		GLVersion = { 3, 3 };
+
+		Install( glad_glCreateShader,		Stub_glCreateShader );
+		Install( glad_glShaderSource,		Stub_glShaderSource );
+		Install( glad_glCompileShader,		Stub_glCompileShader );
+		Install( glad_glDeleteShader,		Stub_glDeleteShader );
+		Install( glad_glGetShaderiv,		Stub_glGetShaderiv );
+		Install( glad_glCreateProgram,		Stub_glCreateProgram );
+		Install( glad_glAttachShader,		Stub_glAttachShader );
+		Install( glad_glLinkProgram,		Stub_glLinkProgram );
+		Install( glad_glDeleteProgram,		Stub_glDeleteProgram );
+		Install( glad_glUseProgram,			Stub_glUseProgram );
+		Install( glad_glGetProgramiv,		Stub_glGetProgramiv );
+		Install( glad_glGetActiveUniform,	Stub_glGetActiveUniform );
+		Install( glad_glGetUniformLocation, Stub_glGetUniformLocation );
+		Install( glad_glGetActiveUniformsiv,	Stub_glGetActiveUniformsiv );
+		Install( glad_glGetUniformBlockIndex,	Stub_glGetUniformBlockIndex );
+		Install( glad_glUniformBlockBinding,	Stub_glUniformBlockBinding );
+		Install( glad_glGetActiveUniformBlockiv,	Stub_glGetActiveUniformBlockiv );
+		Install( glad_glGetAttribLocation,	Stub_glGetAttribLocation );
+
+		Install( glad_glUniform1f,			Stub_glUniform1f );
+		Install( glad_glUniform1i,			Stub_glUniform1i );
+		Install( glad_glUniform2fv,			Stub_glUniform2fv );
+		Install( glad_glUniform3fv,			Stub_glUniform3fv );
+		Install( glad_glUniform4fv,			Stub_glUniform4fv );
+		Install( glad_glUniformMatrix2fv,	Stub_glUniformMatrix2fv );
+		Install( glad_glUniformMatrix3fv,	Stub_glUniformMatrix3fv );
+		Install( glad_glUniformMatrix4fv,	Stub_glUniformMatrix4fv );
+
+		Install( glad_glGenBuffers,			Stub_glGenBuffers );
+		Install( glad_glDeleteBuffers,		Stub_glDeleteBuffers );
+		Install( glad_glBindBuffer,			Stub_glBindBuffer );
+		Install( glad_glBindBufferBase,		Stub_glBindBufferBase );
+		Install( glad_glBufferData,			Stub_glBufferData );
+		Install( glad_glBufferSubData,		Stub_glBufferSubData );
+		Install( glad_glMapBufferRange,		Stub_glMapBufferRange );
+		Install( glad_glUnmapBuffer,		Stub_glUnmapBuffer );
+
+		Install( glad_glFenceSync,			Stub_glFenceSync );
+		Install( glad_glDeleteSync,			Stub_glDeleteSync );
+		Install( glad_glClientWaitSync,		Stub_glClientWaitSync );
+
+		Install( glad_glGenVertexArrays,			Stub_glGenVertexArrays );
+		Install( glad_glDeleteVertexArrays,			Stub_glDeleteVertexArrays );
+		Install( glad_glEnableVertexAttribArray,	Stub_glEnableVertexAttribArray );
+		Install( glad_glVertexAttribPointer,		Stub_glVertexAttribPointer );
+		Install( glad_glVertexAttribDivisor,		Stub_glVertexAttribDivisor );
+		Install( glad_glBindVertexArray,			Stub_glBindVertexArray );
+
+		Install( glad_glGenTextures,		Stub_glGenTextures );
+		Install( glad_glDeleteTextures,		Stub_glDeleteTextures );
+		Install( glad_glActiveTexture,		Stub_glActiveTexture );
+		Install( glad_glBindTexture,		Stub_glBindTexture );
+		Install( glad_glTexImage2D,			Stub_glTexImage2D );
+		Install( glad_glTexSubImage2D,		Stub_glTexSubImage2D );
+		Install( glad_glTexImage3D,			Stub_glTexImage3D );
+		Install( glad_glTexSubImage3D,		Stub_glTexSubImage3D );
+		Install( glad_glCompressedTexImage2D,	Stub_glCompressedTexImage2D );
+		Install( glad_glTexParameteri,		Stub_glTexParameteri );
+		Install( glad_glTexParameterfv,		Stub_glTexParameterfv );
+		Install( glad_glGenerateMipmap,		Stub_glGenerateMipmap );
+		Install( glad_glPixelStorei,		Stub_glPixelStorei );
+
+		Install( glad_glDrawArrays,			Stub_glDrawArrays );
+		Install( glad_glDrawElements,		Stub_glDrawElements );
+		Install( glad_glDrawArraysInstanced,	Stub_glDrawArraysInstanced );
+		Install( glad_glDrawElementsInstanced,	Stub_glDrawElementsInstanced );
+	}
+
+	GLStub::~GLStub()
+	{
+		for( auto& restore : restore_list )
+			restore();
+
+		StateCache::Instance().Invalidate();
+
+		is_installed = false;
+	}
+
+	const GLStub::Statistics& GLStub::GetStatistics()
+	{
+		return statistics;
+	}
+
+	void GLStub::ResetStatistics()
+	{
+		statistics = {};
+	}
+
+	void GLStub::SetFenceLatency( const std::size_t fence_count )
+	{
+		fence_latency = fence_count;
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+// Vendor GLAD Includes (Has to be included before GLFW!).
+#include "Vendor/OpenGL/glad/glad.h"
+
+// std Includes.
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Framework::Benchmark
+{
+	/* Swaps the GLAD function pointers used by Shader, Material & Drawable with recording no-op stubs, for the lifetime of the object.
+	 * This isolates the CPU-side cost of the renderer code from the driver & makes it possible to construct Shaders without a GL context.
+	 * Program introspection (glGetProgramiv/glGetActiveUniform/glGetUniformLocation/glGetUniformBlockIndex etc.) reports the given uniforms;
+	 * uniforms with a non-empty block name are reported as members of that uniform block, laid out with the std140 rules in declaration order.
+	 * glGetAttribLocation() reports the given attributes at consecutive locations, starting from 3 (after the mesh attributes of the test shaders).
+	 * The context is reported as GL 3.3 with the texture compression extensions (S3TC, BPTC & ES3_compatibility for ETC2) through glGetIntegerv()/glGetStringi(),
+	 * with the GL 3.3 minimums for GL_MAX_TEXTURE_SIZE (1024) & GL_MAX_ARRAY_TEXTURE_LAYERS (256).
+	 * Fences are signaled once SetFenceLatency() newer fences have been created (i.e., once the "GPU" has caught up), or when waited on with a non-zero timeout. */
+	class GLStub
+	{
+	public:
+		struct UniformDescription
+		{
+			std::string name;
+			GLenum type;
+			std::string block_name = {};
+		};
+
+		struct Statistics
+		{
+			std::size_t call_count;
+			std::size_t uniform_call_count;
+			std::size_t draw_call_count;
+			/* glBufferData() with data, glBufferSubData() & write mappings (glMapBufferRange()). */
+			std::size_t buffer_upload_count;
+			std::size_t buffer_upload_byte_count;
+			/* glTexImage2D/3D() with data, glTexSubImage2D/3D() (from client memory or a pixel unpack buffer) & glCompressedTexImage2D(); bytes as of
+			 * GL_UNSIGNED_BYTE components (the compressed size for the latter). */
+			std::size_t texture_upload_count;
+			std::size_t texture_upload_byte_count;
+			/* glClientWaitSync() calls with a non-zero timeout on a fence that was not signaled yet. */
+			std::size_t blocking_wait_count;
+			/* glGetError() calls; not included in call_count. */
+			std::size_t error_query_count;
+		};
+
+	public:
+		GLStub( const std::vector< UniformDescription >& active_uniforms, const std::vector< std::string >& active_attributes = {} );
+		~GLStub();
+
+		GLStub( const GLStub& )				= delete;
+		GLStub& operator= ( const GLStub& )	= delete;
+
+		static const Statistics& GetStatistics();
+		static void ResetStatistics();
+
+		/* How many frames (i.e., fences) the simulated GPU lags behind; 0 by default (fences are signaled right away). */
+		static void SetFenceLatency( const std::size_t fence_count );
+
+	private:
+		template< typename FunctionPointer >
+		void Install( FunctionPointer& glad_function, FunctionPointer stub )
+		{
+			restore_list.push_back( [ &glad_function, original = glad_function ]() { glad_function = original; } );
+			glad_function = stub;
+		}
+
+	private:
+		std::vector< std::function< void() > > restore_list;
+	};
+}
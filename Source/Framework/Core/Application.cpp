@@ -8,17 +8,31 @@
 #include "Renderer/Renderer.h"
 
 #include "Test/Test_Menu.h"
+#include "Test/Test_Benchmark.h"
 #include "Test/Test_Camera_WalkAround.h"
 #include "Test/Test_Camera_LookAt.h"
 #include "Test/Test_ClearColor.h"
 #include "Test/Test_Transform_2Cubes.h"
 #include "Test/Test_ImGui.h"
+#include "Test/Test_Instancing.h"
+
+#include "Tool/MeshConverter.h"
+#include "Tool/TextureConverter.h"
+
+// std Includes.
+#include <string_view>
 
 using namespace Framework;
 using namespace Framework::Test;
 
-int main()
+int main( int argument_count, char* arguments[] )
 {
+	/* Command line tools; these run without a window. */
+	if( argument_count >= 2 && std::string_view( arguments[ 1 ] ) == "--convert-mesh" )
+		return Tool::RunMeshConverter( argument_count, arguments );
+	if( argument_count >= 2 && std::string_view( arguments[ 1 ] ) == "--convert-texture" )
+		return Tool::RunTextureConverter( argument_count, arguments );
+
 	Platform::InitializeAndCreateWindow( 1600, 900, 800, 200 );
 
 	Framework::ImGuiSetup::Initialize();
@@ -34,6 +48,8 @@ int main()
 		test_menu->Register< Test_ClearColor >( Color4::Cyan() );
 		test_menu->Register< Test_Transfom_2Cubes >();
 		test_menu->Register< Test_ImGui >();
+		test_menu->Register< Test_Instancing >();
+		test_menu->Register< Test_Benchmark >();
 
 		test_menu->AutoExecute< Test_Camera_WalkAround >();
 
@@ -139,15 +139,31 @@ namespace Framework::Log
 			case GL_UNSIGNED_INT_VEC3					: Dump( material.GetUniformValue< Vector3U >( uniform_info ) ); break;
 			case GL_UNSIGNED_INT_VEC4					: Dump( material.GetUniformValue< Vector4U >( uniform_info ) ); break;
 			
+			/* std140 stores bools inside the Material block as 4 byte ints. */
 			case GL_BOOL:
 			{
-				bool value = material.GetUniformValue< bool >( uniform_info );
+				bool value = uniform_info.is_in_material_block ? material.GetUniformValue< int >( uniform_info ) != 0 : material.GetUniformValue< bool >( uniform_info );
 				ImGui::Checkbox( "", &value );
 				break;
 			}
-			case GL_BOOL_VEC2							: Dump( material.GetUniformValue< Vector2B >( uniform_info ) ); break;
-			case GL_BOOL_VEC3							: Dump( material.GetUniformValue< Vector3B >( uniform_info ) ); break;
-			case GL_BOOL_VEC4							: Dump( material.GetUniformValue< Vector4B >( uniform_info ) ); break;
+			case GL_BOOL_VEC2:
+				if( uniform_info.is_in_material_block )
+					Dump( material.GetUniformValue< Vector2I >( uniform_info ) );
+				else
+					Dump( material.GetUniformValue< Vector2B >( uniform_info ) );
+				break;
+			case GL_BOOL_VEC3:
+				if( uniform_info.is_in_material_block )
+					Dump( material.GetUniformValue< Vector3I >( uniform_info ) );
+				else
+					Dump( material.GetUniformValue< Vector3B >( uniform_info ) );
+				break;
+			case GL_BOOL_VEC4:
+				if( uniform_info.is_in_material_block )
+					Dump( material.GetUniformValue< Vector4I >( uniform_info ) );
+				else
+					Dump( material.GetUniformValue< Vector4B >( uniform_info ) );
+				break;
 			
 			/* Float matrices: */
 			case GL_FLOAT_MAT2 							: Dump( material.GetUniformValue< Matrix2x2 >( uniform_info ) ); break;
@@ -187,7 +203,7 @@ namespace Framework::Log
 				ImGui::EndTable();
 			}
 
-			const auto& uniform_map = material.shader->GetUniformInformations();
+			const auto& uniform_handle_map = material.shader->GetUniformHandles();
 
 			ImGui::SeparatorText( "Parameters" );
 			if( ImGui::BeginTable( "Parameters", /*6*/ 3, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_PreciseWidths ) )
@@ -201,8 +217,10 @@ namespace Framework::Log
 
 				ImGui::TableHeadersRow();
 
-				for( auto& [ name, uniform_info ] : uniform_map )
+				for( auto& [ name, uniform_handle ] : uniform_handle_map )
 				{
+					const auto& uniform_info = material.shader->GetUniformInformation( uniform_handle );
+
 					ImGui::TableNextColumn(); ImGui::TextUnformatted( name.c_str() );
 					ImGui::TableNextColumn(); DumpUniform( material, uniform_info );
 					/*ImGui::TableNextColumn(); ImGui::Text( "%d", uniform_info.location );
@@ -222,7 +240,7 @@ namespace Framework::Log
 	{
 		if( ImGui::Begin( "Shader Info.", nullptr, window_flags | ImGuiWindowFlags_AlwaysAutoResize ) )
 		{
-			const auto& uniform_map = shader.GetUniformInformations();
+			const auto& uniform_handle_map = shader.GetUniformHandles();
 
 			ImGui::SeparatorText( "General Information" );
 			if( ImGui::BeginTable( "General", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_PreciseWidths ) )
@@ -244,8 +262,10 @@ namespace Framework::Log
 
 				ImGui::TableHeadersRow();
 
-				for( auto& [ name, uniform_info ] : uniform_map )
+				for( auto& [ name, uniform_handle ] : uniform_handle_map )
 				{
+					const auto& uniform_info = shader.GetUniformInformation( uniform_handle );
+
 					ImGui::TableNextColumn(); ImGui::TextUnformatted( name.c_str() );
 					ImGui::TableNextColumn(); ImGui::Text( "%d", uniform_info.location );
 					ImGui::TableNextColumn(); ImGui::Text( "%d", uniform_info.size );
@@ -4,6 +4,8 @@
 // Framework Includes.
 #include "Core/Platform.h"
 
+#include "Renderer/Graphics.h"
+
 // Vendor Includes.
 #include "Vendor/imgui/imgui_impl_glfw.h"
 
@@ -81,6 +83,9 @@ namespace Framework::Platform
 	{
 		if( !gladLoadGLLoader( ( GLADloadproc )glfwGetProcAddress ) )
 			throw std::runtime_error( "ERROR::GRAPHICS::GLAD::FAILED_TO_INITIALIZE!" );
+
+		InitializeGLDebugOutput( ( GLADloadproc )glfwGetProcAddress );
+		InitializeGLBufferStorage( ( GLADloadproc )glfwGetProcAddress );
 	}
 
 	void InitializeAndCreateWindow( const int width_pixels, const int height_pixels, const int pos_x_pixels, const int pos_y_pixels )
@@ -91,6 +96,9 @@ namespace Framework::Platform
 			glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 3 );
 			glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 3 );
 			glfwWindowHint( GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE );
+#ifdef _DEBUG
+			glfwWindowHint( GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE ); // Makes KHR_debug output (GLErrorCheckMode::DebugOutput) as verbose as possible.
+#endif
 
 			//glfwWindowHint( GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE ); // Needed for Mac OS X.
 
@@ -227,6 +235,20 @@ namespace Framework::Platform
 		return FRAMEBUFFER_ASPECT_RATIO;
 	}
 
+	int GetWindowWidthInScreenCoordinates()
+	{
+		int width, height;
+		glfwGetWindowSize( WINDOW, &width, &height );
+		return width;
+	}
+
+	int GetWindowHeightInScreenCoordinates()
+	{
+		int width, height;
+		glfwGetWindowSize( WINDOW, &width, &height );
+		return height;
+	}
+
 	void SetShouldClose( const bool value )
 	{
 		glfwSetWindowShouldClose( WINDOW, value );
@@ -185,6 +185,9 @@ namespace Framework::Platform
 	int GetFrameBufferWidthInPixels();
 	int GetFrameBufferHeightInPixels();
 	float GetFrameBufferAspectRatio();
+	/* Mouse cursor positions are in these units; they differ from the framebuffer's pixels on HiDPI displays. */
+	int GetWindowWidthInScreenCoordinates();
+	int GetWindowHeightInScreenCoordinates();
 	void* GetWindowHandle();
 
 	/* Utility. */
@@ -0,0 +1,418 @@
+// Framework Includes.
+#include "Math/BoundingVolumeHierarchy.h"
+#include "Math/SIMD.h"
+
+#include "Core/Assert.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+
+namespace Framework::Math
+{
+	namespace
+	{
+		/* Relative to testing a primitive's box. */
+		constexpr float TRAVERSAL_COST = 1.0f;
+
+		struct Split
+		{
+			int axis;
+			int bin; // The last bin going to the left child.
+			float cost;
+		};
+
+		/* Partitioned in place while building, so that each node's primitives are contiguous in memory rather than gathered through indices. */
+		struct BuildPrimitive
+		{
+			AABB bounds;
+			Vector3 centroid;
+			std::uint32_t index;
+		};
+
+		/* Bounds as SIMD registers, loaded straight from an AABB's 6 floats: min from offset 0 (lanes 0-2; lane 3 is max.x & unused), max from offset 2
+		 * (lanes 1-3; lane 0 is min.z & unused). */
+		struct Bin
+		{
+			SIMD::Float4 min = SIMD::Splat( std::numeric_limits< float >::max() );
+			SIMD::Float4 max = SIMD::Splat( std::numeric_limits< float >::lowest() );
+			std::uint32_t primitive_count = 0;
+
+			void Encapsulate( const AABB& bounds )
+			{
+				min = SIMD::Min( min, SIMD::Load( &bounds.min[ 0 ] ) );
+				max = SIMD::Max( max, SIMD::Load( &bounds.min[ 2 ] ) );
+			}
+
+			void Encapsulate( const Bin& other )
+			{
+				min = SIMD::Min( min, other.min );
+				max = SIMD::Max( max, other.max );
+				primitive_count += other.primitive_count;
+			}
+
+			/* 0 if empty. */
+			float SurfaceArea() const
+			{
+				float min_lanes[ 4 ], max_lanes[ 4 ];
+				SIMD::Store( min_lanes, min );
+				SIMD::Store( max_lanes, max );
+				return AABB{ Vector3( min_lanes[ 0 ], min_lanes[ 1 ], min_lanes[ 2 ] ), Vector3( max_lanes[ 1 ], max_lanes[ 2 ], max_lanes[ 3 ] ) }.SurfaceArea();
+			}
+		};
+
+		int BinIndex( const float centroid, const float centroid_min, const float bin_scale )
+		{
+			return std::min( BoundingVolumeHierarchy::SPLIT_BIN_COUNT - 1, int( ( centroid - centroid_min ) * bin_scale ) );
+		}
+
+		/* The cheapest of the split planes between bins, along all axes; nullopt if all centroids coincide. The cost is relative to the node's area.
+		 * All axes are binned in the same pass over the primitives. */
+		std::optional< Split > FindSplit( const BuildPrimitive* primitives, const std::uint32_t primitive_count, const AABB& node_bounds, const AABB& centroid_bounds )
+		{
+			constexpr int bin_count = BoundingVolumeHierarchy::SPLIT_BIN_COUNT;
+
+			const float node_area		  = node_bounds.SurfaceArea();
+			const float node_area_inverse = node_area > 0.0f ? 1.0f / node_area : 0.0f;
+
+			/* A scale of 0 puts all primitives into bin 0 for axes along which the centroids do not spread; those are skipped below. */
+			float bin_scale_list[ 3 ];
+			for( int axis = 0; axis < 3; axis++ )
+			{
+				const float centroid_extent = centroid_bounds.max[ axis ] - centroid_bounds.min[ axis ];
+				bin_scale_list[ axis ] = centroid_extent > 0.0f ? bin_count / centroid_extent : 0.0f;
+			}
+
+			std::array< std::array< Bin, bin_count >, 3 > bin_list;
+			for( std::uint32_t i = 0; i < primitive_count; i++ )
+			{
+				const BuildPrimitive& primitive = primitives[ i ];
+				for( int axis = 0; axis < 3; axis++ )
+				{
+					Bin& bin = bin_list[ axis ][ BinIndex( primitive.centroid[ axis ], centroid_bounds.min[ axis ], bin_scale_list[ axis ] ) ];
+					bin.Encapsulate( primitive.bounds );
+					bin.primitive_count++;
+				}
+			}
+
+			std::optional< Split > best_split;
+			for( int axis = 0; axis < 3; axis++ )
+			{
+				if( bin_scale_list[ axis ] == 0.0f )
+					continue;
+
+				/* Sweep from the right, storing area * count of everything right of each plane, then from the left, completing the costs. */
+				std::array< float, bin_count - 1 > right_cost_list;
+				Bin right;
+				for( int bin = bin_count - 1; bin > 0; bin-- )
+				{
+					right.Encapsulate( bin_list[ axis ][ bin ] );
+					right_cost_list[ bin - 1 ] = right.SurfaceArea() * right.primitive_count;
+				}
+
+				Bin left;
+				for( int bin = 0; bin < bin_count - 1; bin++ )
+				{
+					left.Encapsulate( bin_list[ axis ][ bin ] );
+
+					/* Planes with one side empty do not split anything. */
+					if( left.primitive_count == 0 || left.primitive_count == primitive_count )
+						continue;
+
+					const float cost = TRAVERSAL_COST + ( left.SurfaceArea() * left.primitive_count + right_cost_list[ bin ] ) * node_area_inverse;
+					if( !best_split || cost < best_split->cost )
+						best_split = Split{ axis, bin, cost };
+				}
+			}
+
+			return best_split;
+		}
+	}
+
+	void BoundingVolumeHierarchy::Build( std::span< const AABB > primitive_bounds )
+	{
+		Clear();
+
+		const std::uint32_t primitive_count = ( std::uint32_t )primitive_bounds.size();
+		if( primitive_count == 0 )
+			return;
+
+		std::vector< BuildPrimitive > build_primitive_list( primitive_count );
+		for( std::uint32_t i = 0; i < primitive_count; i++ )
+			build_primitive_list[ i ] = { primitive_bounds[ i ], primitive_bounds[ i ].Center(), i };
+
+		/* A binary tree with at least one primitive per leaf has at most 2n - 1 nodes. */
+		node_list.reserve( 2 * std::size_t( primitive_count ) - 1 );
+		node_list.push_back( {} );
+
+		/* Nodes still to be built & the ranges of build_primitive_list they cover. Children are allocated in pairs, so there is no need for recursion to
+		 * keep subtrees together. */
+		struct Task
+		{
+			std::uint32_t node_index;
+			std::uint32_t begin;
+			std::uint32_t end;
+		};
+
+		std::vector< Task > task_stack{ { 0, 0, primitive_count } };
+		while( !task_stack.empty() )
+		{
+			const Task task = task_stack.back();
+			task_stack.pop_back();
+
+			BuildPrimitive* primitives = build_primitive_list.data() + task.begin;
+			const std::uint32_t count  = task.end - task.begin;
+
+			AABB node_bounds = AABB::Empty(), centroid_bounds = AABB::Empty();
+			for( std::uint32_t i = 0; i < count; i++ )
+			{
+				node_bounds.Encapsulate( primitives[ i ].bounds );
+				centroid_bounds.Encapsulate( primitives[ i ].centroid );
+			}
+
+			const std::optional< Split > split = count > 1 ? FindSplit( primitives, count, node_bounds, centroid_bounds ) : std::nullopt;
+
+			/* Testing all primitives of a leaf costs their count. */
+			const bool is_leaf = count == 1 || ( count <= MAX_PRIMITIVE_COUNT_PER_LEAF && ( !split || split->cost >= float( count ) ) );
+			if( is_leaf )
+			{
+				node_list[ task.node_index ] = { node_bounds, task.begin, count };
+				continue;
+			}
+
+			std::uint32_t middle;
+			if( split )
+			{
+				const int axis			   = split->axis;
+				const float centroid_min   = centroid_bounds.min[ axis ];
+				const float bin_scale	   = SPLIT_BIN_COUNT / ( centroid_bounds.max[ axis ] - centroid_min );
+				const auto partition_point = std::partition( primitives, primitives + count, [ & ]( const BuildPrimitive& primitive )
+				{
+					return BinIndex( primitive.centroid[ axis ], centroid_min, bin_scale ) <= split->bin;
+				} );
+
+				middle = task.begin + std::uint32_t( partition_point - primitives );
+			}
+			else // All centroids coincide & no plane separates them; any halving is as good as another.
+				middle = task.begin + count / 2;
+
+			const std::uint32_t child_index = ( std::uint32_t )node_list.size();
+			node_list[ task.node_index ] = { node_bounds, child_index, 0 };
+			node_list.push_back( {} );
+			node_list.push_back( {} );
+
+			task_stack.push_back( { child_index + 1, middle,	 task.end } );
+			task_stack.push_back( { child_index,	 task.begin, middle	  } );
+		}
+
+		primitive_index_list.resize( primitive_count );
+		primitive_bounds_list.resize( primitive_count );
+		for( std::uint32_t i = 0; i < primitive_count; i++ )
+		{
+			primitive_index_list[ i ]  = build_primitive_list[ i ].index;
+			primitive_bounds_list[ i ] = build_primitive_list[ i ].bounds;
+		}
+	}
+
+	void BoundingVolumeHierarchy::Refit( std::span< const AABB > primitive_bounds )
+	{
+		ASSERT_DEBUG_ONLY( primitive_bounds.size() == primitive_index_list.size() );
+
+		for( std::size_t i = 0; i < primitive_index_list.size(); i++ )
+			primitive_bounds_list[ i ] = primitive_bounds[ primitive_index_list[ i ] ];
+
+		/* Children always come after their parents, so a backwards sweep updates them first. */
+		for( std::size_t node_index = node_list.size(); node_index-- > 0; )
+		{
+			Node& node = node_list[ node_index ];
+			if( node.IsLeaf() )
+			{
+				node.bounds = AABB::Empty();
+				for( std::uint32_t i = 0; i < node.primitive_count; i++ )
+					node.bounds.Encapsulate( primitive_bounds_list[ node.offset + i ] );
+			}
+			else
+			{
+				node.bounds = node_list[ node.offset ].bounds;
+				node.bounds.Encapsulate( node_list[ node.offset + 1 ].bounds );
+			}
+		}
+	}
+
+	void BoundingVolumeHierarchy::Clear()
+	{
+		node_list.clear();
+		primitive_index_list.clear();
+		primitive_bounds_list.clear();
+	}
+
+	std::size_t BoundingVolumeHierarchy::Query( const Frustum& frustum, std::vector< std::uint32_t >& primitive_index_list_out ) const
+	{
+		if( IsEmpty() )
+			return 0;
+
+		const std::size_t count_before = primitive_index_list_out.size();
+
+		/* Each node carries the planes its parent was not entirely inside of; the rest need no testing further down. */
+		struct Entry
+		{
+			std::uint32_t node_index;
+			std::uint8_t plane_mask;
+		};
+
+		std::vector< Entry > stack;
+		stack.reserve( 64 );
+		stack.push_back( { 0, Frustum::ALL_PLANES } );
+		while( !stack.empty() )
+		{
+			auto [ node_index, plane_mask ] = stack.back();
+			stack.pop_back();
+
+			const Node& node = node_list[ node_index ];
+			switch( frustum.Classify( node.bounds, plane_mask ) )
+			{
+				case Frustum::Intersection::Outside:
+					break;
+				case Frustum::Intersection::Inside:
+					AppendPrimitives( node_index, primitive_index_list_out );
+					break;
+				case Frustum::Intersection::Intersecting:
+					if( node.IsLeaf() )
+					{
+						for( std::uint32_t i = node.offset; i < node.offset + node.primitive_count; i++ )
+						{
+							std::uint8_t primitive_plane_mask = plane_mask;
+							if( node.primitive_count == 1 || frustum.Classify( primitive_bounds_list[ i ], primitive_plane_mask ) != Frustum::Intersection::Outside )
+								primitive_index_list_out.push_back( primitive_index_list[ i ] );
+						}
+					}
+					else
+					{
+						stack.push_back( { node.offset + 1, plane_mask } );
+						stack.push_back( { node.offset,		plane_mask } );
+					}
+					break;
+			}
+		}
+
+		return primitive_index_list_out.size() - count_before;
+	}
+
+	std::optional< BoundingVolumeHierarchy::RayHit > BoundingVolumeHierarchy::Raycast( const Ray& ray, const float max_distance ) const
+	{
+		if( IsEmpty() )
+			return std::nullopt;
+
+		const Vector3 direction_inverse( 1.0f / ray.direction.X(), 1.0f / ray.direction.Y(), 1.0f / ray.direction.Z() );
+
+		std::optional< RayHit > closest_hit;
+		float closest_distance = max_distance;
+
+		/* Nodes to visit & the distance at which the ray enters them; nearer children are visited first, so that hits found early prune the farther ones. */
+		struct Entry
+		{
+			std::uint32_t node_index;
+			float distance;
+		};
+
+		const auto root_distance = node_list.front().bounds.Intersect( ray, direction_inverse, closest_distance );
+		if( !root_distance )
+			return std::nullopt;
+
+		std::vector< Entry > stack;
+		stack.reserve( 64 );
+		stack.push_back( { 0, *root_distance } );
+		while( !stack.empty() )
+		{
+			const Entry entry = stack.back();
+			stack.pop_back();
+
+			if( entry.distance > closest_distance )
+				continue;
+
+			const Node& node = node_list[ entry.node_index ];
+			if( node.IsLeaf() )
+			{
+				for( std::uint32_t i = node.offset; i < node.offset + node.primitive_count; i++ )
+				{
+					if( const auto distance = primitive_bounds_list[ i ].Intersect( ray, direction_inverse, closest_distance );
+						distance && ( !closest_hit || *distance < closest_distance ) )
+					{
+						closest_hit		 = RayHit{ primitive_index_list[ i ], *distance };
+						closest_distance = *distance;
+					}
+				}
+
+				continue;
+			}
+
+			const auto distance_left  = node_list[ node.offset	   ].bounds.Intersect( ray, direction_inverse, closest_distance );
+			const auto distance_right = node_list[ node.offset + 1 ].bounds.Intersect( ray, direction_inverse, closest_distance );
+			if( distance_left && distance_right )
+			{
+				const bool is_left_nearer = *distance_left <= *distance_right;
+				stack.push_back( is_left_nearer ? Entry{ node.offset + 1, *distance_right } : Entry{ node.offset, *distance_left } );
+				stack.push_back( is_left_nearer ? Entry{ node.offset, *distance_left } : Entry{ node.offset + 1, *distance_right } );
+			}
+			else if( distance_left )
+				stack.push_back( { node.offset, *distance_left } );
+			else if( distance_right )
+				stack.push_back( { node.offset + 1, *distance_right } );
+		}
+
+		return closest_hit;
+	}
+
+	unsigned int BoundingVolumeHierarchy::Depth() const
+	{
+		if( IsEmpty() )
+			return 0;
+
+		unsigned int depth_max = 0;
+		std::vector< std::pair< std::uint32_t, unsigned int > > stack{ { 0, 1 } };
+		while( !stack.empty() )
+		{
+			const auto [ node_index, depth ] = stack.back();
+			stack.pop_back();
+
+			const Node& node = node_list[ node_index ];
+			depth_max = std::max( depth_max, depth );
+			if( !node.IsLeaf() )
+			{
+				stack.push_back( { node.offset,		depth + 1 } );
+				stack.push_back( { node.offset + 1, depth + 1 } );
+			}
+		}
+
+		return depth_max;
+	}
+
+	float BoundingVolumeHierarchy::Cost() const
+	{
+		if( IsEmpty() )
+			return 0.0f;
+
+		/* A ray through a box hits a box inside it with a probability of their area ratio. */
+		double cost = 0.0;
+		for( const auto& node : node_list )
+			cost += node.bounds.SurfaceArea() * ( node.IsLeaf() ? node.primitive_count : TRAVERSAL_COST );
+
+		const float root_area = node_list.front().bounds.SurfaceArea();
+		return root_area > 0.0f ? float( cost / root_area ) : float( PrimitiveCount() );
+	}
+
+	void BoundingVolumeHierarchy::AppendPrimitives( const std::uint32_t node_index, std::vector< std::uint32_t >& primitive_index_list_out ) const
+	{
+		/* The leftmost & rightmost leaves bound the range. */
+		const Node* first = &node_list[ node_index ];
+		while( !first->IsLeaf() )
+			first = &node_list[ first->offset ];
+
+		const Node* last = &node_list[ node_index ];
+		while( !last->IsLeaf() )
+			last = &node_list[ last->offset + 1 ];
+
+		primitive_index_list_out.insert( primitive_index_list_out.end(),
+										 primitive_index_list.begin() + first->offset, primitive_index_list.begin() + last->offset + last->primitive_count );
+	}
+}
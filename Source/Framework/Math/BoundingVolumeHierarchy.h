@@ -0,0 +1,81 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Bounds.h"
+#include "Math/Frustum.h"
+
+// std Includes.
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Framework::Math
+{
+	/* A binary tree of boxes over the bounds of many (mostly static) primitives: queries skip whole subtrees whose boxes fail the test, instead of testing
+	 * every primitive. Built top-down, splitting where the surface area heuristic (SAH) expects the cheapest traversal, & stored as a flat array of
+	 * 32 byte nodes with siblings next to each other, so that traversal touches one cache line per pair of children. */
+	class BoundingVolumeHierarchy
+	{
+	public:
+		static constexpr std::uint32_t MAX_PRIMITIVE_COUNT_PER_LEAF = 4;
+		/* Candidate split planes per axis; centroids are sorted into this many equal-width bins instead of fully sorted. */
+		static constexpr int SPLIT_BIN_COUNT = 16;
+
+		/* Leaves:	   primitive_count primitives, starting at offset in tree order.
+		 * Inner nodes: primitive_count == 0; children at offset & offset + 1. */
+		struct Node
+		{
+			AABB bounds;
+			std::uint32_t offset;
+			std::uint32_t primitive_count;
+
+			inline bool IsLeaf() const { return primitive_count != 0; }
+		};
+
+		struct RayHit
+		{
+			std::uint32_t primitive_index;
+			float distance;
+		};
+
+	public:
+		BoundingVolumeHierarchy() = default;
+
+		/* Primitives are identified by their index into primitive_bounds. Unbounded() primitives work but defeat the purpose; leave them out & test them
+		 * separately. */
+		void Build( std::span< const AABB > primitive_bounds );
+		/* Updates the boxes of all nodes after primitives moved, keeping the tree's structure: linear & much cheaper than Build(), but queries slow down as
+		 * primitives drift away from the neighbors they were grouped with; rebuild then. Expects the primitives of the last Build(), in the same order. */
+		void Refit( std::span< const AABB > primitive_bounds );
+		void Clear();
+
+		/* Appends the indices of the primitives whose bounds are (conservatively, as Frustum::IsVisible()) inside the frustum. Returns the number appended. */
+		std::size_t Query( const Frustum& frustum, std::vector< std::uint32_t >& primitive_index_list_out ) const;
+		/* The primitive whose bounds the ray enters first, within max_distance; e.g., for picking. Boxes are all that is tested, so test the actual geometry
+		 * afterwards if they are too coarse. */
+		std::optional< RayHit > Raycast( const Ray& ray, const float max_distance = std::numeric_limits< float >::max() ) const;
+
+		inline bool IsEmpty() const { return node_list.empty(); }
+		inline std::size_t PrimitiveCount() const { return primitive_index_list.size(); }
+		inline std::size_t NodeCount() const { return node_list.size(); }
+		inline const std::vector< Node >& GetNodes() const { return node_list; }
+
+		/* Longest path from the root to a leaf, in nodes. */
+		unsigned int Depth() const;
+		/* The SAH's expected cost of a ray through the root's box (node visits & primitive tests costing 1 each); lower is better, the primitive count for a
+		 * flat list. */
+		float Cost() const;
+
+	private:
+		/* Of the subtree of the given node, which is a contiguous range in tree order. */
+		void AppendPrimitives( const std::uint32_t node_index, std::vector< std::uint32_t >& primitive_index_list_out ) const;
+
+	private:
+		std::vector< Node > node_list;
+		/* In tree order. */
+		std::vector< std::uint32_t > primitive_index_list;
+		std::vector< AABB > primitive_bounds_list;
+	};
+}
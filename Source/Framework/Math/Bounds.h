@@ -0,0 +1,133 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+// std Includes.
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <span>
+
+namespace Framework::Math
+{
+	/* The direction does not have to be normalized; distances along the ray are then in multiples of its length. */
+	struct Ray
+	{
+		Vector3 origin;
+		Vector3 direction;
+
+		Vector3 At( const float distance ) const { return origin + direction * distance; }
+	};
+
+	struct BoundingSphere
+	{
+		Vector3 center;
+		float radius;
+	};
+
+	/* Axis-aligned bounding box. Exactly 6 consecutive floats (min, then max), which the SIMD kernels of Frustum rely on. */
+	struct AABB
+	{
+		Vector3 min;
+		Vector3 max;
+
+		static AABB FromPoints( std::span< const Vector3 > points )
+		{
+			AABB bounds = Empty();
+			for( const auto& point : points )
+				bounds.Encapsulate( point );
+
+			return bounds;
+		}
+
+		/* Inside out (min > max); the starting point for growing a box with Encapsulate(). */
+		static AABB Empty()
+		{
+			return { Vector3( UNIFORM_INITIALIZATION, std::numeric_limits< float >::max() ), Vector3( UNIFORM_INITIALIZATION, std::numeric_limits< float >::lowest() ) };
+		}
+
+		/* Contains everything; stands in for objects without bounds, so that they are never culled. Finite, so that the culling arithmetic stays free of NaNs. */
+		static AABB Unbounded()
+		{
+			return { Vector3( UNIFORM_INITIALIZATION, std::numeric_limits< float >::lowest() ), Vector3( UNIFORM_INITIALIZATION, std::numeric_limits< float >::max() ) };
+		}
+
+		void Encapsulate( const Vector3& point )
+		{
+			for( int axis = 0; axis < 3; axis++ )
+			{
+				min[ axis ] = std::min( min[ axis ], point[ axis ] );
+				max[ axis ] = std::max( max[ axis ], point[ axis ] );
+			}
+		}
+
+		void Encapsulate( const AABB& other )
+		{
+			for( int axis = 0; axis < 3; axis++ )
+			{
+				min[ axis ] = std::min( min[ axis ], other.min[ axis ] );
+				max[ axis ] = std::max( max[ axis ], other.max[ axis ] );
+			}
+		}
+
+		Vector3 Center() const { return ( min + max ) * 0.5f; }
+		/* Half the size along each axis. */
+		Vector3 Extents() const { return ( max - min ) * 0.5f; }
+
+		/* 0 for Empty() boxes. */
+		float SurfaceArea() const
+		{
+			const Vector3 size = max - min;
+			return size.X() < 0.0f ? 0.0f : 2.0f * ( size.X() * size.Y() + size.Y() * size.Z() + size.Z() * size.X() );
+		}
+
+		/* Slab test; direction_inverse: 1 / ray.direction, per axis (infinities for zero components are fine). Returns the distance at which the ray enters
+		 * the box (0 if it starts inside) if that is within [0, max_distance]. */
+		std::optional< float > Intersect( const Ray& ray, const Vector3& direction_inverse, const float max_distance = std::numeric_limits< float >::max() ) const
+		{
+			float distance_enter = 0.0f, distance_exit = max_distance;
+			for( int axis = 0; axis < 3; axis++ )
+			{
+				const float distance_min = ( min[ axis ] - ray.origin[ axis ] ) * direction_inverse[ axis ];
+				const float distance_max = ( max[ axis ] - ray.origin[ axis ] ) * direction_inverse[ axis ];
+
+				distance_enter = std::max( distance_enter, std::min( distance_min, distance_max ) );
+				distance_exit  = std::min( distance_exit,  std::max( distance_min, distance_max ) );
+			}
+
+			if( distance_enter > distance_exit )
+				return std::nullopt;
+
+			return distance_enter;
+		}
+
+		/* The smallest box enclosing this one transformed by an affine matrix (row vectors; point * transform): Each axis of the result gathers the absolute
+		 * contributions of the source extents along that axis (Arvo's method), which is exact for the box's corners, without transforming all 8 of them. */
+		AABB Transformed( const Matrix4x4& transform ) const
+		{
+			const Vector3 center  = Center();
+			const Vector3 extents = Extents();
+
+			Vector3 center_transformed, extents_transformed;
+			for( int column = 0; column < 3; column++ )
+			{
+				center_transformed[ column ] = transform[ 3 ][ column ];
+				for( int row = 0; row < 3; row++ )
+				{
+					center_transformed[ column ]  += center[ row ] * transform[ row ][ column ];
+					extents_transformed[ column ] += extents[ row ] * std::abs( transform[ row ][ column ] );
+				}
+			}
+
+			return { center_transformed - extents_transformed, center_transformed + extents_transformed };
+		}
+
+		/* Encloses the box; looser than the box for anything but cubes. */
+		BoundingSphere ToBoundingSphere() const { return { Center(), Extents().Magnitude() }; }
+	};
+
+	static_assert( sizeof( AABB ) == 6 * sizeof( float ), "Math::AABB: Has to be 6 consecutive floats." );
+}
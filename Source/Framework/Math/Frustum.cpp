@@ -0,0 +1,173 @@
+// Framework Includes.
+#include "Math/Frustum.h"
+
+#include "Math/SIMD.h"
+
+#include "Core/Assert.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <atomic>
+
+namespace Framework::Math
+{
+	namespace
+	{
+		/* Below this many boxes per batch, the threading overhead outweighs the gain. */
+		constexpr std::size_t MINIMUM_BOX_COUNT_PER_THREAD = 16 * 1024;
+	}
+
+	Frustum::Frustum( const Matrix4x4& view_projection )
+	{
+		/* With clip = point * view_projection, each clip coordinate is the dot product of the point with a column; e.g., -w <= x becomes
+		 * Dot( point, column 3 + column 0 ) >= 0 (Gribb & Hartmann). */
+		const auto column = [ & ]( const int index )
+		{
+			return Vector4( view_projection[ 0 ][ index ], view_projection[ 1 ][ index ], view_projection[ 2 ][ index ], view_projection[ 3 ][ index ] );
+		};
+
+		const Vector4 w = column( 3 );
+		const Vector4 plane_coefficient_list[ 6 ] =
+		{
+			w + column( 0 ), w - column( 0 ),
+			w + column( 1 ), w - column( 1 ),
+			w + column( 2 ), w - column( 2 )
+		};
+
+		for( int i = 0; i < 6; i++ )
+		{
+			const Vector4& coefficients = plane_coefficient_list[ i ];
+			const Vector3 normal( coefficients.X(), coefficients.Y(), coefficients.Z() );
+			const float inverse_length = 1.0f / normal.Magnitude();
+
+			plane_list[ i ] = { normal * inverse_length, coefficients.W() * inverse_length };
+		}
+	}
+
+	bool Frustum::IsVisible( const AABB& box ) const
+	{
+		for( const auto& plane : plane_list )
+		{
+			/* The corner furthest along the normal; if even that one is outside, the whole box is. */
+			const Vector3 corner( plane.normal.X() >= 0.0f ? box.max.X() : box.min.X(),
+								  plane.normal.Y() >= 0.0f ? box.max.Y() : box.min.Y(),
+								  plane.normal.Z() >= 0.0f ? box.max.Z() : box.min.Z() );
+
+			if( plane.SignedDistance( corner ) < 0.0f )
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Frustum::IsVisible( const BoundingSphere& sphere ) const
+	{
+		for( const auto& plane : plane_list )
+			if( plane.SignedDistance( sphere.center ) < -sphere.radius )
+				return false;
+
+		return true;
+	}
+
+	Frustum::Intersection Frustum::Classify( const AABB& box, std::uint8_t& plane_mask ) const
+	{
+		for( int i = 0; i < 6; i++ )
+		{
+			if( !( plane_mask & ( 1 << i ) ) )
+				continue;
+
+			const Plane& plane = plane_list[ i ];
+
+			/* The corners furthest along & against the normal: the box is outside if the former is, inside if the latter is. */
+			Vector3 corner_positive( NO_INITIALIZATION ), corner_negative( NO_INITIALIZATION );
+			for( int axis = 0; axis < 3; axis++ )
+			{
+				const bool is_positive = plane.normal[ axis ] >= 0.0f;
+				corner_positive[ axis ] = is_positive ? box.max[ axis ] : box.min[ axis ];
+				corner_negative[ axis ] = is_positive ? box.min[ axis ] : box.max[ axis ];
+			}
+
+			if( plane.SignedDistance( corner_positive ) < 0.0f )
+				return Intersection::Outside;
+
+			if( plane.SignedDistance( corner_negative ) >= 0.0f )
+				plane_mask &= ~( 1 << i );
+		}
+
+		return plane_mask == 0 ? Intersection::Inside : Intersection::Intersecting;
+	}
+
+	std::size_t Frustum::Cull( std::span< const AABB > boxes, std::span< std::uint8_t > visibility_list, const Threading threading ) const
+	{
+		ASSERT_DEBUG_ONLY( visibility_list.size() >= boxes.size() );
+
+		const std::size_t count = boxes.size();
+		if( threading == Threading::SingleThreaded || count < 2 * MINIMUM_BOX_COUNT_PER_THREAD )
+			return Cull_Range( boxes.data(), visibility_list.data(), 0, count );
+
+		std::atomic< std::size_t > visible_count = 0;
+		Utility::ThreadPool::Default().ParallelFor( count, MINIMUM_BOX_COUNT_PER_THREAD, [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			visible_count += Cull_Range( boxes.data(), visibility_list.data(), begin, end );
+		} );
+
+		return visible_count;
+	}
+
+	std::size_t Frustum::Cull_Range( const AABB* boxes, std::uint8_t* visibility_list, const std::size_t begin, const std::size_t end ) const
+	{
+		using namespace SIMD;
+
+		std::size_t visible_count = 0;
+
+		std::size_t i = begin;
+		for( ; i + 4 <= end; i += 4 )
+		{
+			/* Each box is 6 floats: min xyz, max xyz. Loading 4 floats at offsets 0 & 2 & transposing gives min x, y, z & max x, y, z of all 4 boxes
+			 * (plus min z & max x once more). */
+			const float* box_0 = &boxes[ i + 0 ].min[ 0 ];
+			const float* box_1 = &boxes[ i + 1 ].min[ 0 ];
+			const float* box_2 = &boxes[ i + 2 ].min[ 0 ];
+			const float* box_3 = &boxes[ i + 3 ].min[ 0 ];
+
+			Float4 min_x = Load( box_0 ), min_y = Load( box_1 ), min_z = Load( box_2 ), max_x_unused = Load( box_3 );
+			Float4 min_z_unused = Load( box_0 + 2 ), max_x = Load( box_1 + 2 ), max_y = Load( box_2 + 2 ), max_z = Load( box_3 + 2 );
+			Transpose( min_x, min_y, min_z, max_x_unused );
+			Transpose( min_z_unused, max_x, max_y, max_z );
+
+			Float4 distance_minimum = Splat( std::numeric_limits< float >::max() );
+			for( const auto& plane : plane_list )
+			{
+				/* The corner furthest along the normal; the choice is per plane, hence the same for all lanes. */
+				const Float4 corner_x = plane.normal.X() >= 0.0f ? max_x : min_x;
+				const Float4 corner_y = plane.normal.Y() >= 0.0f ? max_y : min_y;
+				const Float4 corner_z = plane.normal.Z() >= 0.0f ? max_z : min_z;
+
+				Float4 distance = MultiplyAdd( corner_x, Splat( plane.normal.X() ), Splat( plane.offset ) );
+				distance = MultiplyAdd( corner_y, Splat( plane.normal.Y() ), distance );
+				distance = MultiplyAdd( corner_z, Splat( plane.normal.Z() ), distance );
+
+				distance_minimum = Min( distance_minimum, distance );
+			}
+
+			float distance_minimum_list[ 4 ];
+			Store( distance_minimum_list, distance_minimum );
+			for( int lane = 0; lane < 4; lane++ )
+			{
+				const bool is_visible = distance_minimum_list[ lane ] >= 0.0f;
+				visibility_list[ i + lane ] = is_visible;
+				visible_count += is_visible;
+			}
+		}
+
+		for( ; i < end; i++ )
+		{
+			const bool is_visible = IsVisible( boxes[ i ] );
+			visibility_list[ i ] = is_visible;
+			visible_count += is_visible;
+		}
+
+		return visible_count;
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Bounds.h"
+#include "Math/TransformBatch.h"
+
+// std Includes.
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace Framework::Math
+{
+	/* Points with Dot( normal, point ) + offset >= 0 are on the inner side. */
+	struct Plane
+	{
+		Vector3 normal;
+		float offset;
+
+		float SignedDistance( const Vector3& point ) const { return Dot( normal, point ) + offset; }
+	};
+
+	/* The 6 planes bounding the volume a view-projection matrix maps into GL's clip volume (-w <= x, y, z <= w), normals normalized & pointing inward.
+	 * Tests are conservative: a box is only culled if it is entirely outside one of the planes, so boxes near the frustum's edges may pass without being
+	 * visible. */
+	class Frustum
+	{
+	public:
+		enum PlaneIndex
+		{
+			Left, Right, Bottom, Top, Near, Far
+		};
+
+		enum class Intersection
+		{
+			Outside, Intersecting, Inside
+		};
+
+		/* One bit per PlaneIndex. */
+		static constexpr std::uint8_t ALL_PLANES = 0b111111;
+
+	public:
+		/* Row vectors, as everywhere in the framework: clip = point * view_projection; e.g., Camera::GetViewProjectionMatrix(). */
+		explicit Frustum( const Matrix4x4& view_projection );
+
+		inline const Plane& GetPlane( const PlaneIndex index ) const { return plane_list[ index ]; }
+
+		bool IsVisible( const AABB& box ) const;
+		bool IsVisible( const BoundingSphere& sphere ) const;
+
+		/* Tests the planes in plane_mask only & clears the bits of those the box is entirely inside of: boxes contained in this one can then skip them
+		 * (hierarchical culling, see BoundingVolumeHierarchy). Inside once no planes are left. */
+		Intersection Classify( const AABB& box, std::uint8_t& plane_mask ) const;
+
+		/* visibility_list[ i ] = IsVisible( boxes[ i ] ) (1 or 0), 4 boxes at a time: the boxes are transposed into the lanes of SIMD registers & each plane
+		 * is tested against all 4 at once, against the corner furthest along its normal. Large inputs are split across the default thread pool.
+		 * Returns the number of visible boxes. */
+		std::size_t Cull( std::span< const AABB > boxes, std::span< std::uint8_t > visibility_list, const Threading threading = Threading::Automatic ) const;
+
+	private:
+		std::size_t Cull_Range( const AABB* boxes, std::uint8_t* visibility_list, const std::size_t begin, const std::size_t end ) const;
+
+	private:
+		std::array< Plane, 6 > plane_list;
+	};
+}
@@ -5,6 +5,7 @@
 #include "Core/Initialization.h"
 
 #include "Math/Concepts.h"
+#include "Math/SIMD.h"
 #include "Math/TypeTraits.h"
 #include "Math/Vector.hpp"
 
@@ -12,6 +13,7 @@
 
 // std Includes.
 #include <array>
+#include <type_traits>
 
 namespace Framework::Math
 {
@@ -283,9 +285,26 @@ namespace Framework::Math
 
 	/* Arithmetic Operations. */
 
-		/* Matrix-matrix multiplication. */
+		/* Matrix-matrix multiplication. float 4x4 * 4x4 is dispatched to the SIMD kernel when not evaluated at compile-time. */
 		template< std::size_t RowSizeOther, std::size_t ColumnSizeOther >
 		constexpr Matrix< Type, RowSize, ColumnSizeOther > operator* ( const Matrix< Type, RowSizeOther, ColumnSizeOther >& other ) const requires( ColumnSize == RowSizeOther )
+		{
+			if constexpr( std::is_same_v< Type, float > && RowSize == 4 && ColumnSize == 4 && ColumnSizeOther == 4 )
+			{
+				if( !std::is_constant_evaluated() )
+				{
+					Matrix< Type, RowSize, ColumnSizeOther > result( NO_INITIALIZATION );
+					SIMD::Multiply_Matrix4x4( &data[ 0 ][ 0 ], &other.data[ 0 ][ 0 ], &result.data[ 0 ][ 0 ] );
+					return result;
+				}
+			}
+
+			return MultiplyGeneric( other );
+		}
+
+		/* Reference (scalar) matrix-matrix multiplication, used for all types & sizes without a SIMD kernel. */
+		template< std::size_t RowSizeOther, std::size_t ColumnSizeOther >
+		constexpr Matrix< Type, RowSize, ColumnSizeOther > MultiplyGeneric( const Matrix< Type, RowSizeOther, ColumnSizeOther >& other ) const requires( ColumnSize == RowSizeOther )
 		{
 			Matrix< Type, RowSize, ColumnSizeOther > result( ZERO_INITIALIZATION );
 			for( auto i = 0; i < RowSize; i++ )
@@ -342,10 +361,20 @@ namespace Framework::Math
 		Type data[ RowSize ][ ColumnSize ];
 	};
 
-	/* Vector-matrix multiplication. */
+	/* Vector-matrix multiplication. Vector4 * Matrix4x4 is dispatched to the SIMD kernel when not evaluated at compile-time. */
 	template< Concepts::Arithmetic Type_, std::size_t RowSize, std::size_t ColumnSize >
 	constexpr Vector< Type_, RowSize > operator* ( const Vector< Type_, RowSize >& vector, const Matrix< Type_, RowSize, ColumnSize >& matrix )
 	{
+		if constexpr( std::is_same_v< Type_, float > && RowSize == 4 && ColumnSize == 4 )
+		{
+			if( !std::is_constant_evaluated() )
+			{
+				Vector< Type_, RowSize > vector_transformed( NO_INITIALIZATION );
+				SIMD::Multiply_Vector4_Matrix4x4( vector.Data(), &matrix.data[ 0 ][ 0 ], &vector_transformed[ 0 ] );
+				return vector_transformed;
+			}
+		}
+
 		Vector< Type_, RowSize > vector_transformed;
 		for( auto j = 0; j < ColumnSize; j++ )
 			for( auto k = 0; k < RowSize; k++ )
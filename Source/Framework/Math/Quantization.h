@@ -0,0 +1,106 @@
+#pragma once
+
+// std Includes.
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace Framework::Math
+{
+	/* IEEE 754 binary16 (1 sign, 5 exponent & 10 mantissa bits), as read by GL_HALF_FLOAT vertex attributes. Storage only; convert to float for arithmetic.
+	 * Round-to-nearest-even; magnitudes >= 65520 become infinity. The relative error of normal values is <= 2^-11. */
+	struct Half
+	{
+		std::uint16_t bits;
+
+		Half() = default;
+
+		explicit Half( const float value )
+		{
+			const std::uint32_t float_bits = std::bit_cast< std::uint32_t >( value );
+			const std::uint32_t sign	   = ( float_bits >> 16 ) & 0x8000u;
+			std::uint32_t magnitude		   = float_bits & 0x7FFF'FFFFu;
+
+			if( magnitude >= 0x4780'0000u ) // >= 65536, infinity or NaN.
+				bits = std::uint16_t( magnitude > 0x7F80'0000u ? 0x7E00u : 0x7C00u );
+			else if( magnitude < 0x3880'0000u ) // < 2^-14: Half denormal (or zero). Adding 0.5 shifts the mantissa into place & lets the FPU do the rounding.
+				bits = std::uint16_t( std::bit_cast< std::uint32_t >( std::bit_cast< float >( magnitude ) + 0.5f ) - 0x3F00'0000u );
+			else
+			{
+				const std::uint32_t mantissa_is_odd = ( magnitude >> 13 ) & 1u;
+				magnitude += 0xC800'0FFFu; // Re-biases the exponent (15 - 127) & rounds half up; adding mantissa_is_odd turns that into half to even.
+				magnitude += mantissa_is_odd;
+				bits = std::uint16_t( magnitude >> 13 );
+			}
+
+			bits |= std::uint16_t( sign );
+		}
+
+		explicit operator float() const
+		{
+			constexpr std::uint32_t shifted_exponent = 0x7C00u << 13;
+
+			std::uint32_t float_bits	   = std::uint32_t( bits & 0x7FFFu ) << 13;
+			const std::uint32_t exponent = float_bits & shifted_exponent;
+			float_bits += ( 127 - 15 ) << 23;
+
+			if( exponent == shifted_exponent ) // Infinity or NaN.
+				float_bits += ( 128 - 16 ) << 23;
+			else if( exponent == 0 ) // Denormal (or zero): renormalize via the FPU.
+			{
+				float_bits += 1 << 23;
+				float_bits = std::bit_cast< std::uint32_t >( std::bit_cast< float >( float_bits ) - std::bit_cast< float >( 113u << 23 ) );
+			}
+
+			return std::bit_cast< float >( float_bits | ( std::uint32_t( bits & 0x8000u ) << 16 ) );
+		}
+	};
+
+	/* x, y & z as 10-bit & w as 2-bit signed normalized integers in a single 32-bit value, as read by GL_INT_2_10_10_10_REV vertex attributes.
+	 * Uses the GL 4.2+ (& GLES 3.0) conversion, value = max( integer / ( 2^(bits-1) - 1 ), -1 ), which all current drivers implement for GL 3.3 contexts too;
+	 * 0 is exact & the error of x, y & z is <= 1/1022. w can only be -1, 0 or +1 (e.g., tangent handedness). */
+	struct SNorm10_10_10_2
+	{
+		std::uint32_t bits;
+
+		SNorm10_10_10_2() = default;
+
+		SNorm10_10_10_2( const float x, const float y, const float z, const float w )
+			:
+			bits( Pack( x, 511.0f, 0 ) | Pack( y, 511.0f, 10 ) | Pack( z, 511.0f, 20 ) | Pack( w, 1.0f, 30 ) )
+		{}
+
+		float operator[]( const int component_index ) const
+		{
+			const int bit_count = component_index < 3 ? 10 : 2;
+			/* Sign extension: Move the field to the top, then arithmetic shift back down. */
+			const int integer = std::int32_t( bits << ( 32 - bit_count - component_index * 10 ) ) >> ( 32 - bit_count );
+			return std::max( float( integer ) / float( ( 1 << ( bit_count - 1 ) ) - 1 ), -1.0f );
+		}
+
+	private:
+		static std::uint32_t Pack( const float value, const float scale, const int shift )
+		{
+			const int integer = int( std::lround( std::clamp( value, -1.0f, 1.0f ) * scale ) );
+			const std::uint32_t mask = shift == 30 ? 0x3u : 0x3FFu;
+			return ( std::uint32_t( integer ) & mask ) << shift;
+		}
+	};
+
+	/* Unsigned normalized integers of the given type (GL_UNSIGNED_BYTE/GL_UNSIGNED_SHORT with normalized = GL_TRUE); value = integer / max.
+	 * Values are clamped to [0, 1]; the error inside that range is <= 0.5 / max. */
+	template< typename UnsignedInteger >
+	UnsignedInteger QuantizeUNorm( const float value )
+	{
+		constexpr float max = float( UnsignedInteger( ~UnsignedInteger( 0 ) ) );
+		return UnsignedInteger( std::lround( std::clamp( value, 0.0f, 1.0f ) * max ) );
+	}
+
+	template< typename UnsignedInteger >
+	float DequantizeUNorm( const UnsignedInteger integer )
+	{
+		constexpr float max = float( UnsignedInteger( ~UnsignedInteger( 0 ) ) );
+		return float( integer ) / max;
+	}
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+/* Instruction set selection:
+ * AVX2 is opt-in through the compiler flags (for example; /arch:AVX2 on MSVC), SSE2 is always available on x64 and NEON is available on all AArch64 targets.
+ * When none of them are detected, the scalar fallback is used. */
+#if defined( __AVX2__ ) && ( defined( _MSC_VER ) || defined( __FMA__ ) ) // MSVC's /arch:AVX2 implies FMA, other compilers need it explicitly.
+#define FRAMEWORK_SIMD_AVX2
+#define FRAMEWORK_SIMD_SSE
+#elif defined( _M_X64 ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define FRAMEWORK_SIMD_SSE
+#elif defined( __aarch64__ ) || defined( _M_ARM64 )
+#define FRAMEWORK_SIMD_NEON
+#else
+#define FRAMEWORK_SIMD_SCALAR
+#endif
+
+// std Includes.
+#include <utility>
+
+#if defined( FRAMEWORK_SIMD_AVX2 )
+#include <immintrin.h>
+#elif defined( FRAMEWORK_SIMD_SSE )
+#include <emmintrin.h>
+#elif defined( FRAMEWORK_SIMD_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace Framework::Math::SIMD
+{
+	/* Thin wrapper over a 4-wide float register. Kernels are written once on top of these functions & compile down to SSE, NEON or plain scalar code. */
+#if defined( FRAMEWORK_SIMD_SSE )
+	using Float4 = __m128;
+
+	inline Float4 Load( const float* address )									{ return _mm_loadu_ps( address ); }
+	inline void   Store( float* address, const Float4 value )					{ _mm_storeu_ps( address, value ); }
+	inline Float4 Splat( const float value )									{ return _mm_set1_ps( value ); }
+	inline Float4 Add( const Float4 lhs, const Float4 rhs )						{ return _mm_add_ps( lhs, rhs ); }
+	inline Float4 Subtract( const Float4 lhs, const Float4 rhs )				{ return _mm_sub_ps( lhs, rhs ); }
+	inline Float4 Multiply( const Float4 lhs, const Float4 rhs )				{ return _mm_mul_ps( lhs, rhs ); }
+	inline Float4 Min( const Float4 lhs, const Float4 rhs )						{ return _mm_min_ps( lhs, rhs ); }
+	inline Float4 Max( const Float4 lhs, const Float4 rhs )						{ return _mm_max_ps( lhs, rhs ); }
+#if defined( FRAMEWORK_SIMD_AVX2 )
+	inline Float4 MultiplyAdd( const Float4 a, const Float4 b, const Float4 c ) { return _mm_fmadd_ps( a, b, c ); }
+#else
+	inline Float4 MultiplyAdd( const Float4 a, const Float4 b, const Float4 c ) { return _mm_add_ps( _mm_mul_ps( a, b ), c ); }
+#endif
+	template< int Lane >
+	inline Float4 Broadcast( const Float4 value )								{ return _mm_shuffle_ps( value, value, _MM_SHUFFLE( Lane, Lane, Lane, Lane ) ); }
+	inline void   Transpose( Float4& row_0, Float4& row_1, Float4& row_2, Float4& row_3 ) { _MM_TRANSPOSE4_PS( row_0, row_1, row_2, row_3 ); }
+
+#elif defined( FRAMEWORK_SIMD_NEON )
+	using Float4 = float32x4_t;
+
+	inline Float4 Load( const float* address )									{ return vld1q_f32( address ); }
+	inline void   Store( float* address, const Float4 value )					{ vst1q_f32( address, value ); }
+	inline Float4 Splat( const float value )									{ return vdupq_n_f32( value ); }
+	inline Float4 Add( const Float4 lhs, const Float4 rhs )						{ return vaddq_f32( lhs, rhs ); }
+	inline Float4 Subtract( const Float4 lhs, const Float4 rhs )				{ return vsubq_f32( lhs, rhs ); }
+	inline Float4 Multiply( const Float4 lhs, const Float4 rhs )				{ return vmulq_f32( lhs, rhs ); }
+	inline Float4 Min( const Float4 lhs, const Float4 rhs )						{ return vminq_f32( lhs, rhs ); }
+	inline Float4 Max( const Float4 lhs, const Float4 rhs )						{ return vmaxq_f32( lhs, rhs ); }
+	inline Float4 MultiplyAdd( const Float4 a, const Float4 b, const Float4 c ) { return vfmaq_f32( c, a, b ); }
+	template< int Lane >
+	inline Float4 Broadcast( const Float4 value )								{ return vdupq_laneq_f32( value, Lane ); }
+	inline void   Transpose( Float4& row_0, Float4& row_1, Float4& row_2, Float4& row_3 )
+	{
+		const float32x4x2_t rows_01 = vtrnq_f32( row_0, row_1 ); // { r0[0] r1[0] r0[2] r1[2] }, { r0[1] r1[1] r0[3] r1[3] }.
+		const float32x4x2_t rows_23 = vtrnq_f32( row_2, row_3 );
+
+		row_0 = vcombine_f32( vget_low_f32(  rows_01.val[ 0 ] ), vget_low_f32(  rows_23.val[ 0 ] ) );
+		row_1 = vcombine_f32( vget_low_f32(  rows_01.val[ 1 ] ), vget_low_f32(  rows_23.val[ 1 ] ) );
+		row_2 = vcombine_f32( vget_high_f32( rows_01.val[ 0 ] ), vget_high_f32( rows_23.val[ 0 ] ) );
+		row_3 = vcombine_f32( vget_high_f32( rows_01.val[ 1 ] ), vget_high_f32( rows_23.val[ 1 ] ) );
+	}
+
+#else
+	struct Float4 { float lane[ 4 ]; };
+
+	inline Float4 Load( const float* address )									{ return { address[ 0 ], address[ 1 ], address[ 2 ], address[ 3 ] }; }
+	inline void   Store( float* address, const Float4 value )					{ for( int i = 0; i < 4; i++ ) address[ i ] = value.lane[ i ]; }
+	inline Float4 Splat( const float value )									{ return { value, value, value, value }; }
+	inline Float4 Add( const Float4 lhs, const Float4 rhs )						{ Float4 result; for( int i = 0; i < 4; i++ ) result.lane[ i ] = lhs.lane[ i ] + rhs.lane[ i ]; return result; }
+	inline Float4 Subtract( const Float4 lhs, const Float4 rhs )				{ Float4 result; for( int i = 0; i < 4; i++ ) result.lane[ i ] = lhs.lane[ i ] - rhs.lane[ i ]; return result; }
+	inline Float4 Multiply( const Float4 lhs, const Float4 rhs )				{ Float4 result; for( int i = 0; i < 4; i++ ) result.lane[ i ] = lhs.lane[ i ] * rhs.lane[ i ]; return result; }
+	inline Float4 Min( const Float4 lhs, const Float4 rhs )						{ Float4 result; for( int i = 0; i < 4; i++ ) result.lane[ i ] = lhs.lane[ i ] < rhs.lane[ i ] ? lhs.lane[ i ] : rhs.lane[ i ]; return result; }
+	inline Float4 Max( const Float4 lhs, const Float4 rhs )						{ Float4 result; for( int i = 0; i < 4; i++ ) result.lane[ i ] = lhs.lane[ i ] > rhs.lane[ i ] ? lhs.lane[ i ] : rhs.lane[ i ]; return result; }
+	inline Float4 MultiplyAdd( const Float4 a, const Float4 b, const Float4 c ) { Float4 result; for( int i = 0; i < 4; i++ ) result.lane[ i ] = a.lane[ i ] * b.lane[ i ] + c.lane[ i ]; return result; }
+	template< int Lane >
+	inline Float4 Broadcast( const Float4 value )								{ return Splat( value.lane[ Lane ] ); }
+	inline void   Transpose( Float4& row_0, Float4& row_1, Float4& row_2, Float4& row_3 )
+	{
+		Float4* rows[ 4 ] = { &row_0, &row_1, &row_2, &row_3 };
+		for( int i = 0; i < 4; i++ )
+			for( int j = i + 1; j < 4; j++ )
+				std::swap( rows[ i ]->lane[ j ], rows[ j ]->lane[ i ] );
+	}
+#endif
+
+	/* Name of the instruction set the kernels below were compiled for. */
+	constexpr const char* InstructionSetName()
+	{
+	#if defined( FRAMEWORK_SIMD_AVX2 )
+		return "AVX2";
+	#elif defined( FRAMEWORK_SIMD_SSE )
+		return "SSE2";
+	#elif defined( FRAMEWORK_SIMD_NEON )
+		return "NEON";
+	#else
+		return "Scalar";
+	#endif
+	}
+
+	/* Row-major, post-multiplication: result = row_vector * matrix.
+	 * The result is a linear combination of the matrix' rows, weighted by the vector's components. */
+	inline void Multiply_Vector4_Matrix4x4( const float* vector, const float* matrix, float* result )
+	{
+		const Float4 row_0 = Load( matrix +  0 );
+		const Float4 row_1 = Load( matrix +  4 );
+		const Float4 row_2 = Load( matrix +  8 );
+		const Float4 row_3 = Load( matrix + 12 );
+
+		const Float4 v = Load( vector );
+
+		Float4 accumulator = Multiply( Broadcast< 0 >( v ), row_0 );
+		accumulator = MultiplyAdd( Broadcast< 1 >( v ), row_1, accumulator );
+		accumulator = MultiplyAdd( Broadcast< 2 >( v ), row_2, accumulator );
+		accumulator = MultiplyAdd( Broadcast< 3 >( v ), row_3, accumulator );
+
+		Store( result, accumulator );
+	}
+
+	/* Row-major: result = lhs * rhs. Each row of the result is the corresponding row of lhs transformed by rhs.
+	 * result must not alias lhs or rhs. */
+	inline void Multiply_Matrix4x4( const float* lhs, const float* rhs, float* result )
+	{
+	#if defined( FRAMEWORK_SIMD_AVX2 )
+		/* Process two rows of lhs per iteration, one in each 128-bit lane. */
+		const __m256 rhs_row_0 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhs +  0 ) );
+		const __m256 rhs_row_1 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhs +  4 ) );
+		const __m256 rhs_row_2 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhs +  8 ) );
+		const __m256 rhs_row_3 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( rhs + 12 ) );
+
+		for( int row_pair = 0; row_pair < 2; row_pair++ )
+		{
+			const __m256 lhs_rows = _mm256_loadu_ps( lhs + row_pair * 8 );
+
+			__m256 accumulator = _mm256_mul_ps( _mm256_permute_ps( lhs_rows, _MM_SHUFFLE( 0, 0, 0, 0 ) ), rhs_row_0 );
+			accumulator = _mm256_fmadd_ps( _mm256_permute_ps( lhs_rows, _MM_SHUFFLE( 1, 1, 1, 1 ) ), rhs_row_1, accumulator );
+			accumulator = _mm256_fmadd_ps( _mm256_permute_ps( lhs_rows, _MM_SHUFFLE( 2, 2, 2, 2 ) ), rhs_row_2, accumulator );
+			accumulator = _mm256_fmadd_ps( _mm256_permute_ps( lhs_rows, _MM_SHUFFLE( 3, 3, 3, 3 ) ), rhs_row_3, accumulator );
+
+			_mm256_storeu_ps( result + row_pair * 8, accumulator );
+		}
+	#else
+		Multiply_Vector4_Matrix4x4( lhs +  0, rhs, result +  0 );
+		Multiply_Vector4_Matrix4x4( lhs +  4, rhs, result +  4 );
+		Multiply_Vector4_Matrix4x4( lhs +  8, rhs, result +  8 );
+		Multiply_Vector4_Matrix4x4( lhs + 12, rhs, result + 12 );
+	#endif
+	}
+}
@@ -0,0 +1,182 @@
+// Framework Includes.
+#include "Math/TransformBatch.h"
+
+#include "Math/SIMD.h"
+
+#include "Core/Assert.h"
+
+#include "Utility/ThreadPool.h"
+
+namespace Framework::Math
+{
+	namespace Detail
+	{
+		/* Below this many elements per batch, the threading overhead outweighs the gain. */
+		constexpr std::size_t MINIMUM_ELEMENT_COUNT_PER_THREAD = 16 * 1024;
+
+		template< typename Kernel >
+		void Dispatch( const std::size_t count, const Threading threading, Kernel&& kernel )
+		{
+			if( threading == Threading::Automatic && count >= 2 * MINIMUM_ELEMENT_COUNT_PER_THREAD )
+				Utility::ThreadPool::Default().ParallelFor( count, MINIMUM_ELEMENT_COUNT_PER_THREAD, kernel );
+			else
+				kernel( 0, count );
+		}
+
+		template< bool IsPoint >
+		void Transform_AoS( const Vector3* input, Vector3* output, const std::size_t begin, const std::size_t end, const Matrix4x4& transform )
+		{
+			using namespace SIMD;
+
+			const float* matrix = transform.Data();
+			const Float4 row_0 = Load( matrix + 0 );
+			const Float4 row_1 = Load( matrix + 4 );
+			const Float4 row_2 = Load( matrix + 8 );
+			const Float4 row_3 = Load( matrix + 12 );
+
+			float result[ 4 ];
+
+			for( std::size_t i = begin; i < end; i++ )
+			{
+				const Vector3& vector = input[ i ];
+
+				Float4 accumulator = IsPoint
+										? MultiplyAdd( Splat( vector.X() ), row_0, row_3 )
+										: Multiply( Splat( vector.X() ), row_0 );
+				accumulator = MultiplyAdd( Splat( vector.Y() ), row_1, accumulator );
+				accumulator = MultiplyAdd( Splat( vector.Z() ), row_2, accumulator );
+
+				/* Vector3 is 12 bytes; store through a temporary to not write past the element (or the buffer). */
+				Store( result, accumulator );
+				output[ i ] = Vector3( result[ 0 ], result[ 1 ], result[ 2 ] );
+			}
+		}
+
+		template< bool IsPoint >
+		void Transform_AoS( const Vector4* input, Vector4* output, const std::size_t begin, const std::size_t end, const Matrix4x4& transform )
+		{
+			using namespace SIMD;
+
+			const float* matrix = transform.Data();
+			const Float4 row_0 = Load( matrix + 0 );
+			const Float4 row_1 = Load( matrix + 4 );
+			const Float4 row_2 = Load( matrix + 8 );
+			const Float4 row_3 = Load( matrix + 12 );
+
+			for( std::size_t i = begin; i < end; i++ )
+			{
+				const Float4 vector = Load( input[ i ].Data() );
+
+				Float4 accumulator = Multiply( Broadcast< 0 >( vector ), row_0 );
+				accumulator = MultiplyAdd( Broadcast< 1 >( vector ), row_1, accumulator );
+				accumulator = MultiplyAdd( Broadcast< 2 >( vector ), row_2, accumulator );
+				if constexpr( IsPoint )
+					accumulator = MultiplyAdd( Broadcast< 3 >( vector ), row_3, accumulator );
+
+				Store( &output[ i ][ 0 ], accumulator );
+			}
+		}
+
+		/* Processes 4 elements per iteration: Each lane holds a different element, so there is no shuffling at all. */
+		template< bool IsPoint >
+		void Transform_SoA( const float* x, const float* y, const float* z, float* x_out, float* y_out, float* z_out,
+							const std::size_t begin, const std::size_t end, const Matrix4x4& transform )
+		{
+			using namespace SIMD;
+
+			const Float4 m00 = Splat( transform[ 0 ][ 0 ] ), m01 = Splat( transform[ 0 ][ 1 ] ), m02 = Splat( transform[ 0 ][ 2 ] );
+			const Float4 m10 = Splat( transform[ 1 ][ 0 ] ), m11 = Splat( transform[ 1 ][ 1 ] ), m12 = Splat( transform[ 1 ][ 2 ] );
+			const Float4 m20 = Splat( transform[ 2 ][ 0 ] ), m21 = Splat( transform[ 2 ][ 1 ] ), m22 = Splat( transform[ 2 ][ 2 ] );
+			const Float4 m30 = Splat( IsPoint ? transform[ 3 ][ 0 ] : 0.0f ),
+						 m31 = Splat( IsPoint ? transform[ 3 ][ 1 ] : 0.0f ),
+						 m32 = Splat( IsPoint ? transform[ 3 ][ 2 ] : 0.0f );
+
+			std::size_t i = begin;
+			for( ; i + 4 <= end; i += 4 )
+			{
+				const Float4 x_4 = Load( x + i );
+				const Float4 y_4 = Load( y + i );
+				const Float4 z_4 = Load( z + i );
+
+				Store( x_out + i, MultiplyAdd( z_4, m20, MultiplyAdd( y_4, m10, MultiplyAdd( x_4, m00, m30 ) ) ) );
+				Store( y_out + i, MultiplyAdd( z_4, m21, MultiplyAdd( y_4, m11, MultiplyAdd( x_4, m01, m31 ) ) ) );
+				Store( z_out + i, MultiplyAdd( z_4, m22, MultiplyAdd( y_4, m12, MultiplyAdd( x_4, m02, m32 ) ) ) );
+			}
+
+			/* Remainder. */
+			const float translation_x = IsPoint ? transform[ 3 ][ 0 ] : 0.0f;
+			const float translation_y = IsPoint ? transform[ 3 ][ 1 ] : 0.0f;
+			const float translation_z = IsPoint ? transform[ 3 ][ 2 ] : 0.0f;
+
+			for( ; i < end; i++ )
+			{
+				const float x_i = x[ i ], y_i = y[ i ], z_i = z[ i ];
+
+				x_out[ i ] = x_i * transform[ 0 ][ 0 ] + y_i * transform[ 1 ][ 0 ] + z_i * transform[ 2 ][ 0 ] + translation_x;
+				y_out[ i ] = x_i * transform[ 0 ][ 1 ] + y_i * transform[ 1 ][ 1 ] + z_i * transform[ 2 ][ 1 ] + translation_y;
+				z_out[ i ] = x_i * transform[ 0 ][ 2 ] + y_i * transform[ 1 ][ 2 ] + z_i * transform[ 2 ][ 2 ] + translation_z;
+			}
+		}
+
+		template< bool IsPoint, typename VectorType >
+		void Transform_AoS( std::span< const VectorType > input, std::span< VectorType > output, const Matrix4x4& transform, const Threading threading )
+		{
+			ASSERT_DEBUG_ONLY( output.size() >= input.size() );
+
+			Dispatch( input.size(), threading, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				Transform_AoS< IsPoint >( input.data(), output.data(), begin, end, transform );
+			} );
+		}
+
+		template< bool IsPoint >
+		void Transform_SoA( std::span< const float > x, std::span< const float > y, std::span< const float > z,
+							std::span< float > x_transformed, std::span< float > y_transformed, std::span< float > z_transformed,
+							const Matrix4x4& transform, const Threading threading )
+		{
+			ASSERT_DEBUG_ONLY( y.size() == x.size() && z.size() == x.size() );
+			ASSERT_DEBUG_ONLY( x_transformed.size() >= x.size() && y_transformed.size() >= x.size() && z_transformed.size() >= x.size() );
+
+			Dispatch( x.size(), threading, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				Transform_SoA< IsPoint >( x.data(), y.data(), z.data(), x_transformed.data(), y_transformed.data(), z_transformed.data(), begin, end, transform );
+			} );
+		}
+	}
+
+	void TransformPoints( std::span< const Vector3 > points, std::span< Vector3 > points_transformed, const Matrix4x4& transform, const Threading threading )
+	{
+		Detail::Transform_AoS< true >( points, points_transformed, transform, threading );
+	}
+
+	void TransformDirections( std::span< const Vector3 > directions, std::span< Vector3 > directions_transformed, const Matrix4x4& transform, const Threading threading )
+	{
+		Detail::Transform_AoS< false >( directions, directions_transformed, transform, threading );
+	}
+
+	void TransformPoints( std::span< const Vector4 > points, std::span< Vector4 > points_transformed, const Matrix4x4& transform, const Threading threading )
+	{
+		Detail::Transform_AoS< true >( points, points_transformed, transform, threading );
+	}
+
+	void TransformDirections( std::span< const Vector4 > directions, std::span< Vector4 > directions_transformed, const Matrix4x4& transform, const Threading threading )
+	{
+		Detail::Transform_AoS< false >( directions, directions_transformed, transform, threading );
+	}
+
+	void TransformPoints( std::span< const float > x, std::span< const float > y, std::span< const float > z,
+						  std::span< float > x_transformed, std::span< float > y_transformed, std::span< float > z_transformed,
+						  const Matrix4x4& transform,
+						  const Threading threading )
+	{
+		Detail::Transform_SoA< true >( x, y, z, x_transformed, y_transformed, z_transformed, transform, threading );
+	}
+
+	void TransformDirections( std::span< const float > x, std::span< const float > y, std::span< const float > z,
+							  std::span< float > x_transformed, std::span< float > y_transformed, std::span< float > z_transformed,
+							  const Matrix4x4& transform,
+							  const Threading threading )
+	{
+		Detail::Transform_SoA< false >( x, y, z, x_transformed, y_transformed, z_transformed, transform, threading );
+	}
+}
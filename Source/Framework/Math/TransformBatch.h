@@ -0,0 +1,49 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+// std Includes.
+#include <span>
+
+namespace Framework::Math
+{
+	enum class Threading
+	{
+		SingleThreaded,
+		Automatic		// Splits large inputs across the default thread pool.
+	};
+
+	/* Batch versions of Vector * Matrix4x4, SIMD-vectorized & optionally multi-threaded.
+	 * Outputs must be at least as large as the inputs. Transforming in-place (output == input) is allowed, partial overlaps are not. */
+
+/* AoS (Array of Structures): */
+
+	/* w is assumed to be 1 & no perspective division is performed, i.e. the transform is expected to be affine. */
+	void TransformPoints( std::span< const Vector3 > points, std::span< Vector3 > points_transformed, const Matrix4x4& transform,
+						  const Threading threading = Threading::Automatic );
+	/* w is assumed to be 0; translation is ignored. */
+	void TransformDirections( std::span< const Vector3 > directions, std::span< Vector3 > directions_transformed, const Matrix4x4& transform,
+							  const Threading threading = Threading::Automatic );
+
+	/* Full 4D transformation, w is taken as is. */
+	void TransformPoints( std::span< const Vector4 > points, std::span< Vector4 > points_transformed, const Matrix4x4& transform,
+						  const Threading threading = Threading::Automatic );
+	/* w is ignored & treated as 0; translation is ignored. */
+	void TransformDirections( std::span< const Vector4 > directions, std::span< Vector4 > directions_transformed, const Matrix4x4& transform,
+							  const Threading threading = Threading::Automatic );
+
+/* SoA (Structure of Arrays): */
+
+	/* w is assumed to be 1 & no perspective division is performed, i.e. the transform is expected to be affine. */
+	void TransformPoints( std::span< const float > x, std::span< const float > y, std::span< const float > z,
+						  std::span< float > x_transformed, std::span< float > y_transformed, std::span< float > z_transformed,
+						  const Matrix4x4& transform,
+						  const Threading threading = Threading::Automatic );
+	/* w is assumed to be 0; translation is ignored. */
+	void TransformDirections( std::span< const float > x, std::span< const float > y, std::span< const float > z,
+							  std::span< float > x_transformed, std::span< float > y_transformed, std::span< float > z_transformed,
+							  const Matrix4x4& transform,
+							  const Threading threading = Threading::Automatic );
+}
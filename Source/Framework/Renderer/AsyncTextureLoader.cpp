@@ -0,0 +1,294 @@
+// Framework Includes.
+#include "Renderer/AsyncTextureLoader.h"
+#include "Renderer/Graphics.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/TextureFile.h"
+
+// Vendor Includes.
+#include "Vendor/stb/stb_image.h"
+
+// std Includes.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+namespace Framework
+{
+	namespace
+	{
+		int ChannelCountOf( const GLenum color_format )
+		{
+			switch( color_format )
+			{
+				case GL_RED:	return 1;
+				case GL_RG:		return 2;
+				case GL_RGB:	return 3;
+				case GL_RGBA:	return 4;
+			}
+
+			throw std::runtime_error( "AsyncTextureLoader: Unsupported color format." );
+		}
+	}
+
+	AsyncTextureLoader::AsyncTextureLoader( const unsigned int upload_budget, Utility::ThreadPool& thread_pool, TextureCache* texture_cache )
+		:
+		thread_pool( thread_pool ),
+		texture_cache( texture_cache ),
+		pixel_unpack_buffer( GL_PIXEL_UNPACK_BUFFER, upload_budget ),
+		upload_budget( upload_budget ),
+		placeholder_id( 0 ),
+		statistics{}
+	{
+		/* Otherwise the placeholder's pixels below would be read from the pixel unpack buffer. */
+		StateCache::Instance().BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+		const unsigned char grey[ 4 ] = { 128, 128, 128, 255 };
+		GLCALL( glGenTextures( 1, &placeholder_id ) );
+		StateCache::Instance().BindTexture( GL_TEXTURE_2D, placeholder_id );
+		Texture::SetParameters();
+		GLCALL( glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey ) );
+	}
+
+	AsyncTextureLoader::~AsyncTextureLoader()
+	{
+		/* Decode tasks still running only touch their own shared state (which outlives the futures), so they need not be waited for. */
+		for( auto* job_list : { &decode_job_list, &upload_job_list } )
+		{
+			for( auto& job : *job_list )
+			{
+				if( auto texture = job.texture.lock() )
+					texture->id = 0;
+
+				if( job.texture_id )
+				{
+					GLCALL( glDeleteTextures( 1, &job.texture_id ) );
+					StateCache::Instance().OnTextureDeleted( job.texture_id );
+				}
+			}
+		}
+
+		GLCALL( glDeleteTextures( 1, &placeholder_id ) );
+		StateCache::Instance().OnTextureDeleted( placeholder_id );
+	}
+
+	std::shared_ptr< Texture > AsyncTextureLoader::Load( const std::string& file_path, const GLenum color_format,
+														 const std::optional< MipmapGenerator::Settings >& mipmap_settings )
+	{
+		const int channel_count = ChannelCountOf( color_format );
+		const bool is_compressed = std::filesystem::path( file_path ).extension() == ".ktx";
+		const std::string cache_key = texture_cache ? TextureCache::KeyOf( file_path, color_format, is_compressed ? std::nullopt : mipmap_settings ) : std::string();
+
+		if( texture_cache )
+			if( auto texture = texture_cache->FindTexture( cache_key ) )
+				return texture;
+
+		if( is_compressed )
+			return LoadCompressed( file_path, cache_key );
+
+		/* Private constructor; hence no make_shared. */
+		std::shared_ptr< Texture > texture( new Texture( placeholder_id ) );
+
+		Job& job = decode_job_list.emplace_back();
+		job.texture				= texture;
+		job.file_path			= file_path;
+		job.cache_key			= cache_key;
+		job.color_format		= color_format;
+		job.texture_id			= 0;
+		job.uploaded_level		= 0;
+		job.uploaded_row_count	= 0;
+
+		if( texture_cache )
+			texture_cache->AddTexture( cache_key, texture );
+
+		if( auto image = texture_cache ? texture_cache->FindImage( cache_key ) : nullptr )
+		{
+			std::promise< std::shared_ptr< const TextureCache::Image > > decoded_image;
+			decoded_image.set_value( std::move( image ) );
+			job.decode_result = decoded_image.get_future();
+			return texture;
+		}
+
+		if( texture_cache )
+			texture_cache->CountMiss();
+
+		job.decode_result = thread_pool.Enqueue( [ file_path, channel_count, mipmap_settings, &thread_pool = thread_pool ]()
+		{
+			/* The global flag is not thread-safe to toggle; Texture's synchronous path sets it too. */
+			stbi_set_flip_vertically_on_load_thread( 1 );
+
+			auto image = std::make_shared< TextureCache::Image >();
+			image->pixels.reset( stbi_load( file_path.c_str(), &image->width, &image->height, &image->channels_in_file, channel_count ) );
+			image->channel_count = channel_count;
+
+			if( image->pixels && mipmap_settings )
+			{
+				/* Level 0 is the decoded image itself. */
+				image->mip_level_list = MipmapGenerator::Generate( image->pixels.get(), image->width, image->height, channel_count, *mipmap_settings, thread_pool );
+				image->mip_level_list.erase( image->mip_level_list.begin() );
+			}
+
+			return std::shared_ptr< const TextureCache::Image >( image->pixels ? std::move( image ) : nullptr );
+		} );
+
+		return texture;
+	}
+
+	std::shared_ptr< Texture > AsyncTextureLoader::LoadCompressed( const std::string& file_path, const std::string& cache_key )
+	{
+		const TextureFile texture_file( file_path );
+
+		auto texture = std::make_shared< Texture >( texture_file );
+		if( !texture->IsLoaded() )
+		{
+			/* Like images that fail to decode: The placeholder stays. */
+			statistics.failed_count++;
+			return std::shared_ptr< Texture >( new Texture( placeholder_id ) );
+		}
+
+		statistics.loaded_count++;
+		statistics.uploaded_byte_count += texture_file.DataSize();
+
+		if( texture_cache )
+			texture_cache->AddTexture( cache_key, texture );
+
+		return texture;
+	}
+
+	void AsyncTextureLoader::Update()
+	{
+		CollectDecodedImages();
+
+		if( upload_job_list.empty() )
+			return;
+
+		const unsigned int frame_budget = std::max( upload_budget, RowSize( upload_job_list.front() ) );
+		pixel_unpack_buffer.Reserve( frame_budget );
+		pixel_unpack_buffer.BeginFrame();
+
+		/* Rows are copied tightly packed. */
+		GLCALL( glPixelStorei( GL_UNPACK_ALIGNMENT, 1 ) );
+
+		unsigned int budget_left = frame_budget;
+
+		while( !upload_job_list.empty() )
+		{
+			Job& job = upload_job_list.front();
+
+			if( job.texture.expired() )
+			{
+				GLCALL( glDeleteTextures( 1, &job.texture_id ) );
+				StateCache::Instance().OnTextureDeleted( job.texture_id );
+			}
+			else if( !Upload( job, budget_left ) )
+				break;
+
+			upload_job_list.pop_front();
+		}
+
+		if( budget_left != frame_budget )
+			statistics.upload_frame_count++;
+
+		GLCALL( glPixelStorei( GL_UNPACK_ALIGNMENT, 4 ) );
+		StateCache::Instance().BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+		pixel_unpack_buffer.EndFrame();
+	}
+
+	void AsyncTextureLoader::CollectDecodedImages()
+	{
+		/* Keeps the request order among the jobs still decoding; finished ones are uploaded in the order they finish. */
+		for( auto iterator = decode_job_list.begin(); iterator != decode_job_list.end(); )
+		{
+			if( iterator->decode_result.wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready )
+			{
+				++iterator;
+				continue;
+			}
+
+			Job& job = *iterator;
+			job.image = job.decode_result.get();
+
+			if( !job.image )
+			{
+				std::cerr << "ERROR::TEXTURE::COULD_NOT_READ_FROM_FILE: " << job.file_path << "\n";
+				statistics.failed_count++;
+			}
+			else if( texture_cache )
+				texture_cache->AddImage( job.cache_key, job.image );
+
+			if( job.image && !job.texture.expired() )
+			{
+				/* Storage only; no pixel unpack buffer may be bound here, as the null pointer would be taken as an offset into it. */
+				GLCALL( glGenTextures( 1, &job.texture_id ) );
+				StateCache::Instance().BindTexture( GL_TEXTURE_2D, job.texture_id );
+				Texture::SetParameters();
+				for( int level = 0; level < job.image->LevelCount(); level++ )
+					GLCALL( glTexImage2D( GL_TEXTURE_2D, level, job.color_format, job.image->LevelWidth( level ), job.image->LevelHeight( level ), 0,
+										  job.color_format, GL_UNSIGNED_BYTE, nullptr ) );
+
+				upload_job_list.push_back( std::move( job ) );
+			}
+
+			iterator = decode_job_list.erase( iterator );
+		}
+	}
+
+	bool AsyncTextureLoader::Upload( Job& job, unsigned int& budget_left )
+	{
+		const TextureCache::Image& image = *job.image;
+
+		while( job.uploaded_level < image.LevelCount() )
+		{
+			const int level_width  = image.LevelWidth( job.uploaded_level );
+			const int level_height = image.LevelHeight( job.uploaded_level );
+
+			const unsigned int row_size = RowSize( job );
+			const int row_count			= std::min( level_height - job.uploaded_row_count, int( budget_left / row_size ) );
+			if( row_count == 0 )
+				return false;
+
+			const unsigned int byte_count = row_count * row_size;
+			const auto allocation = pixel_unpack_buffer.Allocate( byte_count, 1 );
+			if( !allocation.data )
+				return false;
+
+			std::memcpy( allocation.data, image.LevelPixels( job.uploaded_level ) + std::size_t( job.uploaded_row_count ) * row_size, byte_count );
+			pixel_unpack_buffer.Commit( allocation );
+
+			/* With a pixel unpack buffer bound, the pixel pointer is an offset into it. */
+			pixel_unpack_buffer.Bind();
+			StateCache::Instance().BindTexture( GL_TEXTURE_2D, job.texture_id );
+			GLCALL( glTexSubImage2D( GL_TEXTURE_2D, job.uploaded_level, 0, job.uploaded_row_count, level_width, row_count, job.color_format, GL_UNSIGNED_BYTE,
+									 reinterpret_cast< const void* >( std::uintptr_t( allocation.offset ) ) ) );
+
+			job.uploaded_row_count			+= row_count;
+			budget_left						-= byte_count;
+			statistics.uploaded_byte_count	+= byte_count;
+
+			if( job.uploaded_row_count < level_height )
+				return false;
+
+			job.uploaded_level++;
+			job.uploaded_row_count = 0;
+		}
+
+		if( image.mip_level_list.empty() )
+			GLCALL( glGenerateMipmap( GL_TEXTURE_2D ) );
+
+		job.texture.lock()->OnLoaded( job.texture_id, image.width, image.height, image.channels_in_file );
+		job.texture_id = 0;
+		job.image.reset();
+
+		statistics.loaded_count++;
+		return true;
+	}
+
+	unsigned int AsyncTextureLoader::RowSize( const Job& job ) const
+	{
+		return job.image->LevelWidth( job.uploaded_level ) * ChannelCountOf( job.color_format );
+	}
+}
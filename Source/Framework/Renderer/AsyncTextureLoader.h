@@ -0,0 +1,112 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/StreamingBuffer.h"
+#include "Renderer/Texture.h"
+#include "Renderer/TextureCache.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <deque>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace Framework
+{
+	/* Loads textures without blocking the render thread. Load() returns right away with a Texture that shows a 1x1 grey placeholder; the image is
+	 * decoded on a thread pool & Update() (once per frame) uploads decoded images through a pixel unpack buffer (a StreamingBuffer), at most
+	 * upload_budget bytes per frame, so that loading many images spreads over several frames instead of causing one long hitch.
+	 * Textures destroyed before they finish loading are skipped. Textures that failed to load keep showing the placeholder, so the loader has to
+	 * outlive them; textures still loading when the loader is destroyed end up with ID() 0.
+	 * With a TextureCache, loads of textures that are still alive return them as they are & released textures are re-uploaded from cached pixels. */
+	class AsyncTextureLoader
+	{
+	public:
+		static constexpr unsigned int DEFAULT_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+		struct Statistics
+		{
+			std::size_t loaded_count;
+			std::size_t failed_count;
+			std::size_t uploaded_byte_count;
+			/* Calls to Update() that uploaded anything. */
+			std::size_t upload_frame_count;
+		};
+
+	public:
+		/* Textures are uploaded in whole rows; a single row is uploaded even if it exceeds the budget, so that every texture makes progress.
+		 * texture_cache: nullptr disables caching; every Load() then decodes. */
+		explicit AsyncTextureLoader( const unsigned int upload_budget = DEFAULT_UPLOAD_BUDGET,
+									 Utility::ThreadPool& thread_pool = Utility::ThreadPool::Default(),
+									 TextureCache* texture_cache = &TextureCache::Instance() );
+		~AsyncTextureLoader();
+
+		AsyncTextureLoader( const AsyncTextureLoader& )				= delete;
+		AsyncTextureLoader& operator= ( const AsyncTextureLoader& )	= delete;
+
+		/* color_format: GL_RED, GL_RG, GL_RGB or GL_RGBA; images are converted to that many channels while decoding.
+		 * mipmap_settings: Generates the mipmaps on the CPU (MipmapGenerator) right after decoding, on the same worker, & uploads them along with
+		 * level 0 (within the same budget); for sRGB textures & alpha-tested ones, which glGenerateMipmap() does not handle. Otherwise the driver
+		 * generates them once level 0 is uploaded.
+		 * Compressed textures (".ktx" files; see TextureFile) are uploaded within this call instead, keeping their own format & levels
+		 * (mipmap_settings is ignored): there is nothing to decode & their precomputed levels are a fraction of the size of a decoded image. */
+		std::shared_ptr< Texture > Load( const std::string& file_path, const GLenum color_format,
+										 const std::optional< MipmapGenerator::Settings >& mipmap_settings = std::nullopt );
+
+		/* Once per frame, on the thread owning the GL context. Leaves GL_PIXEL_UNPACK_BUFFER unbound & GL_UNPACK_ALIGNMENT at its default (4).
+		 * A texture is swapped in once all rows of its levels are uploaded; its mipmaps are generated by the driver then, unless they were generated
+		 * on the CPU & uploaded along with level 0. */
+		void Update();
+
+		/* Textures requested but not swapped in yet (decoding or uploading). */
+		inline std::size_t PendingCount() const { return decode_job_list.size() + upload_job_list.size(); }
+		inline bool IsIdle() const { return PendingCount() == 0; }
+
+		inline unsigned int UploadBudget() const { return upload_budget; }
+
+		inline const Statistics& GetStatistics() const { return statistics; }
+		inline void ResetStatistics() { statistics = {}; }
+
+	private:
+		struct Job
+		{
+			std::weak_ptr< Texture > texture;
+			std::string file_path;
+			std::string cache_key;
+			GLenum color_format;
+			/* Ready right away for images found in the cache. */
+			std::future< std::shared_ptr< const TextureCache::Image > > decode_result;
+
+			/* Once decoded: */
+			std::shared_ptr< const TextureCache::Image > image;
+			unsigned int texture_id; // Receives the uploads; handed over to the Texture when complete.
+			int uploaded_level; // Levels are uploaded in order; there is only level 0 without CPU mipmaps.
+			int uploaded_row_count; // Of uploaded_level.
+		};
+
+		std::shared_ptr< Texture > LoadCompressed( const std::string& file_path, const std::string& cache_key );
+
+		/* Moves decoded images to the upload queue & allocates their textures. */
+		void CollectDecodedImages();
+		/* Returns whether the job is complete. */
+		bool Upload( Job& job, unsigned int& budget_left );
+
+		/* Of the level being uploaded. */
+		unsigned int RowSize( const Job& job ) const;
+
+	private:
+		Utility::ThreadPool& thread_pool;
+		TextureCache* texture_cache;
+		StreamingBuffer pixel_unpack_buffer;
+		unsigned int upload_budget;
+		unsigned int placeholder_id;
+
+		std::deque< Job > decode_job_list;
+		std::deque< Job > upload_job_list;
+
+		Statistics statistics;
+	};
+}
@@ -1,4 +1,5 @@
 // Project Include.
+#include "Math/Math.h"
 #include "Math/Matrix.h"
 
 #include "Renderer/Camera.h"
@@ -98,6 +99,18 @@ namespace Framework
 		return *this;
 	}
 
+	Math::Ray Camera::ScreenPointToRay( const float x, const float y, const float width, const float height )
+	{
+		/* Offsets on the plane at distance 1 in front of the camera, which spans 2 * tan( fov / 2 ) vertically. */
+		const float half_height = Math::Tan( Radians( field_of_view ) / 2.0f );
+		const float half_width	= aspect_ratio * half_height;
+		const float ndc_x		= 2.0f * x / width - 1.0f;
+		const float ndc_y		= 1.0f - 2.0f * y / height;
+
+		const Vector3 direction = Forward() + Right() * ( ndc_x * half_width ) + Up() * ( ndc_y * half_height );
+		return { transform->GetTranslation(), direction.Normalized() };
+	}
+
 	void Camera::SetProjectionMatrixDirty()
 	{
 		projection_matrix_needs_update = true;
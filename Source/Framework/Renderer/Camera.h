@@ -1,6 +1,8 @@
 #pragma once
 
 // Framework Includes.
+#include "Math/Bounds.h"
+
 #include "Scene/Transform.h"
 
 // std Includes.
@@ -34,6 +36,11 @@ namespace Framework
 
 		Camera& SetLookRotation( const Vector3& look_at );
 
+		/* From the camera's position through the given point of the screen, in world space; e.g., for picking. x & y: From the top-left corner (as
+		 * Platform::GetMouseCursorPositions()), in the same units as width & height; i.e., pass the window size in screen coordinates for cursor
+		 * positions, not the framebuffer size, as they differ on HiDPI displays. The direction is normalized. */
+		Math::Ray ScreenPointToRay( const float x, const float y, const float width, const float height );
+
 	private:
 		void SetProjectionMatrixDirty();
 		void SetViewProjectionMatrixDirty();
@@ -4,12 +4,16 @@
 
 namespace Framework
 {
-	Drawable::Drawable( Material* material, Transform* transform, const VertexArray* vertex_array )
+	using namespace Literals;
+
+	Drawable::Drawable( Material* material, Transform* transform, const VertexArray* vertex_array, const RenderPass render_pass )
 		:
 		transform( transform ),
 		material( material ),
 		shader( material->shader ),
-		vertex_array( vertex_array )
+		vertex_array( vertex_array ),
+		render_pass( render_pass ),
+		uniform_handle_transform_world( shader->IsInstanced() ? UniformHandle{} : shader->GetUniformHandle( "transform_world"_uniform ) )
 	{
 	}
 
@@ -17,16 +21,34 @@ namespace Framework
 	{
 	}
 
-	void Drawable::Submit( Camera* camera )
+	void Drawable::Submit()
 	{
+		ASSERT_DEBUG_ONLY( !shader->IsInstanced() && "Drawable::Submit(): Instanced shaders are drawn via SubmitInstanced()." );
+
 		vertex_array->Bind();
-		shader->Bind();
 
-		material->SetMatrix( "transform_world",		 transform->GetFinalMatrix() );
+		/* Set before binding, so that it is sent only once if the Material's regular uniforms have to be re-sent anyway. */
+		material->SetMatrix( uniform_handle_transform_world, transform->GetWorldMatrix() );
+		material->Bind();
+
+		if( vertex_array->IsIndexed() )
+			GLCALL( glDrawElements( GL_TRIANGLES, vertex_array->IndexCount(), vertex_array->IndexType(), nullptr ) );
+		else
+			GLCALL( glDrawArrays( GL_TRIANGLES, 0, vertex_array->VertexCount() ) );
+	}
+
+	void Drawable::SubmitInstanced( const GLuint instance_buffer_id, const unsigned int instance_buffer_generation, const VertexBufferLayout& instance_buffer_layout,
+									const unsigned int byte_offset, const unsigned int instance_count )
+	{
+		ASSERT_DEBUG_ONLY( shader->IsInstanced() );
 
-		material->SetMatrix( "transform_view",		 camera->GetViewMatrix() );
-		material->SetMatrix( "transform_projection", camera->GetProjectionMatrix() );
+		vertex_array->AttachInstanceBuffer( instance_buffer_id, instance_buffer_generation, instance_buffer_layout, shader->InstanceTransformAttributeLocation(),
+											byte_offset );
+		material->Bind();
 
-		GLCALL( glDrawArrays( GL_TRIANGLES, 0, vertex_array->VertexCount() ) );
+		if( vertex_array->IsIndexed() )
+			GLCALL( glDrawElementsInstanced( GL_TRIANGLES, vertex_array->IndexCount(), vertex_array->IndexType(), nullptr, instance_count ) );
+		else
+			GLCALL( glDrawArraysInstanced( GL_TRIANGLES, 0, vertex_array->VertexCount(), instance_count ) );
 	}
 }
@@ -4,24 +4,48 @@
 #include "Vendor/OpenGL/glad/glad.h"
 
 // Framework Includes.
-#include "Renderer/Camera.h"
 #include "Renderer/Material.h"
 #include "Renderer/VertexArray.h"
 
 #include "Scene/Transform.h"
 
+// std Includes.
+#include <cstdint>
+#include <optional>
+
 namespace Framework
 {
 	/* Forward Declarations. */
 	class VertexArray;
 
+	/* Determines the draw order first & foremost; see RenderQueue. */
+	enum class RenderPass : std::uint8_t
+	{
+		Opaque		= 0, // Sorted by state, then front-to-back.
+		Transparent = 1	 // Sorted back-to-front, then by state.
+	};
+
 	class Drawable
 	{
 	public:
-		Drawable( Material* material, Transform* transform, const VertexArray* vertex_array );
+		Drawable( Material* material, Transform* transform, const VertexArray* vertex_array, const RenderPass render_pass = RenderPass::Opaque );
 		~Drawable();
 
-		void Submit( Camera* camera );
+		/* View & projection matrices are not set here; they are sourced from the shared Camera uniform block, which the Renderer updates once per frame. */
+		void Submit();
+		/* For instanced shaders only: Draws instance_count copies of this Drawable's mesh with this Drawable's Material, one per world matrix in the given buffer,
+		 * starting at byte_offset. The transforms of the other Drawables of the batch are expected to be in the buffer already (see Renderer::DrawFrame()). */
+		void SubmitInstanced( const GLuint instance_buffer_id, const unsigned int instance_buffer_generation, const VertexBufferLayout& instance_buffer_layout,
+							  const unsigned int byte_offset, const unsigned int instance_count );
+
+		inline const Material* GetMaterial() const			{ return material; }
+		inline const Shader* GetShader() const				{ return shader; }
+		inline const VertexArray* GetVertexArray() const	{ return vertex_array; }
+		inline RenderPass GetRenderPass() const				{ return render_pass; }
+
+		/* Overrides the vertex array's bounds (in model space), e.g., for shaders displacing vertices. */
+		inline void SetLocalBounds( const std::optional< Math::AABB >& bounds ) { local_bounds = bounds; }
+		inline const std::optional< Math::AABB >& GetLocalBounds() const		{ return local_bounds ? local_bounds : vertex_array->GetBounds(); }
 
 	public:
 		Transform* const transform;
@@ -30,5 +54,10 @@ namespace Framework
 		Material* material;
 		Shader* const shader;
 		const VertexArray* vertex_array;
+		RenderPass render_pass;
+		std::optional< Math::AABB > local_bounds;
+
+		/* Resolved once at construction, to avoid string lookups per draw. Invalid for instanced shaders. */
+		UniformHandle uniform_handle_transform_world;
 	};
 }
@@ -20,6 +20,6 @@ namespace Framework
 	{
 		vertex_array.Bind();
 		shader.Bind();
-		GLCALL( glDrawElements( GL_TRIANGLES, index_buffer.Count(), GL_UNSIGNED_INT, 0 ) );
+		GLCALL( glDrawElements( GL_TRIANGLES, index_buffer.Count(), index_buffer.IndexType(), 0 ) );
 	}
 }
@@ -0,0 +1,166 @@
+// Framework Includes.
+#include "Renderer/Graphics.h"
+
+// std Includes.
+#include <cstring>
+
+/* KHR_debug & ARB_buffer_storage are not part of the GL 3.3 GLAD loader; the few entry points & enums needed are loaded/declared here. */
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT					0x92E0
+#endif
+#ifndef GL_DEBUG_OUTPUT_SYNCHRONOUS
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS		0x8242
+#endif
+#ifndef GL_DEBUG_TYPE_ERROR
+#define GL_DEBUG_TYPE_ERROR				0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR	0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR	0x824E
+#define GL_DEBUG_TYPE_PORTABILITY			0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE			0x8250
+#endif
+#ifndef GL_DEBUG_SEVERITY_HIGH
+#define GL_DEBUG_SEVERITY_HIGH			0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM		0x9147
+#define GL_DEBUG_SEVERITY_LOW			0x9148
+#define GL_DEBUG_SEVERITY_NOTIFICATION	0x826B
+#endif
+
+namespace Framework
+{
+	namespace
+	{
+		using DebugMessageCallbackFunction = void ( APIENTRYP )( GLDEBUGPROC callback, const void* user_parameter );
+		using DebugMessageControlFunction  = void ( APIENTRYP )( GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled );
+		using BufferStorageFunction        = void ( APIENTRYP )( GLenum target, GLsizeiptr size, const void* data, GLbitfield flags );
+
+		DebugMessageCallbackFunction glDebugMessageCallback_ = nullptr;
+		DebugMessageControlFunction	 glDebugMessageControl_	 = nullptr;
+		BufferStorageFunction		 glBufferStorage_		 = nullptr;
+
+		const char* DebugMessageTypeString( const GLenum type )
+		{
+			switch( type )
+			{
+				case GL_DEBUG_TYPE_ERROR:				return "ERROR";
+				case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:	return "DEPRECATED_BEHAVIOR";
+				case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:	return "UNDEFINED_BEHAVIOR";
+				case GL_DEBUG_TYPE_PORTABILITY:			return "PORTABILITY";
+				case GL_DEBUG_TYPE_PERFORMANCE:			return "PERFORMANCE";
+
+				default:								return "OTHER";
+			}
+		}
+
+		const char* DebugMessageSeverityString( const GLenum severity )
+		{
+			switch( severity )
+			{
+				case GL_DEBUG_SEVERITY_HIGH:	return "HIGH";
+				case GL_DEBUG_SEVERITY_MEDIUM:	return "MEDIUM";
+				case GL_DEBUG_SEVERITY_LOW:		return "LOW";
+
+				default:						return "NOTIFICATION";
+			}
+		}
+
+		/* May be called from a driver thread, as GL_DEBUG_OUTPUT_SYNCHRONOUS is left disabled; only logs. */
+		void APIENTRY OnDebugMessage( GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* user_parameter )
+		{
+			std::cerr << "ERROR::GL::DEBUG_OUTPUT::" << DebugMessageTypeString( type ) << "::" << DebugMessageSeverityString( severity ) << " (id " << id << "):\n\t"
+					  << message << std::endl;
+		}
+	}
+
+	bool IsGLVersionSupported( const int major, const int minor )
+	{
+		return GLVersion.major > major || ( GLVersion.major == major && GLVersion.minor >= minor );
+	}
+
+	bool IsGLExtensionSupported( const char* extension_name )
+	{
+		GLint extension_count = 0;
+		glGetIntegerv( GL_NUM_EXTENSIONS, &extension_count );
+
+		for( GLint i = 0; i < extension_count; i++ )
+			if( std::strcmp( reinterpret_cast< const char* >( glGetStringi( GL_EXTENSIONS, i ) ), extension_name ) == 0 )
+				return true;
+
+		return false;
+	}
+
+	void InitializeGLDebugOutput( GLADloadproc loader )
+	{
+		if( !IsGLVersionSupported( 4, 3 ) && !IsGLExtensionSupported( "GL_KHR_debug" ) )
+			return;
+
+		glDebugMessageCallback_ = reinterpret_cast< DebugMessageCallbackFunction >( loader( "glDebugMessageCallback" ) );
+		glDebugMessageControl_	= reinterpret_cast< DebugMessageControlFunction >( loader( "glDebugMessageControl" ) );
+
+		if( !glDebugMessageCallback_ || !glDebugMessageControl_ )
+		{
+			glDebugMessageCallback_ = nullptr;
+			glDebugMessageControl_	= nullptr;
+			return;
+		}
+
+		glDebugMessageCallback_( OnDebugMessage, nullptr );
+		/* Notifications (buffer placement hints etc.) are too chatty to be useful here. */
+		glDebugMessageControl_( GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE );
+		glDisable( GL_DEBUG_OUTPUT_SYNCHRONOUS );
+
+		SetGLErrorCheckMode( GetGLErrorCheckMode() );
+	}
+
+	bool IsGLDebugOutputAvailable()
+	{
+		return glDebugMessageCallback_ != nullptr;
+	}
+
+	void InitializeGLBufferStorage( GLADloadproc loader )
+	{
+		if( !IsGLVersionSupported( 4, 4 ) && !IsGLExtensionSupported( "GL_ARB_buffer_storage" ) )
+			return;
+
+		glBufferStorage_ = reinterpret_cast< BufferStorageFunction >( loader( "glBufferStorage" ) );
+	}
+
+	bool IsGLBufferStorageAvailable()
+	{
+		return glBufferStorage_ != nullptr;
+	}
+
+	void GLBufferStorage( const GLenum target, const GLsizeiptr size, const void* data, const GLbitfield flags )
+	{
+		ASSERT_DEBUG_ONLY( IsGLBufferStorageAvailable() );
+
+		GLCALL( glBufferStorage_( target, size, data, flags ) );
+	}
+
+	GLErrorCheckMode SetGLErrorCheckMode( GLErrorCheckMode mode )
+	{
+#ifndef _DEBUG
+		if( mode == GLErrorCheckMode::Synchronous )
+			mode = GLErrorCheckMode::DebugOutput;
+#endif
+
+		if( mode == GLErrorCheckMode::DebugOutput && !IsGLDebugOutputAvailable() )
+		{
+#ifdef _DEBUG
+			mode = GLErrorCheckMode::Synchronous;
+#else
+			mode = GLErrorCheckMode::Disabled;
+#endif
+		}
+
+		if( IsGLDebugOutputAvailable() )
+		{
+			if( mode == GLErrorCheckMode::DebugOutput )
+				glEnable( GL_DEBUG_OUTPUT );
+			else
+				glDisable( GL_DEBUG_OUTPUT );
+		}
+
+		gl_error_check_mode = mode;
+		return mode;
+	}
+}
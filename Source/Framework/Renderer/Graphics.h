@@ -4,16 +4,72 @@
 #include "Vendor/OpenGL/glad/glad.h"
 
 // Framework Includes.
-#include "Core/Assert.h"  
+#include "Core/Assert.h"
 
 // std Includes.
 #include <iostream>
 
 #define BUFFER_OFFSET(idx) ( static_cast< char* >( 0 ) + ( idx ) )
 
-#define GLCALL( x ) GLClearError();\
-x;\
-ASSERT( GLLogCall( #x, __FILE__, __LINE__ ) )
+namespace Framework
+{
+	/* How GL errors are caught:
+	 *	Synchronous: glGetError() before & after every GLCALL. Pinpoints the failing call, at the cost of 2+ driver round-trips per call. Debug builds only.
+	 *	DebugOutput: The driver reports errors (& warnings) asynchronously through the KHR_debug callback; GLCALL itself adds nothing.
+	 *				 Needs KHR_debug (core since GL 4.3); debug builds request a debug context to get the most out of it.
+	 *	Disabled:	 No checking at all. */
+	enum class GLErrorCheckMode
+	{
+		Disabled, DebugOutput, Synchronous
+	};
+
+	/* Runtime state; only accessed through Get/SetGLErrorCheckMode(). Inline so that GLCALL's per-call read in debug builds stays a plain load. */
+#ifdef _DEBUG
+	inline GLErrorCheckMode gl_error_check_mode = GLErrorCheckMode::Synchronous;
+#else
+	inline GLErrorCheckMode gl_error_check_mode = GLErrorCheckMode::Disabled;
+#endif
+
+	/* Of the current context. The extension query walks the whole extension list; keep the result where it is needed often. */
+	bool IsGLVersionSupported( const int major, const int minor );
+	bool IsGLExtensionSupported( const char* extension_name );
+
+	/* Loads the KHR_debug entry points, if the context supports them. GLAD needs to be initialized first. */
+	void InitializeGLDebugOutput( GLADloadproc loader );
+	bool IsGLDebugOutputAvailable();
+
+	/* Loads glBufferStorage (core since GL 4.4, or ARB_buffer_storage), if the context supports it. GLAD needs to be initialized first. */
+	void InitializeGLBufferStorage( GLADloadproc loader );
+	bool IsGLBufferStorageAvailable();
+	/* Only valid if IsGLBufferStorageAvailable(). */
+	void GLBufferStorage( const GLenum target, const GLsizeiptr size, const void* data, const GLbitfield flags );
+
+	/* Can be switched at any time, e.g. to profile a debug build without the glGetError() round-trips.
+	 * Unavailable modes fall back to the closest available one (DebugOutput -> Synchronous (debug) or Disabled; Synchronous -> DebugOutput or Disabled in release).
+	 * Returns the mode actually set. */
+	GLErrorCheckMode SetGLErrorCheckMode( const GLErrorCheckMode mode );
+	inline GLErrorCheckMode GetGLErrorCheckMode() { return gl_error_check_mode; }
+}
+
+/* Always checks synchronously, regardless of the build configuration & the current GLErrorCheckMode. */
+#define GLCALL_SYNCHRONOUS( x ) do { GLClearError(); x; ASSERT( GLLogCall( #x, __FILE__, __LINE__ ) ); } while( false )
+
+#ifdef _DEBUG
+#define GLCALL( x ) do\
+{\
+	const bool gl_call_check_synchronously = Framework::GetGLErrorCheckMode() == Framework::GLErrorCheckMode::Synchronous;\
+	if( gl_call_check_synchronously )\
+		GLClearError();\
+	x;\
+	if( gl_call_check_synchronously )\
+	{\
+		ASSERT( GLLogCall( #x, __FILE__, __LINE__ ) );\
+	}\
+} while( false )
+#else
+/* Zero overhead; errors can still be caught via GLErrorCheckMode::DebugOutput. */
+#define GLCALL( x ) x
+#endif
 
 static void GLClearError()
 {
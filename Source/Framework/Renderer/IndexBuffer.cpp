@@ -4,35 +4,77 @@
 // Framework Includes.
 #include "Renderer/Graphics.h"
 #include "Renderer/IndexBuffer.h"
+#include "Renderer/StateCache.h"
 
 // std Includes.
+#include <algorithm>
 #include <iostream>
 
 namespace Framework
 {
 	IndexBuffer::IndexBuffer( const void* data, const unsigned int count )
 		:
-		count( count )
+		count( count ),
+		index_type( GL_UNSIGNED_INT )
 	{
 		ASSERT( sizeof( GLuint ) == sizeof( unsigned int ) );
 
-		GLCALL( glGenBuffers( 1, &index_buffer_object_id ) );
-		Bind();
-		GLCALL( glBufferData( GL_ELEMENT_ARRAY_BUFFER, count * sizeof( GLuint ), data, GL_STATIC_DRAW ) );
+		Create( data );
+	}
+
+	IndexBuffer::IndexBuffer( const std::uint16_t* data, const unsigned int count )
+		:
+		count( count ),
+		index_type( GL_UNSIGNED_SHORT )
+	{
+		Create( data );
+	}
+
+	IndexBuffer::IndexBuffer( const void* data, const unsigned int count, const GLenum index_type )
+		:
+		count( count ),
+		index_type( index_type )
+	{
+		ASSERT_DEBUG_ONLY( index_type == GL_UNSIGNED_SHORT || index_type == GL_UNSIGNED_INT );
+
+		Create( data );
+	}
+
+	IndexBuffer::IndexBuffer( const std::vector< std::uint32_t >& indices )
+		:
+		count( ( unsigned int )indices.size() ),
+		index_type( indices.empty() || *std::max_element( indices.cbegin(), indices.cend() ) <= 0xFFFF ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT )
+	{
+		if( index_type == GL_UNSIGNED_INT )
+		{
+			Create( indices.data() );
+			return;
+		}
+
+		const std::vector< std::uint16_t > indices_16_bit( indices.cbegin(), indices.cend() );
+		Create( indices_16_bit.data() );
 	}
 
 	IndexBuffer::~IndexBuffer()
 	{
 		GLCALL( glDeleteBuffers( 1, &index_buffer_object_id ) );
+		StateCache::Instance().OnBufferDeleted( index_buffer_object_id );
 	}
 
 	void IndexBuffer::Bind() const
 	{
-		GLCALL( glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, index_buffer_object_id ) );
+		StateCache::Instance().BindBuffer( GL_ELEMENT_ARRAY_BUFFER, index_buffer_object_id );
 	}
 
 	void IndexBuffer::Unbind() const
 	{
-		GLCALL( glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 ) );
+		StateCache::Instance().BindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+	}
+
+	void IndexBuffer::Create( const void* data )
+	{
+		GLCALL( glGenBuffers( 1, &index_buffer_object_id ) );
+		Bind();
+		GLCALL( glBufferData( GL_ELEMENT_ARRAY_BUFFER, Size(), data, GL_STATIC_DRAW ) );
 	}
 }
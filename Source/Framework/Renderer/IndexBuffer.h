@@ -3,21 +3,41 @@
 // Vendor GLAD Includes (Has to be included before GLFW!).
 #include <Vendor/OpenGL/glad/glad.h>
 
+// std Includes.
+#include <cstdint>
+#include <vector>
+
 namespace Framework
 {
 	class IndexBuffer
 	{
 	public:
+		/* 32-bit indices. */
 		IndexBuffer( const void* data, const unsigned int count );
+		IndexBuffer( const std::uint16_t* data, const unsigned int count );
+		/* index_type: GL_UNSIGNED_SHORT or GL_UNSIGNED_INT; for index data of a type only known at run time, e.g., from a MeshFile. */
+		IndexBuffer( const void* data, const unsigned int count, const GLenum index_type );
+		/* Stored as 16-bit indices if all of them fit, halving the buffer size & the index fetch bandwidth. */
+		IndexBuffer( const std::vector< std::uint32_t >& indices );
 		~IndexBuffer();
 
+		IndexBuffer( const IndexBuffer& )				= delete;
+		IndexBuffer& operator= ( const IndexBuffer& )	= delete;
+
 		void Bind() const;
 		void Unbind() const;
 
 		inline unsigned int Count() const { return count; }
+		/* GL_UNSIGNED_SHORT or GL_UNSIGNED_INT; what glDrawElements() expects as its type argument. */
+		inline GLenum IndexType() const { return index_type; }
+		inline unsigned int Size() const { return count * ( index_type == GL_UNSIGNED_SHORT ? 2 : 4 ); }
+
+	private:
+		void Create( const void* data );
 
 	private:
 		GLuint index_buffer_object_id;
 		unsigned int count;
+		GLenum index_type;
 	};
 }
@@ -1,129 +1,370 @@
 // Framework Includes.
 #include "Renderer/Material.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/UniformBlock.h"
+
+// std Includes.
+#include <algorithm>
 
 namespace Framework
 {
 	Material::Material( Shader* const shader )
 		:
-		shader( shader )
+		shader( shader ),
+		dirty_range_begin( 0 ),
+		dirty_range_end( 0 ),
+		id( 0 )
 	{
-		const auto& uniform_info_map = shader->GetUniformInformations();
+		static unsigned int id_last = 0;
+		id = ++id_last;
+
+		const auto& uniform_info_list = shader->GetUniformInformations();
+		const int material_block_size = shader->GetMaterialBlockSize();
 
-		int total_size = 0;
-		for( auto& [ name, uniform_info ] : uniform_info_map )
-			total_size += uniform_info.size;
+		int total_size = material_block_size;
+		for( auto& uniform_info : uniform_info_list )
+			total_size = std::max( total_size, uniform_info.offset + uniform_info.size );
 
 		uniform_blob.resize( total_size );
+
+		if( material_block_size > 0 )
+		{
+			uniform_buffer = std::make_unique< UniformBuffer >( material_block_size );
+
+			/* Upload the (zero-initialized) block on first Bind(). */
+			dirty_range_end = material_block_size;
+		}
+	}
+
+	void Material::Bind()
+	{
+		shader->Bind();
+
+		if( shader->material_id_applied != id )
+		{
+			for( const auto handle : regular_uniform_list )
+				SendRegularUniform( handle );
+
+			shader->material_id_applied = id;
+		}
+		else
+		{
+			for( const auto handle : regular_uniform_dirty_list )
+				SendRegularUniform( handle );
+		}
+
+		regular_uniform_dirty_list.clear();
+
+		if( uniform_buffer )
+		{
+			if( dirty_range_begin != dirty_range_end )
+			{
+				uniform_buffer->Update( uniform_blob.data() + dirty_range_begin, dirty_range_end - dirty_range_begin, dirty_range_begin );
+				dirty_range_begin = dirty_range_end = 0;
+			}
+
+			uniform_buffer->BindToBindingPoint( ( GLuint )UniformBlock::Material::BINDING_POINT );
+		}
+
+		for( unsigned int slot = 0; slot < texture_slot_list.size(); slot++ )
+			if( texture_slot_list[ slot ] )
+				texture_slot_list[ slot ]->ActivateAndBind( GL_TEXTURE0 + slot );
+
+		for( unsigned int slot = 0; slot < texture_array_slot_list.size(); slot++ )
+			if( texture_array_slot_list[ slot ] )
+				texture_array_slot_list[ slot ]->ActivateAndBind( GL_TEXTURE0 + slot );
+	}
+
+	Material& Material::SetTexture( const unsigned int slot, const Texture* texture )
+	{
+		ASSERT_DEBUG_ONLY( slot < StateCache::MAX_TEXTURE_UNIT_COUNT );
+
+		if( slot >= texture_slot_list.size() )
+			texture_slot_list.resize( slot + 1, nullptr );
+
+		texture_slot_list[ slot ] = texture;
+
+		if( texture && slot < texture_array_slot_list.size() )
+			texture_array_slot_list[ slot ] = nullptr;
+
+		return *this;
+	}
+
+	Material& Material::SetTextureArray( const unsigned int slot, const TextureArray* texture_array )
+	{
+		ASSERT_DEBUG_ONLY( slot < StateCache::MAX_TEXTURE_UNIT_COUNT );
+
+		if( slot >= texture_array_slot_list.size() )
+			texture_array_slot_list.resize( slot + 1, nullptr );
+
+		texture_array_slot_list[ slot ] = texture_array;
+
+		if( texture_array && slot < texture_slot_list.size() )
+			texture_slot_list[ slot ] = nullptr;
+
+		return *this;
 	}
 
 	Material& Material::SetFloat( const std::string& name, const float value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetFloat( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetFloat( const UniformName name, const float value )
+	{
+		return SetFloat( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetFloat( const UniformHandle handle, const float value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( float ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( &value, uniform_information );
 
-		shader->SetFloat( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetFloat( handle, value );
 
 		return *this;
 	}
 
 	Material& Material::SetInt( const std::string& name, const int value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetInt( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetInt( const UniformName name, const int value )
+	{
+		return SetInt( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetInt( const UniformHandle handle, const int value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( int ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( &value, uniform_information );
 
-		shader->SetInt( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetInt( handle, value );
 
 		return *this;
 	}
 
 	Material& Material::SetBool( const std::string& name, const bool value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetBool( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetBool( const UniformName name, const bool value )
+	{
+		return SetBool( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetBool( const UniformHandle handle, const bool value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
-		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( bool ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
-		CopyUniformToBlob( &value, uniform_information );
+		if( uniform_information.is_in_material_block )
+		{
+			/* std140 stores bools as 4 byte ints. */
+			ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( int ) );
 
-		shader->SetBool( name, value );
+			const int value_std140 = value;
+			CopyUniformToBlob( &value_std140, uniform_information );
+		}
+		else
+		{
+			ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( bool ) );
+
+			CopyUniformToBlob( &value, uniform_information );
+
+			if( TrackRegularUniform( handle ) )
+				shader->SetBool( handle, value );
+		}
 
 		return *this;
 	}
 
 	Material& Material::SetColor3( const std::string& name, const Color3& value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetColor3( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetColor3( const UniformName name, const Color3& value )
+	{
+		return SetColor3( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetColor3( const UniformHandle handle, const Color3& value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( Color3 ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( value.Data(), uniform_information );
 
-		shader->SetColor( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetColor( handle, value );
 
 		return *this;
 	}
 
 	Material& Material::SetColor4( const std::string& name, const Color4& value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetColor4( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetColor4( const UniformName name, const Color4& value )
+	{
+		return SetColor4( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetColor4( const UniformHandle handle, const Color4& value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( Color4 ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( value.Data(), uniform_information );
 
-		shader->SetColor( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetColor( handle, value );
 
 		return *this;
 	}
 
 	Material& Material::SetTextureSampler1D( const std::string& name, const int value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetTextureSampler1D( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler1D( const UniformName name, const int value )
+	{
+		return SetTextureSampler1D( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler1D( const UniformHandle handle, const int value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( int ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( &value, uniform_information );
 
-		shader->SetTextureSampler1D( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetTextureSampler1D( handle, value );
 
 		return *this;
 	}
 
 	Material& Material::SetTextureSampler2D( const std::string& name, const int value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetTextureSampler2D( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler2D( const UniformName name, const int value )
+	{
+		return SetTextureSampler2D( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler2D( const UniformHandle handle, const int value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( int ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( &value, uniform_information );
 
-		shader->SetTextureSampler2D( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetTextureSampler2D( handle, value );
 
 		return *this;
 	}
 
 	Material& Material::SetTextureSampler3D( const std::string& name, const int value )
 	{
-		const auto& uniform_information = shader->GetUniformInformation( name );
+		return SetTextureSampler3D( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler3D( const UniformName name, const int value )
+	{
+		return SetTextureSampler3D( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler3D( const UniformHandle handle, const int value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
+
+		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( int ) );
+		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
+
+		CopyUniformToBlob( &value, uniform_information );
+
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetTextureSampler3D( handle, value );
+
+		return *this;
+	}
+
+	Material& Material::SetTextureSampler2DArray( const std::string& name, const int value )
+	{
+		return SetTextureSampler2DArray( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler2DArray( const UniformName name, const int value )
+	{
+		return SetTextureSampler2DArray( shader->GetUniformHandle( name ), value );
+	}
+
+	Material& Material::SetTextureSampler2DArray( const UniformHandle handle, const int value )
+	{
+		if( !handle.IsValid() )
+			return *this;
+
+		const auto& uniform_information = shader->GetUniformInformation( handle );
 
 		ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( int ) );
 		ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 		CopyUniformToBlob( &value, uniform_information );
 
-		shader->SetTextureSampler3D( name, value );
+		if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+			shader->SetTextureSampler2DArray( handle, value );
 
 		return *this;
 	}
@@ -140,7 +381,12 @@ namespace Framework
 
 	bool Material::GetBool( const std::string& name )
 	{
-		return GetUniformValue< bool >( shader->GetUniformInformation( name ) );
+		const auto& uniform_information = shader->GetUniformInformation( name );
+
+		/* std140 stores bools as 4 byte ints. */
+		return uniform_information.is_in_material_block
+			? GetUniformValue< int >( uniform_information ) != 0
+			: GetUniformValue< bool >( uniform_information );
 	}
 
 	const Color3& Material::GetColor3( const std::string& name )
@@ -168,10 +414,53 @@ namespace Framework
 		return GetInt( name );
 	}
 
+	int Material::GetTextureSampler2DArray( const std::string& name )
+	{
+		return GetInt( name );
+	}
+
+	bool Material::TrackRegularUniform( const UniformHandle handle )
+	{
+		const auto has_handle = [ & ]( const std::vector< UniformHandle >& handle_list )
+		{
+			return std::any_of( handle_list.cbegin(), handle_list.cend(), [ & ]( const UniformHandle other ) { return other.index == handle.index; } );
+		};
+
+		if( !has_handle( regular_uniform_list ) )
+			regular_uniform_list.push_back( handle );
+
+		if( shader->material_id_applied == id && StateCache::Instance().IsProgramInUse( shader->ProgramID() ) )
+			return true;
+
+		if( !has_handle( regular_uniform_dirty_list ) )
+			regular_uniform_dirty_list.push_back( handle );
+
+		return false;
+	}
+
+	void Material::SendRegularUniform( const UniformHandle handle )
+	{
+		shader->SetUniform( handle, uniform_blob.data() + shader->GetUniformInformation( handle ).offset );
+	}
+
 	Material& Material::CopyUniformToBlob( const void* value, const ShaderUniformInformation& uniform_info )
 	{
 		std::memcpy( uniform_blob.data() + uniform_info.offset, static_cast< const char* >( value ), uniform_info.size );
 
+		if( uniform_info.is_in_material_block )
+		{
+			if( dirty_range_begin == dirty_range_end )
+			{
+				dirty_range_begin = uniform_info.offset;
+				dirty_range_end   = uniform_info.offset + uniform_info.size;
+			}
+			else
+			{
+				dirty_range_begin = std::min( dirty_range_begin, uniform_info.offset );
+				dirty_range_end   = std::max( dirty_range_end,	 uniform_info.offset + uniform_info.size );
+			}
+		}
+
 		return *this;
 	}
 }
\ No newline at end of file
@@ -5,34 +5,102 @@
 
 #include "Renderer/Shader.h"
 #include "Renderer/ShaderTypeInformation.h"
+#include "Renderer/Texture.h"
+#include "Renderer/TextureArray.h"
+#include "Renderer/UniformBuffer.h"
 
 // std Includes.
+#include <memory>
 #include <unordered_map>
 
 namespace Framework
 {
+	/* Uniforms inside the shader's Material block are only written to the CPU-side blob (which mirrors the block in std140 layout) & marked dirty;
+	 * the changed bytes are uploaded to the Material's own UniformBuffer on Bind(). Switching between Materials sharing a Shader then costs one buffer bind,
+	 * instead of re-sending every uniform.
+	 * Regular uniforms (samplers, per-draw data etc.) are program state, shared by all Materials of the Shader. They are also kept in the blob & are sent
+	 * immediately only while this Material is bound; otherwise on the next Bind(), which also sends all of them again if another Material was bound since. */
 	class Material
 	{
 	public:
 		Material( Shader* const shader );
 
+		/* Binds the shader, sends the regular uniforms that need it, uploads the dirty range of the Material block (if any) & binds the Material's UniformBuffer
+		 * & textures. */
+		void Bind();
+
+		/* Process-wide unique, assigned in creation order. Used to group draws by Material. */
+		inline unsigned int ID() const { return id; }
+
+		/* The texture is bound to texture unit GL_TEXTURE0 + slot on Bind(). Pass nullptr to clear the slot.
+		 * Sampler uniforms still need to be pointed to the slot (via SetTextureSampler*D()). */
+		Material& SetTexture( const unsigned int slot, const Texture* texture );
+		inline const Texture* GetTexture( const unsigned int slot ) const { return slot < texture_slot_list.size() ? texture_slot_list[ slot ] : nullptr; }
+
+		/* As SetTexture(), for sampler2DArray uniforms (e.g., a TextureAtlas' array, shared by many Materials). A slot holds either a Texture or a TextureArray. */
+		Material& SetTextureArray( const unsigned int slot, const TextureArray* texture_array );
+		inline const TextureArray* GetTextureArray( const unsigned int slot ) const { return slot < texture_array_slot_list.size() ? texture_array_slot_list[ slot ] : nullptr; }
+
 	/* Uniform Setters. */
 		Material& SetFloat( const std::string& name, const float value );
 		Material& SetInt( const std::string& name, const int value );
 		Material& SetBool( const std::string& name, const bool value );
 
+		Material& SetFloat( const UniformName name, const float value );
+		Material& SetInt( const UniformName name, const int value );
+		Material& SetBool( const UniformName name, const bool value );
+
+		Material& SetFloat( const UniformHandle handle, const float value );
+		Material& SetInt( const UniformHandle handle, const int value );
+		Material& SetBool( const UniformHandle handle, const bool value );
+
 		template< Concepts::Arithmetic Coordinate, std::size_t Size >
 			requires Concepts::NonZero< Size >
 		Material& SetVector( const std::string& name, const Math::Vector< Coordinate, Size >& value )
 		{
-			const auto& uniform_information = shader->GetUniformInformation( name );
+			return SetVector( shader->GetUniformHandle( name ), value );
+		}
+
+		template< Concepts::Arithmetic Coordinate, std::size_t Size >
+			requires Concepts::NonZero< Size >
+		Material& SetVector( const UniformName name, const Math::Vector< Coordinate, Size >& value )
+		{
+			return SetVector( shader->GetUniformHandle( name ), value );
+		}
+
+		template< Concepts::Arithmetic Coordinate, std::size_t Size >
+			requires Concepts::NonZero< Size >
+		Material& SetVector( const UniformHandle handle, const Math::Vector< Coordinate, Size >& value )
+		{
+			if( !handle.IsValid() )
+				return *this;
+
+			const auto& uniform_information = shader->GetUniformInformation( handle );
+
+			if constexpr( std::is_same_v< Coordinate, bool > )
+			{
+				/* std140 stores bools as 4 byte ints. */
+				if( uniform_information.is_in_material_block )
+				{
+					Math::Vector< int, Size > value_std140;
+					for( std::size_t index = 0; index < Size; index++ )
+						value_std140[ index ] = value[ index ];
+
+					ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( value_std140 ) );
+					ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
+
+					CopyUniformToBlob( value_std140.Data(), uniform_information );
+					return *this;
+				}
+			}
 		
 			ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( Math::Vector< Coordinate, Size > ) );
 			ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
 
 			CopyUniformToBlob( value.Data(), uniform_information );
 
-			shader->SetVector( name, value );
+			if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+				shader->SetVector( handle, value );
 
 			return *this;
 		}
@@ -40,18 +108,45 @@ namespace Framework
 		Material& SetColor3( const std::string& name, const Color3& value );
 		Material& SetColor4( const std::string& name, const Color4& value );
 
+		Material& SetColor3( const UniformName name, const Color3& value );
+		Material& SetColor4( const UniformName name, const Color4& value );
+
+		Material& SetColor3( const UniformHandle handle, const Color3& value );
+		Material& SetColor4( const UniformHandle handle, const Color4& value );
+
 		template< Concepts::Arithmetic Type, std::size_t RowSize, std::size_t ColumnSize >
 			requires Concepts::NonZero< RowSize > && Concepts::NonZero< ColumnSize >
 		Material& SetMatrix( const std::string& name, const Math::Matrix< Type, RowSize, ColumnSize >& value )
 		{
-			const auto& uniform_information = shader->GetUniformInformation( name );
+			return SetMatrix( shader->GetUniformHandle( name ), value );
+		}
+
+		template< Concepts::Arithmetic Type, std::size_t RowSize, std::size_t ColumnSize >
+			requires Concepts::NonZero< RowSize > && Concepts::NonZero< ColumnSize >
+		Material& SetMatrix( const UniformName name, const Math::Matrix< Type, RowSize, ColumnSize >& value )
+		{
+			return SetMatrix( shader->GetUniformHandle( name ), value );
+		}
+
+		template< Concepts::Arithmetic Type, std::size_t RowSize, std::size_t ColumnSize >
+			requires Concepts::NonZero< RowSize > && Concepts::NonZero< ColumnSize >
+		Material& SetMatrix( const UniformHandle handle, const Math::Matrix< Type, RowSize, ColumnSize >& value )
+		{
+			if( !handle.IsValid() )
+				return *this;
+
+			const auto& uniform_information = shader->GetUniformInformation( handle );
 		
 			ASSERT_DEBUG_ONLY( uniform_information.size == sizeof( Math::Matrix< Type, RowSize, ColumnSize > ) );
 			ASSERT_DEBUG_ONLY( uniform_information.size + uniform_information.offset - 1 <= ( int )uniform_blob.size() );
+			/* std140 pads every row (of a row_major matrix) to 4 components, so only matrices with 4 columns can be mirrored as is.
+			 * If a use-case for the others comes up, I'll refactor. */
+			ASSERT_DEBUG_ONLY( !uniform_information.is_in_material_block || ColumnSize == 4 );
 
 			CopyUniformToBlob( value.Data(), uniform_information );
 
-			shader->SetMatrix( name, value );
+			if( !uniform_information.is_in_material_block && TrackRegularUniform( handle ) )
+				shader->SetMatrix( handle, value );
 
 			return *this;
 		}
@@ -59,6 +154,17 @@ namespace Framework
 		Material& SetTextureSampler1D( const std::string& name, const int value );
 		Material& SetTextureSampler2D( const std::string& name, const int value );
 		Material& SetTextureSampler3D( const std::string& name, const int value );
+		Material& SetTextureSampler2DArray( const std::string& name, const int value );
+
+		Material& SetTextureSampler1D( const UniformName name, const int value );
+		Material& SetTextureSampler2D( const UniformName name, const int value );
+		Material& SetTextureSampler3D( const UniformName name, const int value );
+		Material& SetTextureSampler2DArray( const UniformName name, const int value );
+
+		Material& SetTextureSampler1D( const UniformHandle handle, const int value );
+		Material& SetTextureSampler2D( const UniformHandle handle, const int value );
+		Material& SetTextureSampler3D( const UniformHandle handle, const int value );
+		Material& SetTextureSampler2DArray( const UniformHandle handle, const int value );
 
 	/* Uniform Getters. */
 		template< typename Type >
@@ -83,7 +189,12 @@ namespace Framework
 			requires Concepts::NonZero< Size >
 		const Math::Vector< Coordinate, Size >& GetVector( const std::string& name )
 		{
-			return GetUniformValue< Math::Vector< Coordinate, Size > >( shader->GetUniformInformation( name ) );
+			const auto& uniform_information = shader->GetUniformInformation( name );
+
+			/* Bool vectors inside the Material block are stored as int vectors (std140); use GetVector< int, Size >() for them. */
+			ASSERT_DEBUG_ONLY( !( std::is_same_v< Coordinate, bool > && uniform_information.is_in_material_block ) );
+
+			return GetUniformValue< Math::Vector< Coordinate, Size > >( uniform_information );
 		}
 
 		const Color3& GetColor3( const std::string& name );
@@ -99,14 +210,37 @@ namespace Framework
 		int GetTextureSampler1D( const std::string& name );
 		int GetTextureSampler2D( const std::string& name );
 		int GetTextureSampler3D( const std::string& name );
+		int GetTextureSampler2DArray( const std::string& name );
 
 	private:
+		/* Also extends the dirty range, if the uniform is inside the Material block. */
 		Material& CopyUniformToBlob( const void* value, const ShaderUniformInformation& uniform_info );
+		/* Records a regular uniform as set through this Material. Returns whether it can be sent right away, i.e., the program is in use & holds this Material's
+		 * regular uniforms; otherwise marks it dirty, to be sent on the next Bind(). */
+		bool TrackRegularUniform( const UniformHandle handle );
+		void SendRegularUniform( const UniformHandle handle );
 
 	public:
 		Shader* const shader;
 
 	private:
+		/* Material block (std140) first, followed by the regular uniforms. */
 		std::vector< char > uniform_blob;
+
+		/* Regular uniforms set through this Material, each once. */
+		std::vector< UniformHandle > regular_uniform_list;
+		/* Regular uniforms set while they could not be sent right away. */
+		std::vector< UniformHandle > regular_uniform_dirty_list;
+
+		std::vector< const Texture* > texture_slot_list;
+		std::vector< const TextureArray* > texture_array_slot_list;
+
+		/* Only created if the shader declares a Material block. */
+		std::unique_ptr< UniformBuffer > uniform_buffer;
+		/* Union of all changes to the Material block since the last upload, as a single [begin, end) byte range; empty if begin == end. */
+		int dirty_range_begin;
+		int dirty_range_end;
+
+		unsigned int id;
 	};
 }
@@ -0,0 +1,206 @@
+// Framework Includes.
+#include "Renderer/MeshFile.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace Framework
+{
+	namespace
+	{
+		constexpr std::uint64_t BLOB_ALIGNMENT = 16;
+
+		std::uint64_t AlignUp( const std::uint64_t offset ) { return ( offset + BLOB_ALIGNMENT - 1 ) / BLOB_ALIGNMENT * BLOB_ALIGNMENT; }
+
+		template< typename Index >
+		bool AreIndicesInRange( const std::byte* index_data, const std::uint32_t index_count, const std::uint32_t vertex_count )
+		{
+			for( std::uint32_t i = 0; i < index_count; i++ )
+			{
+				Index index;
+				std::memcpy( &index, index_data + i * sizeof( Index ), sizeof( Index ) );
+				if( index >= vertex_count )
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	MeshFile::MeshFile( const std::string& file_path )
+		:
+		file( file_path ),
+		header{},
+		is_valid( false )
+	{
+		if( !file.IsOpen() )
+		{
+			std::cerr << "ERROR::MESH_FILE::COULD_NOT_OPEN_FILE: " << file_path << "\n";
+			return;
+		}
+
+		if( file.Size() >= sizeof( Header ) )
+			std::memcpy( &header, file.Data(), sizeof( Header ) );
+
+		is_valid = Validate();
+		if( !is_valid )
+		{
+			std::cerr << "ERROR::MESH_FILE::INVALID_OR_OUTDATED_FILE: " << file_path << "\n";
+			header = {};
+		}
+	}
+
+	bool MeshFile::Write( const std::string& file_path, const MeshData& mesh_data )
+	{
+		const auto& attribute_list = mesh_data.layout.GetAttributes();
+		if( attribute_list.size() > MAX_ATTRIBUTE_COUNT )
+		{
+			std::cerr << "ERROR::MESH_FILE::TOO_MANY_ATTRIBUTES: " << file_path << "\n";
+			return false;
+		}
+
+		const bool use_16_bit_indices = mesh_data.indices.empty() || *std::max_element( mesh_data.indices.cbegin(), mesh_data.indices.cend() ) <= 0xFFFF;
+
+		Header header{};
+		header.magic			= MAGIC;
+		header.version			= VERSION;
+		header.vertex_count		= mesh_data.vertex_count;
+		header.stride			= mesh_data.layout.GetStride();
+		header.index_count		= ( std::uint32_t )mesh_data.indices.size();
+		header.index_type		= use_16_bit_indices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		header.attribute_count	= ( std::uint32_t )attribute_list.size();
+
+		for( std::size_t i = 0; i < attribute_list.size(); i++ )
+		{
+			const auto& attribute = attribute_list[ i ];
+			header.attribute_list[ i ] = { ( std::uint32_t )attribute.count, attribute.type, attribute.normalized };
+		}
+
+		for( int i = 0; i < 3; i++ )
+		{
+			header.bounds_min[ i ] = mesh_data.bounds_min[ i ];
+			header.bounds_max[ i ] = mesh_data.bounds_max[ i ];
+		}
+
+		header.vertex_data_offset = AlignUp( sizeof( Header ) );
+		header.vertex_data_size	  = std::uint64_t( header.vertex_count ) * header.stride;
+		header.index_data_offset  = AlignUp( header.vertex_data_offset + header.vertex_data_size );
+		header.index_data_size	  = std::uint64_t( header.index_count ) * ( use_16_bit_indices ? 2 : 4 );
+
+		if( mesh_data.vertex_data.size() != header.vertex_data_size )
+		{
+			std::cerr << "ERROR::MESH_FILE::VERTEX_DATA_SIZE_DOES_NOT_MATCH_LAYOUT: " << file_path << "\n";
+			return false;
+		}
+
+		std::ofstream stream( file_path, std::ios::binary | std::ios::trunc );
+		if( !stream )
+		{
+			std::cerr << "ERROR::MESH_FILE::COULD_NOT_CREATE_FILE: " << file_path << "\n";
+			return false;
+		}
+
+		const char zeroes[ BLOB_ALIGNMENT ] = {};
+		const auto pad_to = [ & ]( const std::uint64_t offset ) { stream.write( zeroes, std::streamsize( offset - std::uint64_t( stream.tellp() ) ) ); };
+
+		stream.write( reinterpret_cast< const char* >( &header ), sizeof( Header ) );
+
+		pad_to( header.vertex_data_offset );
+		stream.write( reinterpret_cast< const char* >( mesh_data.vertex_data.data() ), std::streamsize( header.vertex_data_size ) );
+
+		pad_to( header.index_data_offset );
+		if( use_16_bit_indices )
+		{
+			const std::vector< std::uint16_t > indices_16_bit( mesh_data.indices.cbegin(), mesh_data.indices.cend() );
+			stream.write( reinterpret_cast< const char* >( indices_16_bit.data() ), std::streamsize( header.index_data_size ) );
+		}
+		else
+			stream.write( reinterpret_cast< const char* >( mesh_data.indices.data() ), std::streamsize( header.index_data_size ) );
+
+		if( !stream )
+		{
+			std::cerr << "ERROR::MESH_FILE::COULD_NOT_WRITE_TO_FILE: " << file_path << "\n";
+			return false;
+		}
+
+		return true;
+	}
+
+	MeshData MeshFile::ToMeshData() const
+	{
+		MeshData mesh_data;
+		mesh_data.vertex_data.assign( VertexData(), VertexData() + header.vertex_data_size );
+		mesh_data.vertex_count	= header.vertex_count;
+		mesh_data.layout		= Layout();
+		mesh_data.bounds_min	= BoundsMin();
+		mesh_data.bounds_max	= BoundsMax();
+
+		mesh_data.indices.resize( header.index_count );
+		if( header.index_type == GL_UNSIGNED_INT )
+			std::memcpy( mesh_data.indices.data(), IndexData(), header.index_data_size );
+		else
+		{
+			const std::byte* index_data = static_cast< const std::byte* >( IndexData() );
+			for( std::uint32_t i = 0; i < header.index_count; i++ )
+			{
+				std::uint16_t index;
+				std::memcpy( &index, index_data + i * sizeof( std::uint16_t ), sizeof( std::uint16_t ) );
+				mesh_data.indices[ i ] = index;
+			}
+		}
+
+		return mesh_data;
+	}
+
+	VertexBufferLayout MeshFile::Layout() const
+	{
+		VertexBufferLayout layout;
+		for( std::uint32_t i = 0; i < header.attribute_count; i++ )
+		{
+			const auto& attribute = header.attribute_list[ i ];
+			layout.Push( VertexAttribute{ ( int )attribute.count, attribute.type, ( GLboolean )attribute.normalized, 0 } );
+		}
+
+		return layout;
+	}
+
+	bool MeshFile::Validate() const
+	{
+		if( file.Size() < sizeof( Header ) || header.magic != MAGIC || header.version != VERSION )
+			return false;
+
+		if( header.attribute_count == 0 || header.attribute_count > MAX_ATTRIBUTE_COUNT ||
+			( header.index_type != GL_UNSIGNED_SHORT && header.index_type != GL_UNSIGNED_INT ) )
+			return false;
+
+		if( header.vertex_data_size != std::uint64_t( header.vertex_count ) * header.stride ||
+			header.index_data_size	!= std::uint64_t( header.index_count ) * ( header.index_type == GL_UNSIGNED_SHORT ? 2 : 4 ) )
+			return false;
+
+		/* Subtractions instead of additions, so that huge (corrupt) offsets can not overflow. */
+		if( header.vertex_data_offset > file.Size() || header.vertex_data_size > file.Size() - header.vertex_data_offset ||
+			header.index_data_offset  > file.Size() || header.index_data_size  > file.Size() - header.index_data_offset )
+			return false;
+
+		/* Layout() has to describe the same stride; GetSizeOfType() throws for unknown types. */
+		try
+		{
+			if( Layout().GetStride() != header.stride )
+				return false;
+		}
+		catch( const std::runtime_error& )
+		{
+			return false;
+		}
+
+		/* Out of range indices would have the GPU (or users of ToMeshData()) read past the vertices. One linear pass, once at load. */
+		const std::byte* index_data = static_cast< const std::byte* >( IndexData() );
+		return header.index_type == GL_UNSIGNED_SHORT
+			? AreIndicesInRange< std::uint16_t >( index_data, header.index_count, header.vertex_count )
+			: AreIndicesInRange< std::uint32_t >( index_data, header.index_count, header.vertex_count );
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Vector.hpp"
+
+#include "Renderer/VertexBufferLayout.h"
+
+#include "Utility/MemoryMappedFile.h"
+
+// std Includes.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+	/* A mesh in memory, as produced by the importers & stored by MeshFile. */
+	struct MeshData
+	{
+		/* Interleaved, laid out as described by layout. */
+		std::vector< std::byte > vertex_data;
+		unsigned int vertex_count;
+		VertexBufferLayout layout;
+		std::vector< std::uint32_t > indices;
+		/* Of the positions (i.e., the first attribute). */
+		Vector3 bounds_min;
+		Vector3 bounds_max;
+	};
+
+	/* Binary mesh container (".mesh"): A fixed-size header (vertex layout, counts & bounds), followed by the interleaved vertex blob & the index blob,
+	 * both 16-byte aligned & stored exactly as GL expects them. The file is memory mapped; VertexData() & IndexData() point into the mapping & can be handed
+	 * to VertexBuffer/IndexBuffer as is: no parsing & no intermediate copy. Little-endian only. Bump VERSION on any change to the layout of the file. */
+	class MeshFile
+	{
+	public:
+		static constexpr std::uint32_t MAGIC				= 'M' | ( 'E' << 8 ) | ( 'S' << 16 ) | ( 'H' << 24 );
+		static constexpr std::uint32_t VERSION				= 1;
+		static constexpr unsigned int  MAX_ATTRIBUTE_COUNT	= 16;
+
+	public:
+		/* Check IsValid() afterwards; files that can not be opened, have a different version or are inconsistent (e.g., truncated or with indices past the
+		 * vertex count) are reported as invalid. */
+		explicit MeshFile( const std::string& file_path );
+
+		MeshFile( const MeshFile& )				= delete;
+		MeshFile& operator= ( const MeshFile& )	= delete;
+
+		/* Indices are stored as 16-bit if all of them fit. */
+		static bool Write( const std::string& file_path, const MeshData& mesh_data );
+
+		inline bool IsValid() const { return is_valid; }
+
+		/* Copies the contents out of the mapping; for when the mesh is processed further on the CPU rather than uploaded as is. */
+		MeshData ToMeshData() const;
+
+		inline const std::byte* VertexData() const { return file.Data() + header.vertex_data_offset; }
+		inline unsigned int VertexCount() const { return header.vertex_count; }
+		inline unsigned int Stride() const { return header.stride; }
+		VertexBufferLayout Layout() const;
+
+		inline const void* IndexData() const { return file.Data() + header.index_data_offset; }
+		inline unsigned int IndexCount() const { return header.index_count; }
+		/* GL_UNSIGNED_SHORT or GL_UNSIGNED_INT. */
+		inline GLenum IndexType() const { return header.index_type; }
+
+		inline Vector3 BoundsMin() const { return Vector3( header.bounds_min[ 0 ], header.bounds_min[ 1 ], header.bounds_min[ 2 ] ); }
+		inline Vector3 BoundsMax() const { return Vector3( header.bounds_max[ 0 ], header.bounds_max[ 1 ], header.bounds_max[ 2 ] ); }
+
+	private:
+		struct AttributeDescription
+		{
+			std::uint32_t count;
+			std::uint32_t type;
+			std::uint32_t normalized;
+		};
+
+		/* Exactly as stored in the file. */
+		struct Header
+		{
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			std::uint32_t vertex_count;
+			std::uint32_t stride;
+			std::uint32_t index_count;
+			std::uint32_t index_type;
+
+			std::uint32_t attribute_count;
+			std::uint32_t padding;
+			AttributeDescription attribute_list[ MAX_ATTRIBUTE_COUNT ];
+
+			float bounds_min[ 3 ];
+			float bounds_max[ 3 ];
+
+			std::uint64_t vertex_data_offset;
+			std::uint64_t vertex_data_size;
+			std::uint64_t index_data_offset;
+			std::uint64_t index_data_size;
+		};
+
+		static_assert( sizeof( Header ) == 280, "MeshFile::Header: Layout changed; bump VERSION." );
+
+		bool Validate() const;
+
+	private:
+		Utility::MemoryMappedFile file;
+		/* Copied out of the mapping, as the mapping gives no alignment guarantees beyond the page it starts at. */
+		Header header;
+		bool is_valid;
+	};
+}
@@ -0,0 +1,907 @@
+// Framework Includes.
+#include "Renderer/MeshImporter.h"
+
+#include "Utility/JSON.h"
+#include "Utility/MemoryMappedFile.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Framework::MeshImporter
+{
+	namespace
+	{
+		/* Smaller inputs are not split further; below this, the per-chunk overhead (merging, task hand-off) outweighs the gain. */
+		constexpr std::size_t MIN_CHUNK_SIZE = 256 * 1024;
+
+		/* 0-based indices into the position/uv/normal lists; -1 if the corner does not reference one. */
+		struct Corner
+		{
+			int position;
+			int uv;
+			int normal;
+
+			bool operator==( const Corner& ) const = default;
+		};
+
+		std::uint64_t HashOf( const Corner& corner )
+		{
+			std::uint64_t hash = 14695981039346656037ull;
+			hash = ( hash ^ std::uint32_t( corner.position ) ) * 1099511628211ull;
+			hash = ( hash ^ std::uint32_t( corner.uv ) )	   * 1099511628211ull;
+			hash = ( hash ^ std::uint32_t( corner.normal ) )   * 1099511628211ull;
+			return hash ^ ( hash >> 32 );
+		}
+
+		/* Common to all importers: The layout described in MeshImporter.h. */
+		void SetUpLayout( MeshData& mesh_data, const bool has_normals, const bool has_uvs )
+		{
+			mesh_data.layout.Push< float >( 3 );
+			if( has_normals )
+				mesh_data.layout.Push< float >( 3 );
+			if( has_uvs )
+				mesh_data.layout.Push< float >( 2 );
+		}
+
+		void ComputeBounds( MeshData& mesh_data )
+		{
+			mesh_data.bounds_min = Vector3( UNIFORM_INITIALIZATION, std::numeric_limits< float >::max() );
+			mesh_data.bounds_max = Vector3( UNIFORM_INITIALIZATION, std::numeric_limits< float >::lowest() );
+
+			const unsigned int stride = mesh_data.layout.GetStride();
+			for( unsigned int vertex_index = 0; vertex_index < mesh_data.vertex_count; vertex_index++ )
+			{
+				float position[ 3 ];
+				std::memcpy( position, mesh_data.vertex_data.data() + std::size_t( vertex_index ) * stride, sizeof( position ) );
+
+				for( int i = 0; i < 3; i++ )
+				{
+					mesh_data.bounds_min[ i ] = std::min( mesh_data.bounds_min[ i ], position[ i ] );
+					mesh_data.bounds_max[ i ] = std::max( mesh_data.bounds_max[ i ], position[ i ] );
+				}
+			}
+		}
+
+	/* OBJ: */
+
+		/* Parsed independently of the other chunks. Indices that were relative (negative) in the file are resolved against the counts of this chunk only & flagged,
+		 * to be offset by the counts of the preceding chunks when merging. */
+		struct OBJChunk
+		{
+			static constexpr std::uint8_t POSITION_IS_LOCAL = 1, UV_IS_LOCAL = 2, NORMAL_IS_LOCAL = 4;
+
+			struct ChunkCorner
+			{
+				Corner corner;
+				std::uint8_t local_mask;
+			};
+
+			std::vector< Vector3 > position_list;
+			std::vector< Vector2 > uv_list;
+			std::vector< Vector3 > normal_list;
+			std::vector< ChunkCorner > corner_list; // Triangulated; 3 per triangle.
+
+			std::size_t line_count = 0;
+			/* 1-based, within the chunk; 0 if there is none. */
+			std::size_t malformed_line = 0;
+		};
+
+		/* Cursor over the text; all functions stop at the end of the current line. */
+		struct OBJParser
+		{
+			const char* current;
+			const char* end;
+
+			bool IsAtLineEnd() const { return current == end || *current == '\n'; }
+
+			void SkipSpaces()
+			{
+				while( current != end && ( *current == ' ' || *current == '\t' || *current == '\r' ) )
+					current++;
+			}
+
+			void SkipLine()
+			{
+				const void* line_end = std::memchr( current, '\n', end - current );
+				current = line_end ? static_cast< const char* >( line_end ) + 1 : end;
+			}
+
+			/* Returns whether the line continues with the given keyword followed by white space. */
+			bool ConsumeKeyword( const std::string_view keyword )
+			{
+				if( std::size_t( end - current ) <= keyword.size() || std::memcmp( current, keyword.data(), keyword.size() ) != 0 ||
+					( current[ keyword.size() ] != ' ' && current[ keyword.size() ] != '\t' ) )
+					return false;
+
+				current += keyword.size();
+				return true;
+			}
+
+			bool ParseFloat( float& value )
+			{
+				SkipSpaces();
+				const auto [ pointer, error ] = std::from_chars( current, end, value );
+				if( error != std::errc() )
+					return false;
+
+				current = pointer;
+				return true;
+			}
+
+			/* 1-based or negative (relative to the end of the list so far); 0 is invalid. */
+			bool ParseIndex( int& resolved_index, std::uint8_t& local_mask, const std::uint8_t local_bit, const std::size_t local_count )
+			{
+				int index;
+				const auto [ pointer, error ] = std::from_chars( current, end, index );
+				if( error != std::errc() || index == 0 )
+					return false;
+
+				current = pointer;
+				if( index > 0 )
+					resolved_index = index - 1;
+				else
+				{
+					/* May be negative here if it refers to an element of a preceding chunk; the merge adds the offset of this chunk. */
+					resolved_index = int( local_count ) + index;
+					local_mask |= local_bit;
+				}
+
+				return true;
+			}
+
+			/* "v", "v/vt", "v//vn" or "v/vt/vn". */
+			bool ParseCorner( OBJChunk::ChunkCorner& chunk_corner, const OBJChunk& chunk )
+			{
+				chunk_corner = { { -1, -1, -1 }, 0 };
+
+				if( !ParseIndex( chunk_corner.corner.position, chunk_corner.local_mask, OBJChunk::POSITION_IS_LOCAL, chunk.position_list.size() ) )
+					return false;
+
+				if( current != end && *current == '/' )
+				{
+					current++;
+					if( current != end && *current != '/' &&
+						!ParseIndex( chunk_corner.corner.uv, chunk_corner.local_mask, OBJChunk::UV_IS_LOCAL, chunk.uv_list.size() ) )
+						return false;
+
+					if( current != end && *current == '/' )
+					{
+						current++;
+						if( !ParseIndex( chunk_corner.corner.normal, chunk_corner.local_mask, OBJChunk::NORMAL_IS_LOCAL, chunk.normal_list.size() ) )
+							return false;
+					}
+				}
+
+				return true;
+			}
+		};
+
+		void ParseOBJChunk( const char* begin, const char* end, OBJChunk& chunk )
+		{
+			OBJParser parser{ begin, end };
+			std::vector< OBJChunk::ChunkCorner > polygon;
+
+			for( ; parser.current != parser.end; parser.SkipLine() )
+			{
+				chunk.line_count++;
+				parser.SkipSpaces();
+
+				bool is_valid = true;
+				if( parser.ConsumeKeyword( "v" ) )
+				{
+					Vector3& position = chunk.position_list.emplace_back();
+					is_valid = parser.ParseFloat( position[ 0 ] ) && parser.ParseFloat( position[ 1 ] ) && parser.ParseFloat( position[ 2 ] );
+				}
+				else if( parser.ConsumeKeyword( "vt" ) )
+				{
+					Vector2& uv = chunk.uv_list.emplace_back();
+					is_valid = parser.ParseFloat( uv[ 0 ] ) && parser.ParseFloat( uv[ 1 ] );
+				}
+				else if( parser.ConsumeKeyword( "vn" ) )
+				{
+					Vector3& normal = chunk.normal_list.emplace_back();
+					is_valid = parser.ParseFloat( normal[ 0 ] ) && parser.ParseFloat( normal[ 1 ] ) && parser.ParseFloat( normal[ 2 ] );
+				}
+				else if( parser.ConsumeKeyword( "f" ) )
+				{
+					polygon.clear();
+					for( parser.SkipSpaces(); is_valid && !parser.IsAtLineEnd(); parser.SkipSpaces() )
+						is_valid = parser.ParseCorner( polygon.emplace_back(), chunk );
+
+					is_valid = is_valid && polygon.size() >= 3;
+
+					for( std::size_t i = 2; is_valid && i < polygon.size(); i++ )
+						chunk.corner_list.insert( chunk.corner_list.end(), { polygon[ 0 ], polygon[ i - 1 ], polygon[ i ] } );
+				}
+
+				if( !is_valid )
+				{
+					chunk.malformed_line = chunk.line_count;
+					return;
+				}
+			}
+		}
+
+		/* Splits the text at line boundaries into chunks of roughly equal size, one per thread (at most). */
+		std::vector< std::pair< const char*, const char* > > SplitIntoChunks( const char* begin, const char* end, const std::size_t max_chunk_count )
+		{
+			const std::size_t size		  = end - begin;
+			const std::size_t chunk_count = std::clamp< std::size_t >( size / MIN_CHUNK_SIZE, 1, max_chunk_count );
+
+			std::vector< std::pair< const char*, const char* > > chunk_list;
+			const char* chunk_begin = begin;
+			for( std::size_t i = 1; i <= chunk_count; i++ )
+			{
+				const char* chunk_end = i == chunk_count ? end : std::max( chunk_begin, begin + size * i / chunk_count );
+				if( chunk_end != end )
+				{
+					const void* line_end = std::memchr( chunk_end, '\n', end - chunk_end );
+					chunk_end = line_end ? static_cast< const char* >( line_end ) + 1 : end;
+				}
+
+				if( chunk_end != chunk_begin )
+					chunk_list.emplace_back( chunk_begin, chunk_end );
+
+				chunk_begin = chunk_end;
+			}
+
+			return chunk_list;
+		}
+
+	/* glTF: */
+
+		/* Owns whatever backs the buffers: the file mappings of external buffers & decoded data URIs. */
+		struct GLTFBufferStorage
+		{
+			std::vector< std::unique_ptr< Utility::MemoryMappedFile > > mapped_file_list;
+			std::vector< std::vector< std::byte > > decoded_data_list;
+		};
+
+		struct GLTFBuffer
+		{
+			const std::byte* data;
+			std::size_t size;
+		};
+
+		struct GLTFAccessor
+		{
+			const std::byte* data;
+			std::size_t count;
+			std::size_t stride;
+			int component_type;
+			int component_count;
+			bool normalized;
+		};
+
+		constexpr int GLTF_BYTE			  = 5120;
+		constexpr int GLTF_UNSIGNED_BYTE  = 5121;
+		constexpr int GLTF_SHORT		  = 5122;
+		constexpr int GLTF_UNSIGNED_SHORT = 5123;
+		constexpr int GLTF_UNSIGNED_INT	  = 5125;
+		constexpr int GLTF_FLOAT		  = 5126;
+
+		constexpr int GLTF_MODE_TRIANGLES = 4;
+
+		int ComponentSize( const int component_type )
+		{
+			switch( component_type )
+			{
+				case GLTF_BYTE:
+				case GLTF_UNSIGNED_BYTE:	return 1;
+				case GLTF_SHORT:
+				case GLTF_UNSIGNED_SHORT:	return 2;
+				case GLTF_UNSIGNED_INT:
+				case GLTF_FLOAT:			return 4;
+
+				default:					return 0;
+			}
+		}
+
+		int ComponentCount( const std::string& type )
+		{
+			if( type == "SCALAR" )	return 1;
+			if( type == "VEC2" )	return 2;
+			if( type == "VEC3" )	return 3;
+			if( type == "VEC4" )	return 4;
+
+			return 0;
+		}
+
+		template< typename Integer >
+		Integer Read( const std::byte* data )
+		{
+			Integer value;
+			std::memcpy( &value, data, sizeof( Integer ) );
+			return value;
+		}
+
+		/* Floats as is, normalized integers converted to [0, 1] or [-1, 1]. */
+		float ReadComponent( const std::byte* data, const int component_type )
+		{
+			switch( component_type )
+			{
+				case GLTF_FLOAT:			return Read< float >( data );
+				case GLTF_UNSIGNED_BYTE:	return Read< std::uint8_t >( data ) / 255.0f;
+				case GLTF_UNSIGNED_SHORT:	return Read< std::uint16_t >( data ) / 65535.0f;
+				case GLTF_BYTE:				return std::max( Read< std::int8_t >( data ) / 127.0f, -1.0f );
+				case GLTF_SHORT:			return std::max( Read< std::int16_t >( data ) / 32767.0f, -1.0f );
+
+				default:					return 0.0f;
+			}
+		}
+
+		std::uint32_t ReadIndex( const std::byte* data, const int component_type )
+		{
+			switch( component_type )
+			{
+				case GLTF_UNSIGNED_BYTE:	return Read< std::uint8_t >( data );
+				case GLTF_UNSIGNED_SHORT:	return Read< std::uint16_t >( data );
+
+				default:					return Read< std::uint32_t >( data );
+			}
+		}
+
+		/* Returns false on invalid characters or a length that is not a multiple of 4. The 4-character groups are decoded in parallel. */
+		bool DecodeBase64( const std::string_view text, std::vector< std::byte >& data, Utility::ThreadPool& thread_pool )
+		{
+			if( text.size() % 4 != 0 )
+				return false;
+
+			static const auto table = []()
+			{
+				std::array< std::int8_t, 256 > table;
+				table.fill( -1 );
+				const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+				for( int i = 0; i < 64; i++ )
+					table[ ( unsigned char )alphabet[ i ] ] = std::int8_t( i );
+
+				return table;
+			}();
+
+			const std::size_t padding_count = text.empty() || text.back() != '=' ? 0 : 1 + ( text[ text.size() - 2 ] == '=' );
+			const std::size_t group_count	= text.size() / 4;
+			data.resize( group_count * 3 - padding_count );
+
+			std::atomic< bool > is_valid = true;
+			thread_pool.ParallelFor( group_count, 64 * 1024, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				for( std::size_t group = begin; group < end; group++ )
+				{
+					const bool is_last_group = group == group_count - 1;
+
+					std::uint32_t bits = 0;
+					for( int i = 0; i < 4; i++ )
+					{
+						const char character = text[ group * 4 + i ];
+						const int value = is_last_group && character == '=' && i >= 4 - int( padding_count ) ? 0 : table[ ( unsigned char )character ];
+						if( value < 0 )
+						{
+							is_valid = false;
+							return;
+						}
+
+						bits = ( bits << 6 ) | std::uint32_t( value );
+					}
+
+					const std::size_t byte_count = is_last_group ? 3 - padding_count : 3;
+					for( std::size_t i = 0; i < byte_count; i++ )
+						data[ group * 3 + i ] = std::byte( bits >> ( 16 - 8 * i ) );
+				}
+			} );
+
+			return is_valid;
+		}
+
+		std::string DecodePercentEscapes( const std::string& uri )
+		{
+			std::string decoded;
+			for( std::size_t i = 0; i < uri.size(); i++ )
+			{
+				unsigned int character;
+				if( uri[ i ] == '%' && i + 2 < uri.size() && std::from_chars( uri.data() + i + 1, uri.data() + i + 3, character, 16 ).ec == std::errc() )
+				{
+					decoded += char( character );
+					i += 2;
+				}
+				else
+					decoded += uri[ i ];
+			}
+
+			return decoded;
+		}
+
+		/* Non-negative integers only; anything else (including a missing member) gives the fallback. */
+		std::size_t Integer( const Utility::JSON::Value* value, const std::size_t fallback )
+		{
+			return value && value->AsNumber( -1.0 ) >= 0.0 && value->AsNumber() < 9.0e15 ? std::size_t( value->AsNumber() ) : fallback;
+		}
+
+		/* The element at the given index of the array member with the given key; a null Value if either does not exist. */
+		const Utility::JSON::Value& ArrayElement( const Utility::JSON::Value& object, const char* key, const std::size_t index )
+		{
+			static const Utility::JSON::Value null_value;
+			const auto* array = object.Find( key );
+			return array ? ( *array )[ index ] : null_value;
+		}
+
+		/* Validates the accessor against its buffer view & buffer, so that reads through the returned view can not go out of bounds. */
+		bool ResolveAccessor( const Utility::JSON::Value& document, const std::vector< GLTFBuffer >& buffer_list, const std::size_t accessor_index,
+							  GLTFAccessor& accessor_view )
+		{
+			constexpr std::size_t INVALID = std::numeric_limits< std::size_t >::max();
+
+			const auto& accessor = ArrayElement( document, "accessors", accessor_index );
+			if( !accessor.IsObject() || accessor.Find( "sparse" ) || !accessor.Find( "bufferView" ) )
+				return false;
+
+			const auto& buffer_view = ArrayElement( document, "bufferViews", Integer( accessor.Find( "bufferView" ), INVALID ) );
+			const std::size_t buffer_index = Integer( buffer_view.Find( "buffer" ), INVALID );
+			if( !buffer_view.IsObject() || buffer_index >= buffer_list.size() )
+				return false;
+
+			const auto* type = accessor.Find( "type" );
+			const auto* normalized = accessor.Find( "normalized" );
+			accessor_view.component_type  = int( Integer( accessor.Find( "componentType" ), 0 ) );
+			accessor_view.component_count = ComponentCount( type ? type->AsString() : "" );
+			accessor_view.count			  = Integer( accessor.Find( "count" ), 0 );
+			accessor_view.normalized	  = normalized && normalized->AsBoolean();
+
+			const std::size_t element_size	  = std::size_t( ComponentSize( accessor_view.component_type ) ) * accessor_view.component_count;
+			const std::size_t view_offset	  = Integer( buffer_view.Find( "byteOffset" ), 0 );
+			const std::size_t view_length	  = Integer( buffer_view.Find( "byteLength" ), 0 );
+			const std::size_t accessor_offset = Integer( accessor.Find( "byteOffset" ), 0 );
+			accessor_view.stride			  = Integer( buffer_view.Find( "byteStride" ), 0 );
+			if( accessor_view.stride == 0 )
+				accessor_view.stride = element_size;
+
+			const GLTFBuffer& buffer = buffer_list[ buffer_index ];
+			if( element_size == 0 || accessor_view.count == 0 || accessor_view.count > view_length || accessor_view.stride > view_length ||
+				view_offset > buffer.size || view_length > buffer.size - view_offset || accessor_offset > view_length ||
+				( accessor_view.count - 1 ) * accessor_view.stride + element_size > view_length - accessor_offset )
+				return false;
+
+			accessor_view.data = buffer.data + view_offset + accessor_offset;
+			return true;
+		}
+	}
+
+	std::optional< MeshData > Import( const std::string& file_path, const ImportSettings& settings )
+	{
+		Utility::ThreadPool& thread_pool = settings.thread_pool ? *settings.thread_pool : Utility::ThreadPool::Default();
+
+		const std::string cache_file_path = file_path + ".mesh";
+		if( settings.use_cache )
+		{
+			std::error_code source_error, cache_error;
+			const auto source_time = std::filesystem::last_write_time( file_path, source_error );
+			const auto cache_time  = std::filesystem::last_write_time( cache_file_path, cache_error );
+			if( !source_error && !cache_error && cache_time >= source_time )
+			{
+				const MeshFile mesh_file( cache_file_path );
+				if( mesh_file.IsValid() )
+					return mesh_file.ToMeshData();
+			}
+		}
+
+		std::string extension = std::filesystem::path( file_path ).extension().string();
+		std::transform( extension.begin(), extension.end(), extension.begin(), []( const unsigned char character ) { return char( std::tolower( character ) ); } );
+
+		std::optional< MeshData > mesh_data;
+		if( extension == ".obj" )
+			mesh_data = ImportOBJ( file_path, thread_pool );
+		else if( extension == ".gltf" || extension == ".glb" )
+			mesh_data = ImportGLTF( file_path, thread_pool );
+		else
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::UNSUPPORTED_FILE_TYPE: " << file_path << "\n";
+			return std::nullopt;
+		}
+
+		if( mesh_data && settings.use_cache )
+			MeshFile::Write( cache_file_path, *mesh_data );
+
+		return mesh_data;
+	}
+
+	std::optional< MeshData > ImportOBJ( const std::string& file_path, Utility::ThreadPool& thread_pool )
+	{
+		const Utility::MemoryMappedFile file( file_path );
+		if( !file.IsOpen() )
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::OBJ::COULD_NOT_OPEN_FILE: " << file_path << "\n";
+			return std::nullopt;
+		}
+
+		const char* text = reinterpret_cast< const char* >( file.Data() );
+		const auto range_list = SplitIntoChunks( text, text + file.Size(), thread_pool.ThreadCount() + 1 );
+
+		/* 1) Parse the chunks in parallel. */
+		std::vector< OBJChunk > chunk_list( range_list.size() );
+		thread_pool.ParallelFor( chunk_list.size(), 1, [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			for( std::size_t i = begin; i < end; i++ )
+				ParseOBJChunk( range_list[ i ].first, range_list[ i ].second, chunk_list[ i ] );
+		} );
+
+		/* 2) Prefix sums of the per-chunk counts. */
+		struct ChunkOffsets
+		{
+			std::size_t position, uv, normal, corner;
+		};
+
+		std::vector< ChunkOffsets > offset_list( chunk_list.size() + 1, ChunkOffsets{} );
+		std::size_t line_offset = 0;
+		for( std::size_t i = 0; i < chunk_list.size(); i++ )
+		{
+			const OBJChunk& chunk = chunk_list[ i ];
+			if( chunk.malformed_line != 0 )
+			{
+				std::cerr << "ERROR::MESH_IMPORTER::OBJ::MALFORMED_LINE: " << file_path << "(" << line_offset + chunk.malformed_line << ")\n";
+				return std::nullopt;
+			}
+
+			line_offset += chunk.line_count;
+			offset_list[ i + 1 ] = { offset_list[ i ].position + chunk.position_list.size(), offset_list[ i ].uv + chunk.uv_list.size(),
+									 offset_list[ i ].normal + chunk.normal_list.size(), offset_list[ i ].corner + chunk.corner_list.size() };
+		}
+
+		const ChunkOffsets& totals = offset_list.back();
+		if( totals.corner == 0 )
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::OBJ::NO_FACES: " << file_path << "\n";
+			return std::nullopt;
+		}
+
+		/* 3) Merge into global lists, in parallel: Each chunk copies its elements to its own offset & makes its chunk-local indices global. */
+		std::vector< Vector3 > position_list( totals.position );
+		std::vector< Vector2 > uv_list( totals.uv );
+		std::vector< Vector3 > normal_list( totals.normal );
+		std::vector< Corner >  corner_list( totals.corner );
+
+		std::atomic< bool > indices_are_valid = true;
+		thread_pool.ParallelFor( chunk_list.size(), 1, [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			for( std::size_t i = begin; i < end; i++ )
+			{
+				const OBJChunk& chunk		 = chunk_list[ i ];
+				const ChunkOffsets& offsets = offset_list[ i ];
+
+				std::copy( chunk.position_list.cbegin(), chunk.position_list.cend(), position_list.begin() + offsets.position );
+				std::copy( chunk.uv_list.cbegin(),		 chunk.uv_list.cend(),		 uv_list.begin()	   + offsets.uv );
+				std::copy( chunk.normal_list.cbegin(),	 chunk.normal_list.cend(),	 normal_list.begin()   + offsets.normal );
+
+				const auto resolve = []( const int index, const bool is_local, const std::size_t offset, const std::size_t count )
+				{
+					const long long global_index = is_local ? ( long long )offset + index : index;
+					return global_index >= 0 && global_index < ( long long )count ? int( global_index ) : -2; // -2: Out of range.
+				};
+
+				for( std::size_t j = 0; j < chunk.corner_list.size(); j++ )
+				{
+					const auto& [ corner, local_mask ] = chunk.corner_list[ j ];
+					Corner& global_corner = corner_list[ offsets.corner + j ];
+
+					global_corner.position = resolve( corner.position, local_mask & OBJChunk::POSITION_IS_LOCAL, offsets.position, totals.position );
+					global_corner.uv	   = corner.uv < 0 && !( local_mask & OBJChunk::UV_IS_LOCAL ) ? -1
+												: resolve( corner.uv, local_mask & OBJChunk::UV_IS_LOCAL, offsets.uv, totals.uv );
+					global_corner.normal   = corner.normal < 0 && !( local_mask & OBJChunk::NORMAL_IS_LOCAL ) ? -1
+												: resolve( corner.normal, local_mask & OBJChunk::NORMAL_IS_LOCAL, offsets.normal, totals.normal );
+
+					if( global_corner.position < 0 || global_corner.uv == -2 || global_corner.normal == -2 )
+						indices_are_valid = false;
+				}
+			}
+		} );
+
+		chunk_list = {};
+
+		if( !indices_are_valid )
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::OBJ::INDEX_OUT_OF_RANGE: " << file_path << "\n";
+			return std::nullopt;
+		}
+
+		/* 4) Merge identical corners into vertices. Open addressing with linear probing over a power-of-two table kept at most half full;
+		 * a slot holds (vertex index + 1), 0 is empty. Serial, but only hashing & comparing 12-byte keys. */
+		MeshData mesh_data;
+		std::vector< Corner > vertex_corner_list; // The corner each vertex was created from.
+		{
+			std::size_t table_size = 16;
+			while( table_size < corner_list.size() * 2 )
+				table_size *= 2;
+
+			const std::size_t table_mask = table_size - 1;
+			std::vector< std::uint32_t > table( table_size, 0 );
+
+			mesh_data.indices.resize( corner_list.size() );
+			for( std::size_t i = 0; i < corner_list.size(); i++ )
+			{
+				const Corner& corner = corner_list[ i ];
+				for( std::size_t slot_index = HashOf( corner ) & table_mask; ; slot_index = ( slot_index + 1 ) & table_mask )
+				{
+					std::uint32_t& slot = table[ slot_index ];
+					if( slot == 0 )
+					{
+						vertex_corner_list.push_back( corner );
+						slot = ( std::uint32_t )vertex_corner_list.size();
+					}
+
+					if( vertex_corner_list[ slot - 1 ] == corner )
+					{
+						mesh_data.indices[ i ] = slot - 1;
+						break;
+					}
+				}
+			}
+		}
+
+		/* 5) Build the interleaved vertices, in parallel. */
+		const bool has_normals = !normal_list.empty();
+		const bool has_uvs	   = !uv_list.empty();
+		SetUpLayout( mesh_data, has_normals, has_uvs );
+
+		const std::size_t component_count = mesh_data.layout.GetStride() / sizeof( float );
+		mesh_data.vertex_count = ( unsigned int )vertex_corner_list.size();
+		mesh_data.vertex_data.resize( vertex_corner_list.size() * mesh_data.layout.GetStride() );
+
+		float* vertices = reinterpret_cast< float* >( mesh_data.vertex_data.data() );
+		thread_pool.ParallelFor( vertex_corner_list.size(), 16 * 1024, [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			for( std::size_t vertex_index = begin; vertex_index < end; vertex_index++ )
+			{
+				const Corner& corner = vertex_corner_list[ vertex_index ];
+				float* vertex = vertices + vertex_index * component_count;
+
+				vertex = std::copy_n( position_list[ corner.position ].Data(), 3, vertex );
+				if( has_normals )
+					vertex = corner.normal >= 0 ? std::copy_n( normal_list[ corner.normal ].Data(), 3, vertex ) : std::fill_n( vertex, 3, 0.0f );
+				if( has_uvs )
+					vertex = corner.uv >= 0 ? std::copy_n( uv_list[ corner.uv ].Data(), 2, vertex ) : std::fill_n( vertex, 2, 0.0f );
+			}
+		} );
+
+		ComputeBounds( mesh_data );
+		return mesh_data;
+	}
+
+	std::optional< MeshData > ImportGLTF( const std::string& file_path, Utility::ThreadPool& thread_pool )
+	{
+		const Utility::MemoryMappedFile file( file_path );
+		if( !file.IsOpen() )
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::GLTF::COULD_NOT_OPEN_FILE: " << file_path << "\n";
+			return std::nullopt;
+		}
+
+		const auto fail = [ & ]( const char* reason ) -> std::optional< MeshData >
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::GLTF::" << reason << ": " << file_path << "\n";
+			return std::nullopt;
+		};
+
+		/* .glb: 12-byte header (magic, version, length), then chunks of (length, type, data): JSON first, then optionally the binary buffer. */
+		std::string_view json_text( reinterpret_cast< const char* >( file.Data() ), file.Size() );
+		std::optional< GLTFBuffer > glb_binary_chunk;
+		if( file.Size() >= 12 && std::memcmp( file.Data(), "glTF", 4 ) == 0 )
+		{
+			constexpr std::uint32_t CHUNK_TYPE_JSON = 0x4E4F534A, CHUNK_TYPE_BIN = 0x004E4942;
+
+			if( Read< std::uint32_t >( file.Data() + 4 ) != 2 )
+				return fail( "UNSUPPORTED_GLB_VERSION" );
+
+			json_text = {};
+			for( std::size_t offset = 12; offset + 8 <= file.Size(); )
+			{
+				const std::size_t chunk_length = Read< std::uint32_t >( file.Data() + offset );
+				const std::uint32_t chunk_type = Read< std::uint32_t >( file.Data() + offset + 4 );
+				if( chunk_length > file.Size() - offset - 8 )
+					return fail( "TRUNCATED_GLB_CHUNK" );
+
+				const std::byte* chunk_data = file.Data() + offset + 8;
+				if( chunk_type == CHUNK_TYPE_JSON && json_text.empty() )
+					json_text = std::string_view( reinterpret_cast< const char* >( chunk_data ), chunk_length );
+				else if( chunk_type == CHUNK_TYPE_BIN && !glb_binary_chunk )
+					glb_binary_chunk = GLTFBuffer{ chunk_data, chunk_length };
+
+				offset += 8 + ( chunk_length + 3 ) / 4 * 4;
+			}
+		}
+
+		std::string json_error;
+		const auto document = Utility::JSON::Parse( json_text, &json_error );
+		if( !document )
+		{
+			std::cerr << "ERROR::MESH_IMPORTER::GLTF::MALFORMED_JSON: " << file_path << ": " << json_error << "\n";
+			return std::nullopt;
+		}
+
+		/* Buffers. */
+		GLTFBufferStorage buffer_storage;
+		std::vector< GLTFBuffer > buffer_list;
+		if( const auto* buffers = document->Find( "buffers" ) )
+		{
+			for( std::size_t i = 0; i < buffers->Size(); i++ )
+			{
+				const auto& buffer = ( *buffers )[ i ];
+				const std::size_t byte_length = Integer( buffer.Find( "byteLength" ), 0 );
+				const auto* uri = buffer.Find( "uri" );
+
+				GLTFBuffer buffer_data{};
+				if( !uri )
+				{
+					if( i != 0 || !glb_binary_chunk )
+						return fail( "BUFFER_WITHOUT_DATA" );
+
+					buffer_data = *glb_binary_chunk;
+				}
+				else if( uri->AsString().starts_with( "data:" ) )
+				{
+					const std::string_view data_uri = uri->AsString();
+					const std::size_t base64_marker = data_uri.find( ";base64," );
+					if( base64_marker == std::string_view::npos )
+						return fail( "UNSUPPORTED_DATA_URI" );
+
+					auto& decoded_data = buffer_storage.decoded_data_list.emplace_back();
+					if( !DecodeBase64( data_uri.substr( base64_marker + 8 ), decoded_data, thread_pool ) )
+						return fail( "MALFORMED_BASE64" );
+
+					buffer_data = { decoded_data.data(), decoded_data.size() };
+				}
+				else
+				{
+					const auto buffer_file_path = std::filesystem::path( file_path ).parent_path() / DecodePercentEscapes( uri->AsString() );
+					const auto& mapped_file		= buffer_storage.mapped_file_list.emplace_back( std::make_unique< Utility::MemoryMappedFile >( buffer_file_path.string() ) );
+					if( !mapped_file->IsOpen() )
+					{
+						std::cerr << "ERROR::MESH_IMPORTER::GLTF::COULD_NOT_OPEN_BUFFER_FILE: " << buffer_file_path.string() << "\n";
+						return std::nullopt;
+					}
+
+					buffer_data = { mapped_file->Data(), mapped_file->Size() };
+				}
+
+				if( buffer_data.size < byte_length )
+					return fail( "BUFFER_SMALLER_THAN_BYTE_LENGTH" );
+
+				buffer_data.size = byte_length;
+				buffer_list.push_back( buffer_data );
+			}
+		}
+
+		/* Primitives: Resolve & validate all accessors up front, so that the parallel part below can not fail except for out-of-range indices. */
+		struct Primitive
+		{
+			GLTFAccessor position, normal, uv, indices;
+			bool has_normals, has_uvs, is_indexed;
+			std::size_t first_vertex, first_index, index_count;
+		};
+
+		std::vector< Primitive > primitive_list;
+		std::size_t vertex_count = 0, index_count = 0;
+		bool has_normals = false, has_uvs = false;
+
+		if( const auto* meshes = document->Find( "meshes" ) )
+		{
+			for( std::size_t mesh_index = 0; mesh_index < meshes->Size(); mesh_index++ )
+			{
+				const auto* primitives = ( *meshes )[ mesh_index ].Find( "primitives" );
+				for( std::size_t primitive_index = 0; primitives && primitive_index < primitives->Size(); primitive_index++ )
+				{
+					const auto& primitive  = ( *primitives )[ primitive_index ];
+					const auto* attributes = primitive.Find( "attributes" );
+					const auto* mode	   = primitive.Find( "mode" );
+					if( !attributes || !attributes->Find( "POSITION" ) || Integer( mode, GLTF_MODE_TRIANGLES ) != GLTF_MODE_TRIANGLES )
+						continue; // Not a triangle list; skipped.
+
+					Primitive& entry = primitive_list.emplace_back();
+					const auto resolve = [ & ]( const Utility::JSON::Value* index, GLTFAccessor& accessor_view )
+					{
+						return index && ResolveAccessor( *document, buffer_list, Integer( index, std::numeric_limits< std::size_t >::max() ), accessor_view );
+					};
+
+					if( !resolve( attributes->Find( "POSITION" ), entry.position ) ||
+						entry.position.component_type != GLTF_FLOAT || entry.position.component_count != 3 )
+						return fail( "INVALID_POSITION_ACCESSOR" );
+
+					entry.has_normals = resolve( attributes->Find( "NORMAL" ), entry.normal );
+					if( entry.has_normals && ( entry.normal.component_type != GLTF_FLOAT || entry.normal.component_count != 3 || entry.normal.count != entry.position.count ) )
+						return fail( "INVALID_NORMAL_ACCESSOR" );
+
+					entry.has_uvs = resolve( attributes->Find( "TEXCOORD_0" ), entry.uv );
+					if( entry.has_uvs && ( entry.uv.component_count != 2 || entry.uv.count != entry.position.count ||
+										   ( entry.uv.component_type != GLTF_FLOAT && !entry.uv.normalized ) ) )
+						return fail( "INVALID_TEXCOORD_ACCESSOR" );
+
+					entry.is_indexed = primitive.Find( "indices" ) != nullptr;
+					if( entry.is_indexed && ( !resolve( primitive.Find( "indices" ), entry.indices ) || entry.indices.component_count != 1 ||
+											  ( entry.indices.component_type != GLTF_UNSIGNED_BYTE && entry.indices.component_type != GLTF_UNSIGNED_SHORT &&
+												entry.indices.component_type != GLTF_UNSIGNED_INT ) ) )
+						return fail( "INVALID_INDEX_ACCESSOR" );
+
+					entry.first_vertex = vertex_count;
+					entry.first_index  = index_count;
+					entry.index_count  = entry.is_indexed ? entry.indices.count : entry.position.count;
+					if( entry.index_count % 3 != 0 )
+						return fail( "INDEX_COUNT_NOT_A_MULTIPLE_OF_3" );
+
+					vertex_count += entry.position.count;
+					index_count	 += entry.index_count;
+					has_normals	  = has_normals || entry.has_normals;
+					has_uvs		  = has_uvs		|| entry.has_uvs;
+				}
+			}
+		}
+
+		if( primitive_list.empty() )
+			return fail( "NO_TRIANGLE_PRIMITIVES" );
+		if( vertex_count > std::numeric_limits< std::uint32_t >::max() )
+			return fail( "TOO_MANY_VERTICES" );
+
+		MeshData mesh_data;
+		SetUpLayout( mesh_data, has_normals, has_uvs );
+
+		const std::size_t component_count = mesh_data.layout.GetStride() / sizeof( float );
+		mesh_data.vertex_count = ( unsigned int )vertex_count;
+		mesh_data.vertex_data.resize( vertex_count * mesh_data.layout.GetStride() );
+		mesh_data.indices.resize( index_count );
+
+		/* Gather the attributes into interleaved vertices & rebase the indices, in parallel. */
+		float* vertices = reinterpret_cast< float* >( mesh_data.vertex_data.data() );
+		std::atomic< bool > indices_are_valid = true;
+		for( const auto& primitive : primitive_list )
+		{
+			thread_pool.ParallelFor( primitive.position.count, 16 * 1024, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				for( std::size_t i = begin; i < end; i++ )
+				{
+					float* vertex = vertices + ( primitive.first_vertex + i ) * component_count;
+
+					const auto gather = [ & ]( const GLTFAccessor& accessor_view )
+					{
+						const std::byte* element = accessor_view.data + i * accessor_view.stride;
+						const int component_size = ComponentSize( accessor_view.component_type );
+						for( int component = 0; component < accessor_view.component_count; component++ )
+							*vertex++ = ReadComponent( element + component * component_size, accessor_view.component_type );
+					};
+
+					gather( primitive.position );
+					if( has_normals )
+						primitive.has_normals ? gather( primitive.normal ) : void( vertex = std::fill_n( vertex, 3, 0.0f ) );
+					if( has_uvs )
+						primitive.has_uvs ? gather( primitive.uv ) : void( vertex = std::fill_n( vertex, 2, 0.0f ) );
+				}
+			} );
+
+			thread_pool.ParallelFor( primitive.index_count, 64 * 1024, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				for( std::size_t i = begin; i < end; i++ )
+				{
+					const std::uint32_t index = primitive.is_indexed
+													? ReadIndex( primitive.indices.data + i * primitive.indices.stride, primitive.indices.component_type )
+													: std::uint32_t( i );
+					if( index >= primitive.position.count )
+						indices_are_valid = false;
+
+					mesh_data.indices[ primitive.first_index + i ] = std::uint32_t( primitive.first_vertex + index );
+				}
+			} );
+		}
+
+		if( !indices_are_valid )
+			return fail( "INDEX_OUT_OF_RANGE" );
+
+		ComputeBounds( mesh_data );
+		return mesh_data;
+	}
+}
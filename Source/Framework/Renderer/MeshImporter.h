@@ -0,0 +1,36 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/MeshFile.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <optional>
+#include <string>
+
+namespace Framework::MeshImporter
+{
+	/* All importers produce the same layout: float positions, plus float normals & uvs if the file has any (in this order).
+	 * Vertices without a normal/uv get zeroes. Files are memory mapped & parsed in chunks on the given thread pool. */
+
+	struct ImportSettings
+	{
+		/* nullptr: Utility::ThreadPool::Default(). */
+		Utility::ThreadPool* thread_pool = nullptr;
+		/* Writes the result to "<file_path>.mesh" & loads that instead on later imports, as long as it is not older than the source file. */
+		bool use_cache = false;
+	};
+
+	/* Picks the importer by extension: .obj, .gltf or .glb. Returns std::nullopt (& logs the reason) on failure. */
+	std::optional< MeshData > Import( const std::string& file_path, const ImportSettings& settings = {} );
+
+	/* Wavefront OBJ: Polygons are triangulated as fans. Corners sharing the same position/uv/normal triplet become a single vertex.
+	 * Materials, groups & smoothing groups are ignored. Returns std::nullopt (& logs the reason) if the file can not be read, is malformed or has no faces. */
+	std::optional< MeshData > ImportOBJ( const std::string& file_path, Utility::ThreadPool& thread_pool = Utility::ThreadPool::Default() );
+
+	/* glTF 2.0, as .gltf (JSON; buffers in external files or embedded as base64 data URIs) or .glb (binary container).
+	 * All triangle-list primitives of all meshes are merged into one mesh, in the meshes' local spaces (node transforms are not applied).
+	 * Reads POSITION, NORMAL & TEXCOORD_0 (float, or normalized unsigned byte/short uvs); sparse accessors & Draco compression are not supported. */
+	std::optional< MeshData > ImportGLTF( const std::string& file_path, Utility::ThreadPool& thread_pool = Utility::ThreadPool::Default() );
+}
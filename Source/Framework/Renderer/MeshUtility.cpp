@@ -0,0 +1,371 @@
+// Framework Includes.
+#include "Core/Assert.h"
+
+#include "Renderer/MeshUtility.hpp"
+
+// std Includes.
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Framework::MeshUtility
+{
+	namespace
+	{
+		/* Scoring as tuned in Forsyth's article. The cache simulated for scoring is an LRU of this size; the result is good for any real cache up to this size. */
+		constexpr int FORSYTH_CACHE_SIZE			= 32;
+		constexpr int FORSYTH_MAX_VALENCE			= 32; // Higher valences score the same as this.
+		constexpr float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+		constexpr float FORSYTH_CACHE_DECAY_POWER	= 1.5f;
+		constexpr float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+		constexpr float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+		struct ForsythScoreTable
+		{
+			float cache_position[ FORSYTH_CACHE_SIZE ];
+			float valence[ FORSYTH_MAX_VALENCE + 1 ];
+
+			ForsythScoreTable()
+			{
+				for( int position = 0; position < FORSYTH_CACHE_SIZE; position++ )
+				{
+					/* The vertices of the last triangle get a fixed score, so that the next one is not just a strip-like continuation that wastes the cache. */
+					cache_position[ position ] = position < 3
+													? FORSYTH_LAST_TRIANGLE_SCORE
+													: std::pow( 1.0f - float( position - 3 ) / ( FORSYTH_CACHE_SIZE - 3 ), FORSYTH_CACHE_DECAY_POWER );
+				}
+
+				valence[ 0 ] = 0.0f;
+				for( int remaining = 1; remaining <= FORSYTH_MAX_VALENCE; remaining++ )
+					valence[ remaining ] = FORSYTH_VALENCE_BOOST_SCALE * std::pow( float( remaining ), -FORSYTH_VALENCE_BOOST_POWER );
+			}
+
+			/* cache_position < 0: not in the cache. Vertices with no triangles left score 0 (they no longer matter). */
+			float VertexScore( const int cache_position_of_vertex, const unsigned int remaining_triangle_count ) const
+			{
+				if( remaining_triangle_count == 0 )
+					return 0.0f;
+
+				return ( cache_position_of_vertex < 0 ? 0.0f : cache_position[ cache_position_of_vertex ] ) +
+					   valence[ std::min( remaining_triangle_count, ( unsigned int )FORSYTH_MAX_VALENCE ) ];
+			}
+		};
+
+		/* Components in the output, including the padding up to a multiple of 4 bytes. */
+		unsigned int PaddedComponentCount( const AttributeQuantization& attribute_quantization )
+		{
+			switch( attribute_quantization.format )
+			{
+				case AttributeFormat::Half:
+				case AttributeFormat::UNorm16:			return ( attribute_quantization.component_count + 1 ) / 2 * 2;
+				case AttributeFormat::UNorm8:
+				case AttributeFormat::SNorm10_10_10_2:	return 4;
+
+				default:								return attribute_quantization.component_count;
+			}
+		}
+
+		/* Writes one attribute of one vertex to destination & returns the largest error among its components. */
+		float QuantizeAttribute( const float* source, const AttributeQuantization& attribute_quantization, std::byte* destination )
+		{
+			const unsigned int component_count = attribute_quantization.component_count;
+			const unsigned int padded_component_count = PaddedComponentCount( attribute_quantization );
+
+			const auto component = [ & ]( const unsigned int component_index ) { return component_index < component_count ? source[ component_index ] : 1.0f; };
+
+			float max_error = 0.0f;
+			const auto store = [ & ]( const auto value, const float dequantized_value, const unsigned int component_index )
+			{
+				std::memcpy( destination + component_index * sizeof( value ), &value, sizeof( value ) );
+				if( component_index < component_count )
+					max_error = std::max( max_error, std::abs( dequantized_value - source[ component_index ] ) );
+			};
+
+			switch( attribute_quantization.format )
+			{
+				case AttributeFormat::Float:
+					std::memcpy( destination, source, component_count * sizeof( float ) );
+					break;
+				case AttributeFormat::Half:
+					for( unsigned int i = 0; i < padded_component_count; i++ )
+					{
+						const Math::Half half( component( i ) );
+						store( half, float( half ), i );
+					}
+					break;
+				case AttributeFormat::UNorm16:
+					for( unsigned int i = 0; i < padded_component_count; i++ )
+					{
+						const auto integer = Math::QuantizeUNorm< std::uint16_t >( component( i ) );
+						store( integer, Math::DequantizeUNorm( integer ), i );
+					}
+					break;
+				case AttributeFormat::UNorm8:
+					for( unsigned int i = 0; i < padded_component_count; i++ )
+					{
+						const auto integer = Math::QuantizeUNorm< std::uint8_t >( component( i ) );
+						store( integer, Math::DequantizeUNorm( integer ), i );
+					}
+					break;
+				case AttributeFormat::SNorm10_10_10_2:
+				{
+					/* Missing components: 0 for y & z (keeps a 1D/2D direction intact), 1 for w. */
+					const auto packed = Math::SNorm10_10_10_2( component( 0 ),
+															   component_count > 1 ? source[ 1 ] : 0.0f,
+															   component_count > 2 ? source[ 2 ] : 0.0f,
+															   component( 3 ) );
+					std::memcpy( destination, &packed, sizeof( packed ) );
+					for( unsigned int i = 0; i < component_count; i++ )
+						max_error = std::max( max_error, std::abs( packed[ i ] - source[ i ] ) );
+					break;
+				}
+			}
+
+			return max_error;
+		}
+	}
+
+	VertexCacheStatistics AnalyzeVertexCache( const std::vector< std::uint32_t >& indices, const std::size_t vertex_count, const unsigned int cache_size )
+	{
+		ASSERT_DEBUG_ONLY( indices.size() % 3 == 0 );
+
+		if( indices.empty() )
+			return { 0.0f, 0.0f };
+
+		/* FIFO: A vertex's entry time is compared against the total miss count; it is in the cache as long as fewer than cache_size misses happened since. */
+		std::vector< std::size_t > vertex_entry_time( vertex_count, std::numeric_limits< std::size_t >::max() );
+		std::vector< bool > is_referenced( vertex_count, false );
+		std::size_t miss_count = 0, unique_vertex_count = 0;
+
+		for( const auto index : indices )
+		{
+			if( !is_referenced[ index ] )
+			{
+				is_referenced[ index ] = true;
+				unique_vertex_count++;
+			}
+
+			const std::size_t entry_time = vertex_entry_time[ index ];
+			if( entry_time == std::numeric_limits< std::size_t >::max() || miss_count - entry_time >= cache_size )
+				vertex_entry_time[ index ] = miss_count++;
+		}
+
+		return { float( miss_count ) / ( indices.size() / 3 ), float( miss_count ) / unique_vertex_count };
+	}
+
+	void OptimizeVertexCache( std::vector< std::uint32_t >& indices, const std::size_t vertex_count )
+	{
+		ASSERT_DEBUG_ONLY( indices.size() % 3 == 0 );
+
+		static const ForsythScoreTable score_table;
+
+		const std::size_t triangle_count = indices.size() / 3;
+		if( triangle_count == 0 )
+			return;
+
+		/* Vertex -> adjacent (not yet emitted) triangles, as ranges into a single array (CSR layout). */
+		std::vector< unsigned int > remaining_triangle_count( vertex_count, 0 );
+		for( const auto index : indices )
+			remaining_triangle_count[ index ]++;
+
+		std::vector< unsigned int > adjacency_offset( vertex_count + 1, 0 );
+		for( std::size_t vertex = 0; vertex < vertex_count; vertex++ )
+			adjacency_offset[ vertex + 1 ] = adjacency_offset[ vertex ] + remaining_triangle_count[ vertex ];
+
+		std::vector< std::uint32_t > adjacency( indices.size() );
+		{
+			std::vector< unsigned int > fill_count( vertex_count, 0 );
+			for( std::size_t triangle = 0; triangle < triangle_count; triangle++ )
+				for( int corner = 0; corner < 3; corner++ )
+				{
+					const std::uint32_t vertex = indices[ triangle * 3 + corner ];
+					adjacency[ adjacency_offset[ vertex ] + fill_count[ vertex ]++ ] = ( std::uint32_t )triangle;
+				}
+		}
+
+		std::vector< int > cache_position( vertex_count, -1 );
+		std::vector< float > vertex_score( vertex_count );
+		for( std::size_t vertex = 0; vertex < vertex_count; vertex++ )
+			vertex_score[ vertex ] = score_table.VertexScore( -1, remaining_triangle_count[ vertex ] );
+
+		std::vector< float > triangle_score( triangle_count );
+		std::vector< bool > is_emitted( triangle_count, false );
+		for( std::size_t triangle = 0; triangle < triangle_count; triangle++ )
+			triangle_score[ triangle ] = vertex_score[ indices[ triangle * 3 ] ] + vertex_score[ indices[ triangle * 3 + 1 ] ] + vertex_score[ indices[ triangle * 3 + 2 ] ];
+
+		/* The cache holds up to 3 extra entries, pushed out by the triangle just emitted; their scores drop to "not cached". */
+		std::uint32_t cache[ FORSYTH_CACHE_SIZE + 3 ];
+		std::uint32_t cache_new[ FORSYTH_CACHE_SIZE + 3 ];
+		int cache_count = 0;
+
+		std::vector< std::uint32_t > indices_optimized;
+		indices_optimized.reserve( indices.size() );
+
+		constexpr std::size_t NONE = std::numeric_limits< std::size_t >::max();
+		std::size_t triangle_best	= NONE;
+		std::size_t dead_end_cursor = 0; // Triangles before this are all emitted.
+
+		for( std::size_t emitted_count = 0; emitted_count < triangle_count; emitted_count++ )
+		{
+			if( triangle_best == NONE )
+			{
+				/* Nothing in the cache has triangles left; continue from the next triangle in the input order. Amortized linear, as the cursor only moves forward. */
+				while( is_emitted[ dead_end_cursor ] )
+					dead_end_cursor++;
+
+				triangle_best = dead_end_cursor;
+			}
+
+			const std::uint32_t* triangle_vertices = &indices[ triangle_best * 3 ];
+			indices_optimized.insert( indices_optimized.end(), triangle_vertices, triangle_vertices + 3 );
+			is_emitted[ triangle_best ] = true;
+
+			/* Take the triangle out of its vertices' adjacency lists (swap with the last remaining entry). */
+			for( int corner = 0; corner < 3; corner++ )
+			{
+				const std::uint32_t vertex = triangle_vertices[ corner ];
+				std::uint32_t* adjacent_triangles = &adjacency[ adjacency_offset[ vertex ] ];
+				const unsigned int remaining = remaining_triangle_count[ vertex ];
+
+				for( unsigned int i = 0; i < remaining; i++ )
+				{
+					if( adjacent_triangles[ i ] == triangle_best )
+					{
+						std::swap( adjacent_triangles[ i ], adjacent_triangles[ remaining - 1 ] );
+						break;
+					}
+				}
+
+				remaining_triangle_count[ vertex ]--;
+			}
+
+			/* Move the triangle's vertices to the front of the (LRU) cache. */
+			int cache_new_count = 0;
+			for( int corner = 0; corner < 3; corner++ )
+				cache_new[ cache_new_count++ ] = triangle_vertices[ corner ];
+			for( int i = 0; i < cache_count; i++ )
+			{
+				const std::uint32_t vertex = cache[ i ];
+				if( vertex != triangle_vertices[ 0 ] && vertex != triangle_vertices[ 1 ] && vertex != triangle_vertices[ 2 ] )
+					cache_new[ cache_new_count++ ] = vertex;
+			}
+
+			/* Re-score the affected vertices & their remaining triangles; the best of those is the next candidate. */
+			triangle_best = NONE;
+			float triangle_best_score = -1.0f;
+
+			cache_count = std::min( cache_new_count, FORSYTH_CACHE_SIZE );
+			for( int i = 0; i < cache_new_count; i++ )
+			{
+				const std::uint32_t vertex = cache_new[ i ];
+				const int position		   = i < FORSYTH_CACHE_SIZE ? i : -1;
+
+				cache_position[ vertex ] = position;
+				if( position >= 0 )
+					cache[ i ] = vertex;
+
+				const float score_new = score_table.VertexScore( position, remaining_triangle_count[ vertex ] );
+				const float score_delta = score_new - vertex_score[ vertex ];
+				vertex_score[ vertex ] = score_new;
+
+				const std::uint32_t* adjacent_triangles = &adjacency[ adjacency_offset[ vertex ] ];
+				for( unsigned int j = 0; j < remaining_triangle_count[ vertex ]; j++ )
+				{
+					const std::uint32_t triangle = adjacent_triangles[ j ];
+					triangle_score[ triangle ] += score_delta;
+
+					if( triangle_score[ triangle ] > triangle_best_score )
+					{
+						triangle_best_score = triangle_score[ triangle ];
+						triangle_best		= triangle;
+					}
+				}
+			}
+		}
+
+		indices.swap( indices_optimized );
+	}
+
+	std::vector< std::uint32_t > OptimizeVertexFetch( std::vector< std::uint32_t >& indices, const std::size_t vertex_count )
+	{
+		constexpr std::uint32_t UNASSIGNED = std::numeric_limits< std::uint32_t >::max();
+
+		std::vector< std::uint32_t > remap( vertex_count, UNASSIGNED );
+		std::uint32_t next_index = 0;
+
+		for( auto& index : indices )
+		{
+			if( remap[ index ] == UNASSIGNED )
+				remap[ index ] = next_index++;
+
+			index = remap[ index ];
+		}
+
+		for( auto& new_index : remap )
+			if( new_index == UNASSIGNED )
+				new_index = next_index++;
+
+		return remap;
+	}
+
+	void RemapVertices( std::vector< std::byte >& vertex_data, const unsigned int stride, const std::vector< std::uint32_t >& remap )
+	{
+		std::vector< std::byte > vertex_data_remapped( vertex_data.size() );
+		for( std::size_t i = 0; i < remap.size(); i++ )
+			std::memcpy( vertex_data_remapped.data() + std::size_t( remap[ i ] ) * stride, vertex_data.data() + i * stride, stride );
+
+		vertex_data.swap( vertex_data_remapped );
+	}
+
+	QuantizedVertices Quantize( const float* vertices, const std::size_t vertex_count, const unsigned int component_count_per_vertex,
+								const std::vector< AttributeQuantization >& attribute_quantization_list )
+	{
+		QuantizedVertices quantized_vertices;
+		quantized_vertices.vertex_count = ( unsigned int )vertex_count;
+		quantized_vertices.max_error_list.resize( attribute_quantization_list.size(), 0.0f );
+
+		unsigned int component_count_total = 0;
+		for( const auto& attribute_quantization : attribute_quantization_list )
+		{
+			ASSERT_DEBUG_ONLY( attribute_quantization.component_count >= 1 && attribute_quantization.component_count <= 4 );
+
+			const unsigned int padded_component_count = PaddedComponentCount( attribute_quantization );
+			component_count_total += attribute_quantization.component_count;
+
+			switch( attribute_quantization.format )
+			{
+				case AttributeFormat::Float:			quantized_vertices.layout.Push< float >( padded_component_count );					break;
+				case AttributeFormat::Half:				quantized_vertices.layout.Push< Math::Half >( padded_component_count );				break;
+				case AttributeFormat::UNorm16:			quantized_vertices.layout.Push< unsigned short >( padded_component_count );			break;
+				case AttributeFormat::UNorm8:			quantized_vertices.layout.Push< unsigned char >( padded_component_count );			break;
+				case AttributeFormat::SNorm10_10_10_2:	quantized_vertices.layout.Push< Math::SNorm10_10_10_2 >( padded_component_count );	break;
+			}
+		}
+
+		ASSERT( component_count_total == component_count_per_vertex && "MeshUtility::Quantize(): Attribute component counts do not add up to the vertex size." );
+
+		const auto& attribute_list = quantized_vertices.layout.GetAttributes();
+		const unsigned int stride  = quantized_vertices.layout.GetStride();
+		quantized_vertices.data.resize( vertex_count * stride );
+
+		for( std::size_t vertex_index = 0; vertex_index < vertex_count; vertex_index++ )
+		{
+			const float* source		= vertices + vertex_index * component_count_per_vertex;
+			std::byte* destination	= quantized_vertices.data.data() + vertex_index * stride;
+
+			for( std::size_t attribute_index = 0; attribute_index < attribute_quantization_list.size(); attribute_index++ )
+			{
+				const auto& attribute_quantization = attribute_quantization_list[ attribute_index ];
+
+				float& max_error = quantized_vertices.max_error_list[ attribute_index ];
+				max_error = std::max( max_error, QuantizeAttribute( source, attribute_quantization, destination ) );
+
+				source		+= attribute_quantization.component_count;
+				destination += attribute_list[ attribute_index ].GetSize();
+			}
+		}
+
+		return quantized_vertices;
+	}
+}
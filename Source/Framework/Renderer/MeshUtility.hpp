@@ -1,9 +1,72 @@
 #pragma once
 
+// Framework Includes.
+#include "Math/Vector.hpp"
+
+#include "Renderer/VertexBufferLayout.h"
+
+// std Includes.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 namespace Framework
 {
 	namespace MeshUtility
 	{
+		/* Unique vertices & the indices (into them) of the original vertices, in the original order. */
+		template< typename VertexType >
+		struct IndexedMesh
+		{
+			std::vector< VertexType > vertices;
+			std::vector< std::uint32_t > indices;
+
+			/* 16-bit indices (half the index buffer size) suffice up to 65536 unique vertices; see IndexBuffer. */
+			bool FitsInto16BitIndices() const { return vertices.size() <= 65536; }
+		};
+
+		struct VertexCacheStatistics
+		{
+			/* Average cache miss ratio: vertex shader runs per triangle. 3 at worst, ~0.5 at best for regular meshes. */
+			float acmr;
+			/* Average transformed vertex ratio: vertex shader runs per unique vertex. 1 is optimal. */
+			float atvr;
+		};
+
+		enum class AttributeFormat
+		{
+			/* Exact. 4 bytes per component. */
+			Float,
+			/* Relative error <= 2^-11 (e.g., <= 0.5 mm at 1 m from the origin). For positions of meshes that are not too large & uvs that tile. */
+			Half,
+			/* [0, 1]; error <= 1/131070. For uvs. */
+			UNorm16,
+			/* [0, 1]; error <= 1/510. For colors. */
+			UNorm8,
+			/* [-1, 1]; error <= 1/1022 for x, y & z. For (unit) normals & tangents (handedness in w: -1 or +1). Always 4 bytes, for up to 4 components. */
+			SNorm10_10_10_2
+		};
+
+		struct AttributeQuantization
+		{
+			unsigned int component_count;
+			AttributeFormat format;
+		};
+
+		struct QuantizedVertices
+		{
+			/* Tightly packed vertices, laid out as described by layout; to be passed to VertexBuffer( data.data(), vertex_count, layout.GetStride() ). */
+			std::vector< std::byte > data;
+			unsigned int vertex_count;
+			VertexBufferLayout layout;
+			/* Per attribute: The largest absolute difference between an input component & its dequantized value.
+			 * Values outside of the range of the format are clamped, which shows up here. */
+			std::vector< float > max_error_list;
+		};
+
 		template< typename VertexAttributeArray, typename ... VertexAttributeArrays >
 		constexpr auto Interleave( const VertexAttributeArray& vertex_attribute_array_first, const VertexAttributeArrays& ... vertex_attribute_array_pack )
 		{
@@ -39,5 +102,126 @@ namespace Framework
 
 			return interleaved_vertex_attribute_array;
 		}
+
+		/* Merges bit-wise identical vertices (so +0.0f & -0.0f are considered different; NaNs with the same bits are not).
+		 * VertexType is expected to have no padding, as is the case for the Vector types Interleave() returns. */
+		template< typename VertexType >
+		IndexedMesh< VertexType > Weld( const VertexType* vertices, const std::size_t vertex_count )
+		{
+			IndexedMesh< VertexType > mesh;
+			mesh.indices.reserve( vertex_count );
+
+			/* Open addressing with linear probing, over a power-of-two table kept at most half full. A slot holds (unique vertex index + 1); 0 is empty. */
+			std::size_t table_size = 16;
+			while( table_size < vertex_count * 2 )
+				table_size *= 2;
+
+			const std::size_t table_mask = table_size - 1;
+			std::vector< std::uint32_t > table( table_size, 0 );
+
+			for( std::size_t i = 0; i < vertex_count; i++ )
+			{
+				const VertexType& vertex = vertices[ i ];
+
+				/* FNV-1a, over 32-bit words instead of bytes (vertex components are 4 bytes wide); the final mix spreads the result over the low (masked) bits. */
+				std::uint64_t hash = 14695981039346656037ull;
+				if constexpr( sizeof( VertexType ) % sizeof( std::uint32_t ) == 0 )
+				{
+					for( std::size_t word_index = 0; word_index < sizeof( VertexType ) / sizeof( std::uint32_t ); word_index++ )
+					{
+						std::uint32_t word;
+						std::memcpy( &word, reinterpret_cast< const unsigned char* >( &vertex ) + word_index * sizeof( std::uint32_t ), sizeof( std::uint32_t ) );
+						hash = ( hash ^ word ) * 1099511628211ull;
+					}
+				}
+				else
+				{
+					const unsigned char* bytes = reinterpret_cast< const unsigned char* >( &vertex );
+					for( std::size_t byte_index = 0; byte_index < sizeof( VertexType ); byte_index++ )
+						hash = ( hash ^ bytes[ byte_index ] ) * 1099511628211ull;
+				}
+				hash ^= hash >> 32;
+
+				for( std::size_t slot_index = hash & table_mask; ; slot_index = ( slot_index + 1 ) & table_mask )
+				{
+					std::uint32_t& slot = table[ slot_index ];
+
+					if( slot == 0 )
+					{
+						mesh.vertices.push_back( vertex );
+						slot = ( std::uint32_t )mesh.vertices.size();
+						mesh.indices.push_back( slot - 1 );
+						break;
+					}
+
+					if( std::memcmp( &mesh.vertices[ slot - 1 ], &vertex, sizeof( VertexType ) ) == 0 )
+					{
+						mesh.indices.push_back( slot - 1 );
+						break;
+					}
+				}
+			}
+
+			return mesh;
+		}
+
+		/* Interleave() followed by Weld(); e.g., 36 -> 14 vertices for Primitives::Cube's positions & cube map uvs. */
+		template< typename VertexAttributeArray, typename ... VertexAttributeArrays >
+		auto BuildIndexed( const VertexAttributeArray& vertex_attribute_array_first, const VertexAttributeArrays& ... vertex_attribute_array_pack )
+		{
+			const auto interleaved_vertex_attribute_array = Interleave( vertex_attribute_array_first, vertex_attribute_array_pack ... );
+			return Weld( interleaved_vertex_attribute_array.data(), interleaved_vertex_attribute_array.size() );
+		}
+
+		/* Triangle lists only. Non-template functions below are implemented in MeshUtility.cpp. */
+
+		/* Simulates a FIFO post-transform cache of the given size (16-32 on current GPUs; 16 is a conservative estimate). */
+		VertexCacheStatistics AnalyzeVertexCache( const std::vector< std::uint32_t >& indices, const std::size_t vertex_count, const unsigned int cache_size = 16 );
+
+		/* Reorders the triangles (in place) to maximize post-transform cache hits; Tom Forsyth's "Linear-Speed Vertex Cache Optimisation".
+		 * Runs in time linear in the triangle count & does not depend on the exact cache size of the GPU. */
+		void OptimizeVertexCache( std::vector< std::uint32_t >& indices, const std::size_t vertex_count );
+
+		/* Renumbers the vertices in the order they are first referenced (in place), so that vertex fetches walk the vertex buffer sequentially;
+		 * to be run after OptimizeVertexCache(). Unreferenced vertices are moved to the end. Returns the old -> new index remap table for RemapVertices(). */
+		std::vector< std::uint32_t > OptimizeVertexFetch( std::vector< std::uint32_t >& indices, const std::size_t vertex_count );
+
+		template< typename VertexType >
+		void RemapVertices( std::vector< VertexType >& vertices, const std::vector< std::uint32_t >& remap )
+		{
+			std::vector< VertexType > vertices_remapped( vertices.size() );
+			for( std::size_t i = 0; i < vertices.size(); i++ )
+				vertices_remapped[ remap[ i ] ] = vertices[ i ];
+
+			vertices.swap( vertices_remapped );
+		}
+
+		/* Same as above; for vertices without a C++ type of their own (e.g., MeshData::vertex_data). */
+		void RemapVertices( std::vector< std::byte >& vertex_data, const unsigned int stride, const std::vector< std::uint32_t >& remap );
+
+		/* OptimizeVertexCache() followed by OptimizeVertexFetch(). */
+		template< typename VertexType >
+		void Optimize( IndexedMesh< VertexType >& mesh )
+		{
+			OptimizeVertexCache( mesh.indices, mesh.vertices.size() );
+			RemapVertices( mesh.vertices, OptimizeVertexFetch( mesh.indices, mesh.vertices.size() ) );
+		}
+
+		/* Converts float vertices (vertex_count * component_count_per_vertex floats, e.g., Interleave() output) into the given attribute formats, in the given order.
+		 * Attributes narrower than 4 bytes are padded with 1s (i.e., w = 1 for positions, opaque alpha for colors), so that every attribute starts 4-byte aligned.
+		 * E.g., Half positions, SNorm10_10_10_2 normals & UNorm16 uvs take 16 bytes per vertex instead of 32. */
+		QuantizedVertices Quantize( const float* vertices, const std::size_t vertex_count, const unsigned int component_count_per_vertex,
+									const std::vector< AttributeQuantization >& attribute_quantization_list );
+
+		/* Same as above; for containers of Math::Vector< float, N > vertices (i.e., Interleave() or Weld() output). */
+		template< typename VertexContainer >
+		QuantizedVertices Quantize( const VertexContainer& vertices, const std::vector< AttributeQuantization >& attribute_quantization_list )
+		{
+			using VertexType = std::remove_cvref_t< decltype( vertices[ 0 ] ) >;
+			static_assert( std::is_same_v< typename VertexType::CoordinateType, float > && sizeof( VertexType ) == VertexType::Dimension() * sizeof( float ),
+						   "MeshUtility::Quantize(): Vertices are expected to be tightly packed floats." );
+
+			return Quantize( vertices.data()->Data(), vertices.size(), ( unsigned int )VertexType::Dimension(), attribute_quantization_list );
+		}
 	}
 }
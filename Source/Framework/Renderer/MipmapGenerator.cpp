@@ -0,0 +1,357 @@
+// Framework Includes.
+#include "Renderer/MipmapGenerator.h"
+
+#include "Math/SIMD.h"
+
+// std Includes.
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace Framework::MipmapGenerator
+{
+	namespace
+	{
+		/* Destination rows per tile. A tile filters the source rows it needs horizontally into a buffer of its own, so adjacent tiles recompute the few rows
+		 * in the vertical filter's support, but the buffer stays small regardless of the image size. */
+		constexpr int TILE_ROW_COUNT = 32;
+
+		constexpr float KAISER_ALPHA = 4.0f;
+
+		/* Linear to sRGB table size; fine enough to be within 0.5/255 of the exact encoding even for the darkest values. */
+		constexpr int LINEAR_TO_SRGB_SIZE = 1 << 14;
+
+		/* Linear RGBA; channels missing from the image are 0 (alpha 1). */
+		struct FloatImage
+		{
+			int width;
+			int height;
+			std::vector< float > texels;
+		};
+
+		/* Per destination texel: tap_count source texels (clamped to the edges, hence possibly repeated) & their normalized weights. */
+		struct TapTable
+		{
+			int tap_count;
+			std::vector< int > source_index_list;
+			std::vector< float > weight_list;
+		};
+
+		struct ColorSpaceTables
+		{
+			float srgb_to_linear[ 256 ];
+			unsigned char linear_to_srgb[ LINEAR_TO_SRGB_SIZE ];
+		};
+
+		const ColorSpaceTables& ColorSpace()
+		{
+			static const ColorSpaceTables tables = []()
+			{
+				ColorSpaceTables tables;
+				for( int i = 0; i < 256; i++ )
+				{
+					const float srgb = i / 255.0f;
+					tables.srgb_to_linear[ i ] = srgb <= 0.04045f ? srgb / 12.92f : std::pow( ( srgb + 0.055f ) / 1.055f, 2.4f );
+				}
+
+				for( int i = 0; i < LINEAR_TO_SRGB_SIZE; i++ )
+				{
+					const float linear = float( i ) / ( LINEAR_TO_SRGB_SIZE - 1 );
+					const float srgb   = linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow( linear, 1.0f / 2.4f ) - 0.055f;
+					tables.linear_to_srgb[ i ] = ( unsigned char )( srgb * 255.0f + 0.5f );
+				}
+
+				return tables;
+			}();
+
+			return tables;
+		}
+
+		float Sinc( const float x )
+		{
+			if( std::abs( x ) < 1e-5f )
+				return 1.0f;
+
+			const float pi_x = std::numbers::pi_v< float > * x;
+			return std::sin( pi_x ) / pi_x;
+		}
+
+		/* Modified Bessel function of the first kind, order 0 (power series). */
+		float BesselI0( const float x )
+		{
+			float sum = 1.0f, term = 1.0f;
+			for( int k = 1; k < 32 && term > sum * 1e-7f; k++ )
+			{
+				const float factor = x / ( 2.0f * k );
+				term *= factor * factor;
+				sum  += term;
+			}
+
+			return sum;
+		}
+
+		/* In destination texels. */
+		float RadiusOf( const Filter filter )
+		{
+			return filter == Filter::Box ? 0.5f : 3.0f;
+		}
+
+		float Evaluate( const Filter filter, const float x )
+		{
+			const float radius = RadiusOf( filter );
+
+			switch( filter )
+			{
+				case Filter::Box:
+					return x >= -radius && x < radius ? 1.0f : 0.0f; // Half-open, so that texels on the border of two footprints count for one of them only.
+				case Filter::Kaiser:
+					return std::abs( x ) < radius ? Sinc( x ) * BesselI0( KAISER_ALPHA * std::sqrt( 1.0f - ( x / radius ) * ( x / radius ) ) ) / BesselI0( KAISER_ALPHA ) : 0.0f;
+				case Filter::Lanczos:
+					return std::abs( x ) < radius ? Sinc( x ) * Sinc( x / radius ) : 0.0f;
+			}
+
+			throw std::runtime_error( "MipmapGenerator: Unknown filter." );
+		}
+
+		TapTable ComputeTaps( const Filter filter, const int source_size, const int destination_size )
+		{
+			const float scale  = float( source_size ) / destination_size;
+			const float radius = RadiusOf( filter ) * scale; // In source texels.
+
+			TapTable table;
+			table.tap_count = int( std::ceil( 2.0f * radius ) ) + 1;
+			table.source_index_list.resize( std::size_t( destination_size ) * table.tap_count );
+			table.weight_list.resize( std::size_t( destination_size ) * table.tap_count );
+
+			for( int destination = 0; destination < destination_size; destination++ )
+			{
+				/* Texel centers are at half-integer coordinates. */
+				const float center = ( destination + 0.5f ) * scale;
+				const int first	   = int( std::ceil( center - radius - 0.5f ) );
+
+				int* source_index_list = table.source_index_list.data() + std::size_t( destination ) * table.tap_count;
+				float* weight_list	   = table.weight_list.data()		+ std::size_t( destination ) * table.tap_count;
+
+				float weight_sum = 0.0f;
+				for( int tap = 0; tap < table.tap_count; tap++ )
+				{
+					source_index_list[ tap ] = std::clamp( first + tap, 0, source_size - 1 );
+					weight_list[ tap ]		 = Evaluate( filter, ( first + tap + 0.5f - center ) / scale );
+					weight_sum				+= weight_list[ tap ];
+				}
+
+				for( int tap = 0; tap < table.tap_count; tap++ )
+					weight_list[ tap ] /= weight_sum;
+			}
+
+			return table;
+		}
+
+		void LoadRow( const unsigned char* pixels, const int width, const int channel_count, const bool is_srgb, float* row )
+		{
+			const auto& tables = ColorSpace();
+
+			for( int x = 0; x < width; x++ )
+			{
+				const unsigned char* texel = pixels + std::size_t( x ) * channel_count;
+				float* output			   = row + std::size_t( x ) * 4;
+
+				output[ 0 ] = output[ 1 ] = output[ 2 ] = 0.0f;
+				output[ 3 ] = 1.0f;
+
+				for( int channel = 0; channel < channel_count; channel++ )
+					output[ channel ] = is_srgb && channel < 3 ? tables.srgb_to_linear[ texel[ channel ] ] : texel[ channel ] / 255.0f;
+			}
+		}
+
+		/* row_of( y, buffer ) returns source row y as linear RGBA floats; either written to buffer (source_width * 4 floats) or pointing into an image. */
+		template< typename RowOf >
+		FloatImage Downsample( const int source_width, const int source_height, RowOf&& row_of, const Filter filter, Utility::ThreadPool& thread_pool )
+		{
+			using namespace Math::SIMD;
+
+			FloatImage destination{ std::max( source_width / 2, 1 ), std::max( source_height / 2, 1 ), {} };
+			destination.texels.resize( std::size_t( destination.width ) * destination.height * 4 );
+
+			const TapTable horizontal_taps = ComputeTaps( filter, source_width,  destination.width );
+			const TapTable vertical_taps   = ComputeTaps( filter, source_height, destination.height );
+
+			const std::size_t row_size = std::size_t( destination.width ) * 4;
+			const int tile_count	   = ( destination.height + TILE_ROW_COUNT - 1 ) / TILE_ROW_COUNT;
+
+			thread_pool.ParallelFor( tile_count, 1, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				std::vector< float > source_row( std::size_t( source_width ) * 4 );
+				std::vector< float > filtered_row_list;
+				std::vector< const float* > tap_row_list;
+				std::vector< float > tap_weight_list;
+
+				for( int tile = int( begin ); tile < int( end ); tile++ )
+				{
+					const int row_begin = tile * TILE_ROW_COUNT, row_end = std::min( row_begin + TILE_ROW_COUNT, destination.height );
+
+					/* The source rows read by the tile's taps (those with a weight, that is). */
+					int source_y_first = source_height, source_y_last = -1;
+					for( std::size_t i = std::size_t( row_begin ) * vertical_taps.tap_count; i < std::size_t( row_end ) * vertical_taps.tap_count; i++ )
+						if( vertical_taps.weight_list[ i ] != 0.0f )
+						{
+							source_y_first = std::min( source_y_first, vertical_taps.source_index_list[ i ] );
+							source_y_last  = std::max( source_y_last,  vertical_taps.source_index_list[ i ] );
+						}
+
+					/* Horizontal pass, into the tile's buffer: */
+					filtered_row_list.resize( std::size_t( source_y_last - source_y_first + 1 ) * row_size );
+					for( int source_y = source_y_first; source_y <= source_y_last; source_y++ )
+					{
+						const float* input = row_of( source_y, source_row.data() );
+						float* output	   = filtered_row_list.data() + std::size_t( source_y - source_y_first ) * row_size;
+
+						for( int x = 0; x < destination.width; x++ )
+						{
+							const int* source_index_list = horizontal_taps.source_index_list.data() + std::size_t( x ) * horizontal_taps.tap_count;
+							const float* weight_list	 = horizontal_taps.weight_list.data()		+ std::size_t( x ) * horizontal_taps.tap_count;
+
+							Float4 sum = Splat( 0.0f );
+							for( int tap = 0; tap < horizontal_taps.tap_count; tap++ )
+								sum = MultiplyAdd( Splat( weight_list[ tap ] ), Load( input + std::size_t( source_index_list[ tap ] ) * 4 ), sum );
+
+							Store( output + std::size_t( x ) * 4, sum );
+						}
+					}
+
+					/* Vertical pass, clamped to [0, 1] against the sinc filters' overshoot (which would otherwise build up over the levels): */
+					for( int row = row_begin; row < row_end; row++ )
+					{
+						tap_row_list.clear();
+						tap_weight_list.clear();
+						for( int tap = 0; tap < vertical_taps.tap_count; tap++ )
+						{
+							const std::size_t i = std::size_t( row ) * vertical_taps.tap_count + tap;
+							if( vertical_taps.weight_list[ i ] != 0.0f )
+							{
+								tap_row_list.push_back( filtered_row_list.data() + std::size_t( vertical_taps.source_index_list[ i ] - source_y_first ) * row_size );
+								tap_weight_list.push_back( vertical_taps.weight_list[ i ] );
+							}
+						}
+
+						float* output = destination.texels.data() + std::size_t( row ) * row_size;
+						for( std::size_t offset = 0; offset < row_size; offset += 4 )
+						{
+							Float4 sum = Splat( 0.0f );
+							for( std::size_t tap = 0; tap < tap_row_list.size(); tap++ )
+								sum = MultiplyAdd( Splat( tap_weight_list[ tap ] ), Load( tap_row_list[ tap ] + offset ), sum );
+
+							Store( output + offset, Min( Max( sum, Splat( 0.0f ) ), Splat( 1.0f ) ) );
+						}
+					}
+				}
+			} );
+
+			return destination;
+		}
+
+		float AlphaCoverage( const FloatImage& image, const float alpha_reference, const float alpha_scale )
+		{
+			std::size_t count = 0;
+			for( std::size_t i = 3; i < image.texels.size(); i += 4 )
+				count += image.texels[ i ] * alpha_scale > alpha_reference;
+
+			return float( count ) / ( float( image.width ) * image.height );
+		}
+
+		/* Binary search, as the coverage only grows with the scale. */
+		float AlphaScaleFor( const FloatImage& image, const float alpha_reference, const float target_coverage )
+		{
+			float low = 0.0f, high = 4.0f;
+			for( int iteration = 0; iteration < 16; iteration++ )
+			{
+				const float middle = ( low + high ) / 2.0f;
+				if( AlphaCoverage( image, alpha_reference, middle ) > target_coverage )
+					high = middle;
+				else
+					low = middle;
+			}
+
+			return ( low + high ) / 2.0f;
+		}
+
+		Level ToLevel( const FloatImage& image, const int channel_count, const bool is_srgb, const float alpha_scale, Utility::ThreadPool& thread_pool )
+		{
+			Level level{ image.width, image.height, std::vector< unsigned char >( std::size_t( image.width ) * image.height * channel_count ) };
+
+			const auto& tables = ColorSpace();
+
+			thread_pool.ParallelFor( image.height, TILE_ROW_COUNT, [ & ]( const std::size_t begin, const std::size_t end )
+			{
+				for( std::size_t texel_index = begin * image.width; texel_index < end * image.width; texel_index++ )
+				{
+					const float* texel	  = image.texels.data() + texel_index * 4;
+					unsigned char* output = level.pixels.data() + texel_index * channel_count;
+
+					for( int channel = 0; channel < channel_count; channel++ )
+					{
+						const float value = channel == 3 ? std::min( texel[ 3 ] * alpha_scale, 1.0f ) : texel[ channel ];
+						output[ channel ] = is_srgb && channel < 3
+												? tables.linear_to_srgb[ int( value * ( LINEAR_TO_SRGB_SIZE - 1 ) + 0.5f ) ]
+												: ( unsigned char )( value * 255.0f + 0.5f );
+					}
+				}
+			} );
+
+			return level;
+		}
+	}
+
+	std::vector< Level > Generate( const unsigned char* pixels, const int width, const int height, const int channel_count, const Settings& settings,
+								   Utility::ThreadPool& thread_pool )
+	{
+		if( channel_count < 1 || channel_count > 4 )
+			throw std::runtime_error( "MipmapGenerator: Unsupported channel count." );
+
+		std::vector< Level > level_list;
+		level_list.push_back( { width, height, std::vector< unsigned char >( pixels, pixels + std::size_t( width ) * height * channel_count ) } );
+
+		const bool preserve_alpha_coverage = settings.preserve_alpha_coverage && channel_count == 4;
+
+		float target_coverage = 0.0f;
+		if( preserve_alpha_coverage )
+		{
+			std::size_t count = 0;
+			for( std::size_t i = 3; i < level_list.front().pixels.size(); i += 4 )
+				count += pixels[ i ] / 255.0f > settings.alpha_reference;
+
+			target_coverage = float( count ) / ( float( width ) * height );
+		}
+
+		FloatImage previous_level{ width, height, {} };
+		while( previous_level.width > 1 || previous_level.height > 1 )
+		{
+			FloatImage level;
+			if( level_list.size() == 1 )
+			{
+				/* Level 0 is converted row by row as the tiles read it, rather than as a whole. */
+				level = Downsample( width, height, [ & ]( const int y, float* buffer )
+				{
+					LoadRow( pixels + std::size_t( y ) * width * channel_count, width, channel_count, settings.is_srgb, buffer );
+					return static_cast< const float* >( buffer );
+				}, settings.filter, thread_pool );
+			}
+			else
+			{
+				level = Downsample( previous_level.width, previous_level.height, [ & ]( const int y, float* )
+				{
+					return static_cast< const float* >( previous_level.texels.data() + std::size_t( y ) * previous_level.width * 4 );
+				}, settings.filter, thread_pool );
+			}
+
+			/* The next level is filtered from the unscaled alpha. */
+			const float alpha_scale = preserve_alpha_coverage ? AlphaScaleFor( level, settings.alpha_reference, target_coverage ) : 1.0f;
+			level_list.push_back( ToLevel( level, channel_count, settings.is_srgb, alpha_scale, thread_pool ) );
+
+			previous_level = std::move( level );
+		}
+
+		return level_list;
+	}
+}
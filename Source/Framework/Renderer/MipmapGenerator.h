@@ -0,0 +1,44 @@
+#pragma once
+
+// Framework Includes.
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <vector>
+
+namespace Framework::MipmapGenerator
+{
+	/* Downsampling filters, separable & evaluated at the destination texel's footprint (2 source texels wide per axis, wider for odd sizes):
+	 *	Box:	 Averages the footprint; cheapest, blurs the most over many levels.
+	 *	Kaiser:	 Kaiser-windowed sinc, 3 destination texels in radius; sharper, barely any ringing.
+	 *	Lanczos: Lanczos-windowed sinc (3 lobes); sharpest, with some ringing at hard edges (clamped). */
+	enum class Filter
+	{
+		Box, Kaiser, Lanczos
+	};
+
+	struct Settings
+	{
+		Filter filter = Filter::Box;
+		/* The color channels (all but alpha) are sRGB encoded: they are filtered in linear space & encoded again, so that levels do not darken. */
+		bool is_srgb = false;
+		/* For alpha-tested textures (4 channels only): alpha is scaled per level so that the fraction of texels above alpha_reference stays that of level 0;
+		 * otherwise foliage & fences thin out & vanish in the distance. */
+		bool preserve_alpha_coverage = false;
+		float alpha_reference = 0.5f;
+	};
+
+	/* Tightly packed, 8 bits per channel; as many channels as the image the chain was generated from. */
+	struct Level
+	{
+		int width;
+		int height;
+		std::vector< unsigned char > pixels;
+	};
+
+	/* The full chain, from a copy of the given image (level 0) down to 1x1, each level half the size of the previous one (rounded down, at least 1).
+	 * channel_count: 1 to 4. Edges are clamped. Each level is filtered from the previous one, kept in floating point in between; a level's rows are filtered
+	 * in tiles of rows on the given pool (with SIMD across the channels). */
+	std::vector< Level > Generate( const unsigned char* pixels, const int width, const int height, const int channel_count, const Settings& settings = {},
+								   Utility::ThreadPool& thread_pool = Utility::ThreadPool::Default() );
+}
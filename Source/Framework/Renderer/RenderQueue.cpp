@@ -0,0 +1,35 @@
+// Framework Includes.
+#include "Renderer/RenderQueue.h"
+
+#include "Utility/RadixSort.h"
+
+// std Includes.
+#include <algorithm>
+
+namespace Framework
+{
+	RenderQueue::SortKey RenderQueue::MakeKey( const RenderPass pass, const unsigned int shader_id, const unsigned int material_id, const unsigned int vertex_array_id, const float depth )
+	{
+		const SortKey depth_quantized = SortKey( std::clamp( depth, 0.0f, 1.0f ) * 65535.0f + 0.5f );
+
+		const SortKey pass_bits     = SortKey( pass )			 & 0xF;
+		const SortKey shader_bits   = SortKey( shader_id )		 & 0xFFF;
+		const SortKey material_bits = SortKey( material_id )	 & 0xFFFF;
+
+		if( pass == RenderPass::Transparent )
+		{
+			const SortKey vertex_array_bits = SortKey( vertex_array_id ) & 0xFFF;
+
+			return ( pass_bits << 60 ) | ( ( 0xFFFF - depth_quantized ) << 44 ) | ( shader_bits << 32 ) | ( material_bits << 16 ) | ( vertex_array_bits << 4 );
+		}
+
+		const SortKey vertex_array_bits = SortKey( vertex_array_id ) & 0xFFFF;
+
+		return ( pass_bits << 60 ) | ( shader_bits << 48 ) | ( material_bits << 32 ) | ( vertex_array_bits << 16 ) | depth_quantized;
+	}
+
+	void RenderQueue::Sort()
+	{
+		Utility::RadixSort( item_list, scratch_list, []( const Item& item ) { return item.key; } );
+	}
+}
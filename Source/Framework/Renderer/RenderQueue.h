@@ -0,0 +1,48 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/Drawable.h"
+
+// std Includes.
+#include <cstdint>
+#include <vector>
+
+namespace Framework
+{
+	/* Orders Drawables by a 64-bit sort key per frame, so that consecutive draws share as much GL state as possible (see StateCache).
+	 * Key layout, from the most significant bit:
+	 *	Opaque:		 pass (4) | shader (12) | material (16) | vertex array (16) | depth (16), front-to-back.
+	 *	Transparent: pass (4) | depth (16), back-to-front | shader (12) | material (16) | vertex array (12).
+	 * Ids wider than their fields are truncated; that only costs grouping efficiency, never correctness. */
+	class RenderQueue
+	{
+	public:
+		using SortKey = std::uint64_t;
+
+		struct Item
+		{
+			SortKey key;
+			Drawable* drawable;
+		};
+
+	public:
+		/* depth is expected to be normalized to [0, 1] (0 = near); it is clamped & quantized to 16 bits. */
+		static SortKey MakeKey( const RenderPass pass, const unsigned int shader_id, const unsigned int material_id, const unsigned int vertex_array_id, const float depth );
+
+		inline void Clear() { item_list.clear(); }
+		inline void Reserve( const std::size_t count ) { item_list.reserve( count ); }
+		inline void Push( const SortKey key, Drawable* drawable ) { item_list.push_back( { key, drawable } ); }
+
+		/* Radix sort; stable, so Drawables with equal keys keep their submission order. */
+		void Sort();
+
+		inline std::size_t Size() const { return item_list.size(); }
+
+		inline std::vector< Item >::const_iterator begin() const	{ return item_list.cbegin(); }
+		inline std::vector< Item >::const_iterator end() const		{ return item_list.cend(); }
+
+	private:
+		std::vector< Item > item_list;
+		std::vector< Item > scratch_list;
+	};
+}
@@ -1,19 +1,54 @@
 // Framework Includes.
 #include "Core/Platform.h"
 
+#include "Math/Frustum.h"
+
 #include "Renderer/Graphics.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/UniformBlock.h"
+
+#include "Scene/TransformSystem.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <algorithm>
+#include <span>
 
 namespace Framework
 {
+	namespace
+	{
+		/* Drawables without bounds are never culled. */
+		Math::AABB WorldBounds( const Drawable& drawable )
+		{
+			const auto& local_bounds = drawable.GetLocalBounds();
+			return local_bounds ? local_bounds->Transformed( drawable.transform->GetWorldMatrix() ) : Math::AABB::Unbounded();
+		}
+	}
+
 	Renderer::Renderer( Camera* camera, const Color4 clear_color )
 		:
 		camera_current( camera ),
 		pixel_width( Platform::GetFrameBufferWidthInPixels() ),
 		pixel_height( Platform::GetFrameBufferHeightInPixels() ),
 		aspect_ratio( float( pixel_width ) / pixel_height ),
-		color_clear( clear_color )
+		instance_buffer( GL_ARRAY_BUFFER, INSTANCE_BUFFER_INITIAL_CAPACITY * sizeof( Matrix4x4 ) ),
+		camera_uniform_buffer( sizeof( UniformBlock::Camera ) ),
+		state_change_statistics{},
+		draw_call_count( 0 ),
+		culling_statistics{},
+		color_clear( clear_color ),
+		is_frustum_culling_enabled( true ),
+		static_hierarchy_needs_rebuild( false ),
+		static_hierarchy_needs_refit( false )
 	{
+		/* One world matrix per instance, row by row; consumed as 4 consecutive vec4 attributes (i.e., a mat4) by instanced shaders. */
+		for( int row = 0; row < 4; row++ )
+			instance_buffer_layout.Push< float >( 4, /* divisor: */ 1 );
+
+		camera_uniform_buffer.BindToBindingPoint( ( GLuint )UniformBlock::Camera::BINDING_POINT );
+
 		Platform::SetFrameBufferResizeCallback( [ = ]( const int width_new_pixels, const int height_new_pixels )
 		{
 			this->OnFrameBufferResize( width_new_pixels, height_new_pixels );
@@ -42,13 +77,194 @@ namespace Framework
 
 	void Renderer::BeginFrame() const
 	{
+		/* Code outside of the framework (ImGui for example) may have changed the bindings since the last frame. */
+		StateCache::Instance().Invalidate();
+
 		Clear();
 	}
 
 	void Renderer::DrawFrame()
 	{
-		for( auto drawable : drawable_list )
-			drawable->Submit( camera_current );
+		/* Rebuild all dirty local & world matrices in one pass, instead of lazily per Drawable. */
+		TransformSystem::Instance().UpdateWorldMatrices();
+
+		auto& state_cache = StateCache::Instance();
+		state_cache.ResetStatistics();
+
+		const Matrix4x4& view_matrix = camera_current->GetViewMatrix();
+
+		/* View & projection are the same for all Drawables; upload them once per frame instead of once per Drawable. */
+		UpdateCameraUniforms( view_matrix, camera_current->GetProjectionMatrix() );
+
+		/* Only the view space z of the Drawables' origins is needed for depth sorting: z_view = Dot( position_world, view column 2 ) + view[ 3 ][ 2 ]. */
+		const Vector3 view_z_axis			 = view_matrix.GetColumn< 3 >( 2 );
+		const float view_z_offset			 = view_matrix[ 3 ][ 2 ];
+		const float depth_normalizing_factor = 1.0f / camera_current->GetFarPlaneOffset();
+
+		CullDrawables();
+		const unsigned int visible_count = ( unsigned int )visible_drawable_list.size();
+		culling_statistics = { visible_count, ( unsigned int )( drawable_list.size() + static_drawable_list.size() ) - visible_count };
+
+		render_queue.Clear();
+		render_queue.Reserve( visible_count );
+		for( auto drawable : visible_drawable_list )
+		{
+			const Vector3 position_world = drawable->transform->GetWorldMatrix().GetRow< 3 >( 3 );
+			const float depth			 = -( Math::Dot( position_world, view_z_axis ) + view_z_offset ) * depth_normalizing_factor; // Camera looks toward -Z.
+
+			render_queue.Push( RenderQueue::MakeKey( drawable->GetRenderPass(), drawable->GetShader()->ProgramID(), drawable->GetMaterial()->ID(),
+													 drawable->GetVertexArray()->ID(), depth ),
+							   drawable );
+		}
+
+		render_queue.Sort();
+
+		const unsigned int instance_count = BuildDrawBatches();
+
+		instance_buffer.BeginFrame();
+		const unsigned int instance_buffer_offset = UploadInstanceTransforms( instance_count );
+
+		for( const auto& batch : draw_batch_list )
+		{
+			if( batch.instance_count == 0 )
+				batch.drawable->Submit();
+			else
+				batch.drawable->SubmitInstanced( instance_buffer.ID(), instance_buffer.Generation(), instance_buffer_layout,
+												 instance_buffer_offset + batch.first_instance * sizeof( Matrix4x4 ), batch.instance_count );
+		}
+
+		instance_buffer.EndFrame();
+
+		draw_call_count			= ( unsigned int )draw_batch_list.size();
+		state_change_statistics = state_cache.GetStatistics();
+	}
+
+	void Renderer::CullDrawables()
+	{
+		/* Below this many Drawables per batch, the threading overhead outweighs the gain. */
+		constexpr std::size_t MINIMUM_DRAWABLE_COUNT_PER_THREAD = 4096;
+
+		UpdateStaticHierarchy();
+
+		visible_drawable_list.clear();
+
+		if( !is_frustum_culling_enabled )
+		{
+			visible_drawable_list.insert( visible_drawable_list.end(), drawable_list.begin(), drawable_list.end() );
+			visible_drawable_list.insert( visible_drawable_list.end(), static_drawable_list.begin(), static_drawable_list.end() );
+			return;
+		}
+
+		const Math::Frustum frustum( camera_current->GetViewProjectionMatrix() );
+
+		/* World bounds & culling are independent per Drawable & world matrices are up to date (thus read-only) by now; each batch transforms its range of
+		 * bounds & culls it right away, while it is still in cache. */
+		const std::size_t drawable_count = drawable_list.size();
+		world_bounds_list.resize( drawable_count );
+		visibility_list.resize( drawable_count );
+		const auto cull_range = [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			for( std::size_t index = begin; index < end; index++ )
+				world_bounds_list[ index ] = WorldBounds( *drawable_list[ index ] );
+
+			frustum.Cull( std::span( world_bounds_list ).subspan( begin, end - begin ), std::span( visibility_list ).subspan( begin, end - begin ),
+						  Math::Threading::SingleThreaded );
+		};
+
+		if( drawable_count >= 2 * MINIMUM_DRAWABLE_COUNT_PER_THREAD )
+			Utility::ThreadPool::Default().ParallelFor( drawable_count, MINIMUM_DRAWABLE_COUNT_PER_THREAD, cull_range );
+		else
+			cull_range( 0, drawable_count );
+
+		for( std::size_t index = 0; index < drawable_count; index++ )
+			if( visibility_list[ index ] )
+				visible_drawable_list.push_back( drawable_list[ index ] );
+
+		static_visible_index_list.clear();
+		static_hierarchy.Query( frustum, static_visible_index_list );
+		for( const auto index : static_visible_index_list )
+			visible_drawable_list.push_back( static_drawable_list[ index ] );
+	}
+
+	void Renderer::UpdateStaticHierarchy()
+	{
+		if( !static_hierarchy_needs_rebuild && !static_hierarchy_needs_refit )
+			return;
+
+		static_world_bounds_list.resize( static_drawable_list.size() );
+		for( std::size_t index = 0; index < static_drawable_list.size(); index++ )
+			static_world_bounds_list[ index ] = WorldBounds( *static_drawable_list[ index ] );
+
+		if( static_hierarchy_needs_rebuild )
+			static_hierarchy.Build( static_world_bounds_list );
+		else
+			static_hierarchy.Refit( static_world_bounds_list );
+
+		static_hierarchy_needs_rebuild = static_hierarchy_needs_refit = false;
+	}
+
+	unsigned int Renderer::BuildDrawBatches()
+	{
+		draw_batch_list.clear();
+
+		unsigned int instance_count = 0;
+
+		const auto begin = render_queue.begin();
+		const auto end	 = render_queue.end();
+		for( auto iterator = begin; iterator != end; )
+		{
+			Drawable* drawable = iterator->drawable;
+
+			if( !drawable->GetShader()->IsInstanced() )
+			{
+				draw_batch_list.push_back( { drawable, 0, 0, 0 } );
+				++iterator;
+				continue;
+			}
+
+			/* Items with the same Material & VertexArray are adjacent after sorting (unless their ids collide in the truncated key fields; then the batch just ends early). */
+			const auto first_item = iterator;
+			while( iterator != end && iterator->drawable->GetMaterial() == drawable->GetMaterial() && iterator->drawable->GetVertexArray() == drawable->GetVertexArray() )
+				++iterator;
+
+			const unsigned int batch_instance_count = ( unsigned int )( iterator - first_item );
+			draw_batch_list.push_back( { drawable, batch_instance_count, instance_count, ( unsigned int )( first_item - begin ) } );
+			instance_count += batch_instance_count;
+		}
+
+		return instance_count;
+	}
+
+	unsigned int Renderer::UploadInstanceTransforms( const unsigned int instance_count )
+	{
+		if( instance_count == 0 )
+			return 0;
+
+		const unsigned int size_needed = instance_count * sizeof( Matrix4x4 );
+
+		/* Grow geometrically, to not re-allocate every frame while the instance count is rising. Never shrinks. */
+		unsigned int capacity = instance_buffer.FrameSize();
+		while( capacity < size_needed )
+			capacity *= 2;
+
+		instance_buffer.Reserve( capacity );
+
+		const auto allocation = instance_buffer.Allocate( size_needed );
+		Matrix4x4* instance_transforms = static_cast< Matrix4x4* >( allocation.data );
+
+		const auto items = render_queue.begin();
+		for( const auto& batch : draw_batch_list )
+			for( unsigned int i = 0; i < batch.instance_count; i++ )
+				instance_transforms[ batch.first_instance + i ] = items[ batch.first_item + i ].drawable->transform->GetWorldMatrix();
+
+		instance_buffer.Commit( allocation );
+
+		return allocation.offset;
+	}
+
+	void Renderer::UpdateCameraUniforms( const Matrix4x4& view_matrix, const Matrix4x4& projection_matrix )
+	{
+		camera_uniform_buffer.Update( UniformBlock::Camera{ view_matrix, projection_matrix } );
 	}
 
 	void Renderer::EndFrame() const
@@ -94,18 +310,57 @@ namespace Framework
 		drawable_list.erase( std::find( drawable_list.cbegin(), drawable_list.cend(), drawable ) );
 	}
 
+	void Renderer::AddStaticDrawable( Drawable* drawable )
+	{
+		if( !drawable->GetLocalBounds() )
+		{
+			AddDrawable( drawable );
+			return;
+		}
+
+		static_drawable_list.push_back( drawable );
+		static_hierarchy_needs_rebuild = true;
+	}
+
+	void Renderer::RemoveStaticDrawable( Drawable* drawable )
+	{
+		const auto iterator = std::find( static_drawable_list.cbegin(), static_drawable_list.cend(), drawable );
+		if( iterator == static_drawable_list.cend() )
+		{
+			RemoveDrawable( drawable ); // Had no bounds when added.
+			return;
+		}
+
+		static_drawable_list.erase( iterator );
+		static_hierarchy_needs_rebuild = true;
+	}
+
+	void Renderer::RefitStaticDrawables()
+	{
+		static_hierarchy_needs_refit = true;
+	}
+
+	Drawable* Renderer::PickStaticDrawable( const Math::Ray& ray ) const
+	{
+		if( static_hierarchy_needs_rebuild ) // Indices would not match static_drawable_list.
+			return nullptr;
+
+		const auto hit = static_hierarchy.Raycast( ray );
+		return hit ? static_drawable_list[ hit->primitive_index ] : nullptr;
+	}
+
 	void Renderer::SetPolygonMode( const PolygonMode mode ) const
 	{
-		GLCALL( glPolygonMode( GL_FRONT_AND_BACK, GL_POINT + ( unsigned int )mode ) );
+		StateCache::Instance().SetPolygonMode( GL_POINT + ( unsigned int )mode );
 	}
 
 	void Renderer::EnableDepthTest() const
 	{
-		glEnable( GL_DEPTH_TEST );
+		StateCache::Instance().SetDepthTest( true );
 	}
 
 	void Renderer::DisableDepthTest() const
 	{
-		glDisable( GL_DEPTH_TEST );
+		StateCache::Instance().SetDepthTest( false );
 	}
 }
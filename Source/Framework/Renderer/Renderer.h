@@ -1,12 +1,19 @@
 #pragma once
 
 // Framework Includes.
+#include "Math/BoundingVolumeHierarchy.h"
 #include "Math/Color.hpp"
 
 #include "Renderer/Camera.h"
 #include "Renderer/Drawable.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/StreamingBuffer.h"
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/VertexBufferLayout.h"
 
 // std Includes.
+#include <cstdint>
 #include <vector>
 
 namespace Framework
@@ -18,6 +25,15 @@ namespace Framework
 
 	class Renderer
 	{
+	public:
+		static constexpr unsigned int INSTANCE_BUFFER_INITIAL_CAPACITY = 1024; // In instances.
+
+		struct CullingStatistics
+		{
+			unsigned int visible_count;
+			unsigned int culled_count;
+		};
+
 	public:
 		Renderer( Camera* camera, const Color4 clear_color = Color4::Clear_Default() );
 		~Renderer();
@@ -27,9 +43,17 @@ namespace Framework
 		void SetCamera( Camera* camera_to_render_into );
 
 		void BeginFrame() const;
+		/* Culls Drawables outside the camera's frustum (by the world space box enclosing their local bounds; Drawables without bounds are always drawn;
+		 * static ones through their hierarchy), sorts the rest by state (see RenderQueue) & submits them in that order.
+		 * Consecutive Drawables sharing a Material (of an instanced Shader) & a VertexArray are merged into a single instanced draw call;
+		 * their world matrices are streamed into (this frame's region of) the instance buffer once per frame. */
 		void DrawFrame();
 		void EndFrame() const;
 
+		/* Uploads the shared Camera uniform block. DrawFrame() does this once per frame from the current camera;
+		 * only needs to be called directly when drawing outside of DrawFrame() with custom matrices. */
+		void UpdateCameraUniforms( const Matrix4x4& view_matrix, const Matrix4x4& projection_matrix );
+
 		void Clear() const;
 		void Clear( GLbitfield mask ) const;
 		void Clear( const Color4& clear_color, GLbitfield mask = GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT ) const;
@@ -40,20 +64,83 @@ namespace Framework
 		void AddDrawable( Drawable* drawable );
 		void RemoveDrawable( Drawable* drawable );
 
+		/* For Drawables that rarely move, in large numbers: culled by querying a BoundingVolumeHierarchy over their world bounds instead of testing each one.
+		 * The hierarchy is rebuilt by the next DrawFrame() after adding or removing any. Drawables without bounds are added as regular ones. */
+		void AddStaticDrawable( Drawable* drawable );
+		void RemoveStaticDrawable( Drawable* drawable );
+		/* Call after moving static Drawables; the next DrawFrame() refits the hierarchy to their new bounds. */
+		void RefitStaticDrawables();
+		/* The static Drawable whose world bounds the ray enters first, as of the last DrawFrame(); nullptr if none. */
+		Drawable* PickStaticDrawable( const Math::Ray& ray ) const;
+
+		/* Enabled by default. */
+		inline void SetFrustumCulling( const bool enable ) { is_frustum_culling_enabled = enable; }
+		inline bool IsFrustumCullingEnabled() const { return is_frustum_culling_enabled; }
+
 		void SetPolygonMode( const PolygonMode mode ) const;
 
 		void EnableDepthTest() const;
 		void DisableDepthTest() const;
 
+		/* GL state changes & skipped redundant binds of the last DrawFrame(). */
+		inline const StateCache::Statistics& GetStateChangeStatistics() const { return state_change_statistics; }
+		/* Draw calls issued by the last DrawFrame(); instanced batches count as one. */
+		inline unsigned int GetDrawCallCount() const { return draw_call_count; }
+		/* Drawables drawn & culled by the last DrawFrame(). */
+		inline const CullingStatistics& GetCullingStatistics() const { return culling_statistics; }
+		/* Stalls, orphans & overflows of the instance buffer, accumulated since the start. */
+		inline const StreamingBuffer::Statistics& GetInstanceBufferStatistics() const { return instance_buffer.GetStatistics(); }
+
 		constexpr unsigned int	PixelWidth() const	{ return pixel_width; }
 		constexpr unsigned int	PixelHeight() const { return pixel_height; }
 		constexpr float			AspectRatio() const { return aspect_ratio; }
 
+	private:
+		/* Either a single Drawable (instance_count == 0) or a batch of instance_count Drawables sharing the Material & VertexArray of drawable,
+		 * which are the render queue's items starting at first_item. */
+		struct DrawBatch
+		{
+			Drawable* drawable;
+			unsigned int instance_count;
+			unsigned int first_instance;
+			unsigned int first_item;
+		};
+
+		/* Fills visible_drawable_list. */
+		void CullDrawables();
+		/* Rebuilds or refits static_hierarchy, if requested. */
+		void UpdateStaticHierarchy();
+		/* Groups the sorted render queue into draw batches. Returns the total instance count of the instanced batches. */
+		unsigned int BuildDrawBatches();
+		/* Writes the world matrices of all instanced batches straight into this frame's region of the instance buffer, growing it if needed.
+		 * Returns their offset into the buffer. */
+		unsigned int UploadInstanceTransforms( const unsigned int instance_count );
+
 	private:
 		Camera* camera_current;
 		unsigned int pixel_width, pixel_height;
 		float aspect_ratio;
 		std::vector< Drawable* > drawable_list;
+		/* Per Drawable, in the order of drawable_list; rebuilt every frame. */
+		std::vector< Math::AABB > world_bounds_list;
+		std::vector< std::uint8_t > visibility_list;
+		std::vector< Drawable* > static_drawable_list;
+		/* In the order of static_drawable_list. */
+		std::vector< Math::AABB > static_world_bounds_list;
+		Math::BoundingVolumeHierarchy static_hierarchy;
+		std::vector< std::uint32_t > static_visible_index_list;
+		std::vector< Drawable* > visible_drawable_list;
+		RenderQueue render_queue;
+		std::vector< DrawBatch > draw_batch_list;
+		StreamingBuffer instance_buffer;
+		VertexBufferLayout instance_buffer_layout;
+		UniformBuffer camera_uniform_buffer;
+		StateCache::Statistics state_change_statistics;
+		unsigned int draw_call_count;
+		CullingStatistics culling_statistics;
 		Color4 color_clear;
+		bool is_frustum_culling_enabled;
+		bool static_hierarchy_needs_rebuild;
+		bool static_hierarchy_needs_refit;
 	};
 }
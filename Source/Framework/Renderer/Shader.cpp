@@ -1,8 +1,11 @@
 // Framework Includes.
 #include "Renderer/Shader.h"
 #include "Renderer/ShaderTypeInformation.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/UniformBlock.h"
 
 // std Includes.
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -10,7 +13,10 @@ namespace Framework
 {
 	Shader::Shader( const char* vertex_shader_file_path, const char* fragment_shader_file_path, const char* name )
 		:
-		name( name )
+		name( name ),
+		material_block_size( 0 ),
+		instance_transform_attribute_location( -1 ),
+		material_id_applied( 0 )
 	{
 		std::string vertex_shader_source = ReadShaderFromFile( vertex_shader_file_path, "VERTEX" );
 		const auto  vertex_shader_id     = CompileShader( vertex_shader_source.c_str(), "VERTEX", GL_VERTEX_SHADER );
@@ -20,7 +26,10 @@ namespace Framework
 
 		program_id = CreateProgramAndLinkShaders( vertex_shader_id, fragment_shader_id );
 		
-		ParseUniformData( uniform_info_map );
+		ParseUniformData();
+		BindUniformBlocks();
+
+		GLCALL( instance_transform_attribute_location = glGetAttribLocation( program_id, "transform_world" ) );
 
 		GLCALL( glDeleteShader( vertex_shader_id ) );
 		GLCALL( glDeleteShader( fragment_shader_id ) );
@@ -29,32 +38,72 @@ namespace Framework
 	Shader::~Shader()
 	{
 		GLCALL( glDeleteProgram( program_id ) );
+		StateCache::Instance().OnProgramDeleted( program_id );
 	}
 
 	void Shader::Bind() const
 	{
-		GLCALL( glUseProgram( program_id ) );
+		StateCache::Instance().UseProgram( program_id );
 	}
 
 	void Shader::SetFloat( const std::string& uniform_name, const float value )
 	{
-		const auto& uniform_info = GetUniformInformation( uniform_name );
+		SetFloat( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetInt( const std::string& uniform_name, const int value )
+	{
+		SetInt( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetBool( const std::string& uniform_name, const bool value )
+	{
+		SetBool( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetFloat( const UniformName uniform_name, const float value )
+	{
+		SetFloat( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetFloat( const UniformHandle uniform_handle, const float value )
+	{
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
 		ASSERT_DEBUG_ONLY( uniform_info.type == GL_FLOAT );
 
 		GLCALL( glUniform1f( uniform_info.location, value ) );
 	}
 
-	void Shader::SetInt( const std::string& uniform_name, const int value )
+	void Shader::SetInt( const UniformName uniform_name, const int value )
+	{
+		SetInt( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetInt( const UniformHandle uniform_handle, const int value )
 	{
-		const auto& uniform_info = GetUniformInformation( uniform_name );
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
 		ASSERT_DEBUG_ONLY( uniform_info.type == GL_INT );
 
 		GLCALL( glUniform1i( uniform_info.location, value ) );
 	}
 
-	void Shader::SetBool( const std::string& uniform_name, const bool value )
+	void Shader::SetBool( const UniformName uniform_name, const bool value )
 	{
-		const auto& uniform_info = GetUniformInformation( uniform_name );
+		SetBool( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetBool( const UniformHandle uniform_handle, const bool value )
+	{
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
 		ASSERT_DEBUG_ONLY( uniform_info.type == GL_BOOL );
 
 		GLCALL( glUniform1i( uniform_info.location, ( int )value ) );
@@ -62,54 +111,209 @@ namespace Framework
 
 	void Shader::SetColor( const std::string& uniform_name, const Color3& value )
 	{
-		SetVector< float, 3 >( uniform_name, static_cast< const Vector3& >( value ) );
+		SetColor( GetUniformHandle( uniform_name ), value );
 	}
 
 	void Shader::SetColor( const std::string& uniform_name, const Color4& value )
 	{
-		SetVector< float, 4 >( uniform_name, static_cast< const Vector4& >( value ) );
+		SetColor( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetColor( const UniformName uniform_name, const Color3& value )
+	{
+		SetColor( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetColor( const UniformHandle uniform_handle, const Color3& value )
+	{
+		SetVector< float, 3 >( uniform_handle, static_cast< const Vector3& >( value ) );
+	}
+
+	void Shader::SetColor( const UniformName uniform_name, const Color4& value )
+	{
+		SetColor( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetColor( const UniformHandle uniform_handle, const Color4& value )
+	{
+		SetVector< float, 4 >( uniform_handle, static_cast< const Vector4& >( value ) );
 	}
 
 	void Shader::SetTextureSampler1D( const std::string& uniform_name, const int value )
 	{
-		const auto& uniform_info = GetUniformInformation( uniform_name );
+		SetTextureSampler1D( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler2D( const std::string& uniform_name, const int value )
+	{
+		SetTextureSampler2D( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler3D( const std::string& uniform_name, const int value )
+	{
+		SetTextureSampler3D( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler2DArray( const std::string& uniform_name, const int value )
+	{
+		SetTextureSampler2DArray( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler1D( const UniformName uniform_name, const int value )
+	{
+		SetTextureSampler1D( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler1D( const UniformHandle uniform_handle, const int value )
+	{
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
 		ASSERT_DEBUG_ONLY( uniform_info.type == GL_SAMPLER_1D );
 
 		GLCALL( glUniform1i( uniform_info.location, value ) );
 	}
 
-	void Shader::SetTextureSampler2D( const std::string& uniform_name, const int value )
+	void Shader::SetTextureSampler2D( const UniformName uniform_name, const int value )
 	{
-		const auto& uniform_info = GetUniformInformation( uniform_name );
+		SetTextureSampler2D( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler2D( const UniformHandle uniform_handle, const int value )
+	{
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
 		ASSERT_DEBUG_ONLY( uniform_info.type == GL_SAMPLER_2D );
 
 		GLCALL( glUniform1i( uniform_info.location, value ) );
 	}
 
-	void Shader::SetTextureSampler3D( const std::string& uniform_name, const int value )
+	void Shader::SetTextureSampler3D( const UniformName uniform_name, const int value )
+	{
+		SetTextureSampler3D( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler3D( const UniformHandle uniform_handle, const int value )
 	{
-		const auto& uniform_info = GetUniformInformation( uniform_name );
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
 		ASSERT_DEBUG_ONLY( uniform_info.type == GL_SAMPLER_3D );
 
 		GLCALL( glUniform1i( uniform_info.location, value ) );
 	}
 
-	const ShaderUniformInformation& Shader::GetUniformInformation( const std::string& uniform_name )
+	void Shader::SetTextureSampler2DArray( const UniformName uniform_name, const int value )
+	{
+		SetTextureSampler2DArray( GetUniformHandle( uniform_name ), value );
+	}
+
+	void Shader::SetTextureSampler2DArray( const UniformHandle uniform_handle, const int value )
+	{
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
+		ASSERT_DEBUG_ONLY( uniform_info.type == GL_SAMPLER_2D_ARRAY );
+
+		GLCALL( glUniform1i( uniform_info.location, value ) );
+	}
+
+	void Shader::SetUniform( const UniformHandle uniform_handle, const void* value )
+	{
+		if( !uniform_handle.IsValid() )
+			return;
+
+		const auto& uniform_info = GetUniformInformation( uniform_handle );
+		ASSERT_DEBUG_ONLY( !uniform_info.is_in_material_block );
+
+		const auto floats = static_cast< const float*		 >( value );
+		const auto ints	  = static_cast< const int*			 >( value );
+		const auto uints  = static_cast< const unsigned int* >( value );
+		const auto bools  = static_cast< const bool*		 >( value );
+
+		switch( uniform_info.type )
+		{
+			/* Scalars & vectors: */
+			case GL_FLOAT								: GLCALL( glUniform1f( uniform_info.location, floats[ 0 ] ) ); break;
+			case GL_FLOAT_VEC2							: GLCALL( glUniform2fv( uniform_info.location, 1, floats ) ); break;
+			case GL_FLOAT_VEC3							: GLCALL( glUniform3fv( uniform_info.location, 1, floats ) ); break;
+			case GL_FLOAT_VEC4							: GLCALL( glUniform4fv( uniform_info.location, 1, floats ) ); break;
+
+			case GL_INT									: GLCALL( glUniform1i( uniform_info.location, ints[ 0 ] ) ); break;
+			case GL_INT_VEC2							: GLCALL( glUniform2iv( uniform_info.location, 1, ints ) ); break;
+			case GL_INT_VEC3							: GLCALL( glUniform3iv( uniform_info.location, 1, ints ) ); break;
+			case GL_INT_VEC4							: GLCALL( glUniform4iv( uniform_info.location, 1, ints ) ); break;
+
+			case GL_UNSIGNED_INT						: GLCALL( glUniform1ui( uniform_info.location, uints[ 0 ] ) ); break;
+			case GL_UNSIGNED_INT_VEC2					: GLCALL( glUniform2uiv( uniform_info.location, 1, uints ) ); break;
+			case GL_UNSIGNED_INT_VEC3					: GLCALL( glUniform3uiv( uniform_info.location, 1, uints ) ); break;
+			case GL_UNSIGNED_INT_VEC4					: GLCALL( glUniform4uiv( uniform_info.location, 1, uints ) ); break;
+
+			case GL_BOOL								: GLCALL( glUniform1i( uniform_info.location, bools[ 0 ] ) ); break;
+			case GL_BOOL_VEC2							: GLCALL( glUniform2i( uniform_info.location, bools[ 0 ], bools[ 1 ] ) ); break;
+			case GL_BOOL_VEC3							: GLCALL( glUniform3i( uniform_info.location, bools[ 0 ], bools[ 1 ], bools[ 2 ] ) ); break;
+			case GL_BOOL_VEC4							: GLCALL( glUniform4i( uniform_info.location, bools[ 0 ], bools[ 1 ], bools[ 2 ], bools[ 3 ] ) ); break;
+
+			/* Float matrices (row-major, as SetMatrix()): */
+			case GL_FLOAT_MAT2 							: GLCALL( glUniformMatrix2fv( uniform_info.location, 1, GL_TRUE, floats ) ); break;
+			case GL_FLOAT_MAT3 							: GLCALL( glUniformMatrix3fv( uniform_info.location, 1, GL_TRUE, floats ) ); break;
+			case GL_FLOAT_MAT4 							: GLCALL( glUniformMatrix4fv( uniform_info.location, 1, GL_TRUE, floats ) ); break;
+
+			/* Texture samplers: */
+			case GL_SAMPLER_1D 							:
+			case GL_SAMPLER_2D 							:
+			case GL_SAMPLER_3D 							:
+			case GL_SAMPLER_2D_ARRAY 					: GLCALL( glUniform1i( uniform_info.location, ints[ 0 ] ) ); break;
+
+			default:
+				/* Non-square matrices can not be set via SetMatrix() either. */
+				ASSERT_DEBUG_ONLY( false && "Shader::SetUniform(): Unsupported uniform type." );
+				break;
+		}
+	}
+
+	UniformHandle Shader::GetUniformHandle( const std::string& uniform_name ) const
 	{
 	#ifdef _DEBUG
 		try
 		{
-			return uniform_info_map.at( uniform_name );
+			return uniform_handle_map.at( uniform_name );
 		}
 		catch( const std::exception& )
 		{
 			throw std::runtime_error( R"(ERROR::SHADER::UNIFORM::")" + std::string( uniform_name ) + R"("::DOES_NOT_EXIST)" );
 		}
 	#else
-		return uniform_info_map[ uniform_name ];
+		if( const auto iterator = uniform_handle_map.find( uniform_name ); iterator != uniform_handle_map.cend() )
+			return iterator->second;
+
+		return {};
 	#endif // DEBUG
 	}
 
+	UniformHandle Shader::GetUniformHandle( const UniformName uniform_name ) const
+	{
+		const auto iterator = std::lower_bound( uniform_hash_table.cbegin(), uniform_hash_table.cend(), uniform_name.hash,
+												[]( const auto& entry, const std::uint32_t hash ) { return entry.first < hash; } );
+
+		const bool found = iterator != uniform_hash_table.cend() && iterator->first == uniform_name.hash;
+
+	#ifdef _DEBUG
+		/* Guard against names that are not in this shader but happen to share a hash with one that is. */
+		const auto string_iterator = uniform_handle_map.find( uniform_name.name );
+
+		if( !found || string_iterator == uniform_handle_map.cend() || string_iterator->second.index != iterator->second.index )
+			throw std::runtime_error( R"(ERROR::SHADER::UNIFORM::")" + std::string( uniform_name.name ) + R"("::DOES_NOT_EXIST)" );
+	#endif // DEBUG
+
+		return found ? iterator->second : UniformHandle{};
+	}
+
 	std::string Shader::ReadShaderFromFile( const char* file_path, const char* shader_type_string )
 	{
 		std::ifstream file;
@@ -175,7 +379,7 @@ namespace Framework
 		return program_id;
 	}
 
-	void Shader::ParseUniformData( std::unordered_map< std::string, ShaderUniformInformation >& uniform_information_map )
+	void Shader::ParseUniformData()
 	{
 		int active_uniform_count = 0;
 		GLCALL( glGetProgramiv( program_id, GL_ACTIVE_UNIFORMS, &active_uniform_count ) );
@@ -187,7 +391,19 @@ namespace Framework
 		GLCALL( glGetProgramiv( program_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &uniform_name_max_length ) );
 		std::string name( uniform_name_max_length, '?' );
 
-		int offset = 0;
+		uniform_info_list.reserve( active_uniform_count );
+
+		GLClearError();
+		const GLuint material_block_index = glGetUniformBlockIndex( program_id, UniformBlock::Material::NAME );
+		ASSERT( GLLogCall( "glGetUniformBlockIndex", __FILE__, __LINE__ ) );
+
+		if( material_block_index != GL_INVALID_INDEX )
+		{
+			GLCALL( glGetActiveUniformBlockiv( program_id, material_block_index, GL_UNIFORM_BLOCK_DATA_SIZE, &material_block_size ) );
+		}
+
+		/* Material block comes first in Material's uniform blob, in std140 layout. Regular uniforms are packed after it. */
+		int offset = material_block_size;
 		for( int uniform_index = 0; uniform_index < active_uniform_count; uniform_index++ )
 		{
 			/*
@@ -198,13 +414,62 @@ namespace Framework
 			glGetActiveUniform( program_id, uniform_index, uniform_name_max_length, &length, &array_size_dontCare, &type, name.data() );
 			GLCALL( glGetActiveUniform( program_id, uniform_index, uniform_name_max_length, &length, &array_size_dontCare, &type, name.data() ) );
 
+			const GLuint uniform_index_unsigned = uniform_index;
+			int block_index = -1;
+			GLCALL( glGetActiveUniformsiv( program_id, 1, &uniform_index_unsigned, GL_UNIFORM_BLOCK_INDEX, &block_index ) );
+
 			const int size = GetSizeOfType( type );
 
-			GLClearError();
-			uniform_information_map[ name.data() ] = { glGetUniformLocation( program_id, name.data() ), size, offset, type };
-			ASSERT( GLLogCall( "glGetUniformLocation", __FILE__, __LINE__ ) );
+			if( block_index == -1 )
+			{
+				GLClearError();
+				uniform_handle_map[ name.data() ] = { ( unsigned int )uniform_info_list.size() };
+				uniform_info_list.push_back( { glGetUniformLocation( program_id, name.data() ), size, offset, type, false } );
+				ASSERT( GLLogCall( "glGetUniformLocation", __FILE__, __LINE__ ) );
+
+				offset += size;
+			}
+			else if( ( GLuint )block_index == material_block_index )
+			{
+				int block_offset = 0;
+				GLCALL( glGetActiveUniformsiv( program_id, 1, &uniform_index_unsigned, GL_UNIFORM_OFFSET, &block_offset ) );
+
+				uniform_handle_map[ name.data() ] = { ( unsigned int )uniform_info_list.size() };
+				uniform_info_list.push_back( { -1, GetStd140SizeOfType( type ), block_offset, type, true } );
+			}
+			/* Members of other (shared) blocks are sourced from their UniformBuffers, not set individually; skip them. */
+		}
+
+		uniform_hash_table.reserve( uniform_handle_map.size() );
+		for( const auto& [ uniform_name, uniform_handle ] : uniform_handle_map )
+			uniform_hash_table.emplace_back( Utility::Hash::FNV1a( uniform_name ), uniform_handle );
 
-			offset += size;
+		std::sort( uniform_hash_table.begin(), uniform_hash_table.end(), []( const auto& lhs, const auto& rhs ) { return lhs.first < rhs.first; } );
+
+	#ifdef _DEBUG
+		for( std::size_t i = 1; i < uniform_hash_table.size(); i++ )
+		{
+			if( uniform_hash_table[ i - 1 ].first == uniform_hash_table[ i ].first )
+				throw std::runtime_error( R"(ERROR::SHADER::")" + this->name + R"("::UNIFORM_NAME_HASH_COLLISION)" );
 		}
+	#endif // DEBUG
+	}
+
+	void Shader::BindUniformBlocks()
+	{
+		const auto bind = [ & ]( const char* block_name, const UniformBlock::BindingPoint binding_point )
+		{
+			GLClearError();
+			const GLuint block_index = glGetUniformBlockIndex( program_id, block_name );
+			ASSERT( GLLogCall( "glGetUniformBlockIndex", __FILE__, __LINE__ ) );
+
+			if( block_index != GL_INVALID_INDEX )
+			{
+				GLCALL( glUniformBlockBinding( program_id, block_index, ( GLuint )binding_point ) );
+			}
+		};
+
+		bind( UniformBlock::Camera::NAME,	UniformBlock::Camera::BINDING_POINT );
+		bind( UniformBlock::Material::NAME, UniformBlock::Material::BINDING_POINT );
 	}
 }
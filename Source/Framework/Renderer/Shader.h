@@ -15,11 +15,15 @@
 // std Includes.
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Framework
 {
 	class Shader
 	{
+		friend class Material;
+
 	public:
 		Shader( const char* vertex_shader_file_path, const char* fragment_shader_file_path, const char* name );
 		~Shader();
@@ -30,11 +34,36 @@ namespace Framework
 		void SetInt( const std::string& uniform_name, const int value );
 		void SetBool( const std::string& uniform_name, const bool value );
 
+		void SetFloat( const UniformName uniform_name, const float value );
+		void SetInt( const UniformName uniform_name, const int value );
+		void SetBool( const UniformName uniform_name, const bool value );
+
+		void SetFloat( const UniformHandle uniform_handle, const float value );
+		void SetInt( const UniformHandle uniform_handle, const int value );
+		void SetBool( const UniformHandle uniform_handle, const bool value );
+
 		template< Concepts::Arithmetic Coordinate, std::size_t Size >
 			requires Concepts::NonZero< Size >
 		void SetVector( const std::string& uniform_name, const Math::Vector< Coordinate, Size >& value )
 		{
-			const auto& uniform_info = GetUniformInformation( uniform_name );
+			SetVector( GetUniformHandle( uniform_name ), value );
+		}
+
+		template< Concepts::Arithmetic Coordinate, std::size_t Size >
+			requires Concepts::NonZero< Size >
+		void SetVector( const UniformName uniform_name, const Math::Vector< Coordinate, Size >& value )
+		{
+			SetVector( GetUniformHandle( uniform_name ), value );
+		}
+
+		template< Concepts::Arithmetic Coordinate, std::size_t Size >
+			requires Concepts::NonZero< Size >
+		void SetVector( const UniformHandle uniform_handle, const Math::Vector< Coordinate, Size >& value )
+		{
+			if( !uniform_handle.IsValid() )
+				return;
+
+			const auto& uniform_info = GetUniformInformation( uniform_handle );
 
 			if constexpr( std::is_same_v< Coordinate, float > )
 			{
@@ -128,42 +157,111 @@ namespace Framework
 		void SetColor( const std::string& uniform_name, const Color3& value );
 		void SetColor( const std::string& uniform_name, const Color4& value );
 
+		void SetColor( const UniformName uniform_name, const Color3& value );
+		void SetColor( const UniformName uniform_name, const Color4& value );
+
+		void SetColor( const UniformHandle uniform_handle, const Color3& value );
+		void SetColor( const UniformHandle uniform_handle, const Color4& value );
+
 		/* Only accept square matrices for now. If there a use-case for non-square matrices come up, I'll refactor. */
-		template< unsigned int Size > requires Concepts::NonZero< Size >
+		template< std::size_t Size > requires Concepts::NonZero< Size >
 		void SetMatrix( const std::string& uniform_name, const Math::Matrix< float, Size, Size >& value )
 		{
+			SetMatrix( GetUniformHandle( uniform_name ), value );
+		}
+
+		template< std::size_t Size > requires Concepts::NonZero< Size >
+		void SetMatrix( const UniformName uniform_name, const Math::Matrix< float, Size, Size >& value )
+		{
+			SetMatrix( GetUniformHandle( uniform_name ), value );
+		}
+
+		template< std::size_t Size > requires Concepts::NonZero< Size >
+		void SetMatrix( const UniformHandle uniform_handle, const Math::Matrix< float, Size, Size >& value )
+		{
+			if( !uniform_handle.IsValid() )
+				return;
+
 			if constexpr( Size == 2U )
 			{
-				GLCALL( glUniformMatrix2fv( GetUniformInformation( uniform_name ).location, 1, GL_TRUE, value.Data() ) );
+				GLCALL( glUniformMatrix2fv( GetUniformInformation( uniform_handle ).location, 1, GL_TRUE, value.Data() ) );
 			}
 			if constexpr( Size == 3U )
 			{
-				GLCALL( glUniformMatrix3fv( GetUniformInformation( uniform_name ).location, 1, GL_TRUE, value.Data() ) );
+				GLCALL( glUniformMatrix3fv( GetUniformInformation( uniform_handle ).location, 1, GL_TRUE, value.Data() ) );
 			}
 			if constexpr( Size == 4U )
 			{
-				GLCALL( glUniformMatrix4fv( GetUniformInformation( uniform_name ).location, 1, GL_TRUE, value.Data() ) );
+				GLCALL( glUniformMatrix4fv( GetUniformInformation( uniform_handle ).location, 1, GL_TRUE, value.Data() ) );
 			}
 		}
 
 		void SetTextureSampler1D( const std::string& uniform_name, const int value );
 		void SetTextureSampler2D( const std::string& uniform_name, const int value );
 		void SetTextureSampler3D( const std::string& uniform_name, const int value );
+		void SetTextureSampler2DArray( const std::string& uniform_name, const int value );
+
+		void SetTextureSampler1D( const UniformName uniform_name, const int value );
+		void SetTextureSampler2D( const UniformName uniform_name, const int value );
+		void SetTextureSampler3D( const UniformName uniform_name, const int value );
+		void SetTextureSampler2DArray( const UniformName uniform_name, const int value );
 
-		inline const ShaderUniformInformation& GetUniformInformation( const std::string& uniform_name );
-		inline const std::unordered_map< std::string, ShaderUniformInformation >& GetUniformInformations() const { return uniform_info_map; }
+		void SetTextureSampler1D( const UniformHandle uniform_handle, const int value );
+		void SetTextureSampler2D( const UniformHandle uniform_handle, const int value );
+		void SetTextureSampler3D( const UniformHandle uniform_handle, const int value );
+		void SetTextureSampler2DArray( const UniformHandle uniform_handle, const int value );
+
+		/* Sets a regular (non-block) uniform of any type from its value in memory, laid out as its Math:: counterpart (as in Material's uniform blob; bools as
+		 * 1 byte each). Used to send stored values again. */
+		void SetUniform( const UniformHandle uniform_handle, const void* value );
+
+		/* Resolve handles once (for example; at construction time of the user) & use the UniformHandle overloads on the hot path.
+		 * Unknown names throw in debug builds; in release, they yield an invalid handle, which all setters ignore. */
+		UniformHandle GetUniformHandle( const std::string& uniform_name ) const;
+		/* Binary search over the sorted hash table. */
+		UniformHandle GetUniformHandle( const UniformName uniform_name ) const;
+
+		inline const ShaderUniformInformation& GetUniformInformation( const std::string& uniform_name ) const { return GetUniformInformation( GetUniformHandle( uniform_name ) ); }
+		inline const ShaderUniformInformation& GetUniformInformation( const UniformHandle uniform_handle ) const
+		{
+			ASSERT_DEBUG_ONLY( uniform_handle.index < uniform_info_list.size() );
+			return uniform_info_list[ uniform_handle.index ];
+		}
+		inline const std::vector< ShaderUniformInformation >& GetUniformInformations() const { return uniform_info_list; }
+		inline const std::unordered_map< std::string, UniformHandle >& GetUniformHandles() const { return uniform_handle_map; }
 
 		inline const std::string& Name() const { return name; }
+		inline GLuint ProgramID() const { return program_id; }
+
+		/* Size of the Material uniform block in std140 layout; 0 if the shader does not declare one. */
+		inline int GetMaterialBlockSize() const { return material_block_size; }
+
+		/* Instanced shaders declare the world matrix as a per-instance vertex attribute (mat4 transform_world) instead of a uniform;
+		 * the Renderer then draws all Drawables sharing a Material & VertexArray with one instanced draw call. */
+		inline bool IsInstanced() const { return instance_transform_attribute_location >= 0; }
+		/* First of the 4 consecutive locations the per-instance world matrix occupies; -1 if not instanced. */
+		inline GLint InstanceTransformAttributeLocation() const { return instance_transform_attribute_location; }
 
 	private:
 		static std::string ReadShaderFromFile( const char* file_path, const char* shader_type_string );
 		static unsigned int CompileShader( const char* shader_source, const char* shader_type_string, const GLenum shader_type );
 		static unsigned int CreateProgramAndLinkShaders( const unsigned int vertex_shader_id, const unsigned int fragment_shader_id );
-		void ParseUniformData( std::unordered_map< std::string, ShaderUniformInformation >& uniform_information_map );
+		/* Members of the Material block are recorded with their std140 offsets; members of other blocks are skipped, as they are not set individually. */
+		void ParseUniformData();
+		/* Binds the blocks with reserved names (see Renderer/UniformBlock.h) to their fixed binding points, if this shader uses them. */
+		void BindUniformBlocks();
 
 	private:
 		std::string name;
 		GLuint program_id;
-		std::unordered_map< std::string, ShaderUniformInformation > uniform_info_map;
+		/* Flat array, indexed by UniformHandle::index. */
+		std::vector< ShaderUniformInformation > uniform_info_list;
+		std::unordered_map< std::string, UniformHandle > uniform_handle_map;
+		/* Sorted by hash, for UniformName lookups. */
+		std::vector< std::pair< std::uint32_t, UniformHandle > > uniform_hash_table;
+		int material_block_size;
+		GLint instance_transform_attribute_location;
+		/* ID of the Material whose regular uniforms the program currently holds (see Material::Bind()); 0 if none. */
+		unsigned int material_id_applied;
 	};
 }
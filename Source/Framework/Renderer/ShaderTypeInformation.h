@@ -8,6 +8,7 @@
 #include "Math/Vector.hpp"
 
 // std Includes.
+#include <cstdint>
 #include <stdexcept>
 #include <variant>
 
@@ -76,15 +77,36 @@ namespace Framework
 
 			// OpenGL 3.3 does not have matrices of double type.
 
+			/* Vertex attribute component types (see VertexBufferLayout): */
+			case GL_HALF_FLOAT							: return sizeof( std::uint16_t );
+			case GL_UNSIGNED_SHORT						: return sizeof( std::uint16_t );
+			case GL_UNSIGNED_BYTE						: return sizeof( std::uint8_t );
+			case GL_INT_2_10_10_10_REV					: return sizeof( std::uint32_t );
+
 			/* Texture samplers: */
 			case GL_SAMPLER_1D 							: return sizeof( int );
 			case GL_SAMPLER_2D 							: return sizeof( int );
 			case GL_SAMPLER_3D 							: return sizeof( int );
+			case GL_SAMPLER_2D_ARRAY 					: return sizeof( int );
 		}
 
 		throw std::runtime_error( "ERROR::SHADER_TYPE::GetSizeOfType() called with an unknown GL type!" );
 	}
 
+	/* Size of a member of a std140 uniform block, excluding padding. Differs from GetSizeOfType() only for bools, which std140 stores as 4 byte ints. */
+	inline int GetStd140SizeOfType( const GLenum type )
+	{
+		switch( type )
+		{
+			case GL_BOOL								: return sizeof( int );
+			case GL_BOOL_VEC2							: return sizeof( Vector2I );
+			case GL_BOOL_VEC3							: return sizeof( Vector3I );
+			case GL_BOOL_VEC4							: return sizeof( Vector4I );
+		}
+
+		return GetSizeOfType( type );
+	}
+
 	inline const char* GetNameOfType( const GLenum type )
 	{
 		switch( type )
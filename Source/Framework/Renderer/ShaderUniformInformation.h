@@ -3,13 +3,49 @@
 // Vendor GLAD Includes (Has to be included before GLFW!).
 #include "Vendor/OpenGL/glad/glad.h"
 
+// Framework Includes.
+#include "Utility/Hash.h"
+
+// std Includes.
+#include <cstdint>
+
 namespace Framework
 {
 	struct ShaderUniformInformation
 	{
 		int location;
+		/* Bytes in Material's uniform blob. Bools inside the Material block take 4 bytes per component (std140), instead of 1. */
 		int size;
+		/* Offset into Material's uniform blob. For members of the Material block, this is the std140 offset inside the block (and location is -1). */
 		int offset;
 		GLenum type;
+		bool is_in_material_block;
+	};
+
+	/* Resolved once at setup time (via Shader::GetUniformHandle()) & then used to index the Shader's flat uniform array directly;
+	 * no string construction, hashing or map lookups on the hot path. */
+	struct UniformHandle
+	{
+		static constexpr unsigned int INVALID_INDEX = ~0U;
+
+		unsigned int index = INVALID_INDEX;
+
+		constexpr bool IsValid() const { return index != INVALID_INDEX; }
+	};
+
+	/* Uniform name hashed at compile time (via the _uniform literal). Lookups with it are a binary search over the Shader's sorted hash table;
+	 * no allocations or string compares. The name is only kept for error messages & debug validation. */
+	struct UniformName
+	{
+		std::uint32_t hash;
+		const char* name;
 	};
+
+	namespace Literals
+	{
+		consteval UniformName operator"" _uniform( const char* name, const std::size_t length )
+		{
+			return UniformName{ Utility::Hash::FNV1a( std::string_view( name, length ) ), name };
+		}
+	}
 }
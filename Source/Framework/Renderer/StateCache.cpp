@@ -0,0 +1,227 @@
+// Framework Includes.
+#include "Renderer/Graphics.h"
+#include "Renderer/StateCache.h"
+
+namespace Framework
+{
+	StateCache::FunctionTable StateCache::FunctionTable::GLAD()
+	{
+		return FunctionTable
+		{
+			.UseProgram			= []( GLuint program_id )									{ GLCALL( glUseProgram( program_id ) ); },
+			.BindVertexArray	= []( GLuint vertex_array_id )								{ GLCALL( glBindVertexArray( vertex_array_id ) ); },
+			.ActiveTexture		= []( GLenum texture_unit )									{ GLCALL( glActiveTexture( texture_unit ) ); },
+			.BindTexture		= []( GLenum target, GLuint texture_id )					{ GLCALL( glBindTexture( target, texture_id ) ); },
+			.BindBuffer			= []( GLenum target, GLuint buffer_id )						{ GLCALL( glBindBuffer( target, buffer_id ) ); },
+			.BindBufferBase		= []( GLenum target, GLuint index, GLuint buffer_id )		{ GLCALL( glBindBufferBase( target, index, buffer_id ) ); },
+			.Enable				= []( GLenum capability )									{ GLCALL( glEnable( capability ) ); },
+			.Disable			= []( GLenum capability )									{ GLCALL( glDisable( capability ) ); },
+			.PolygonMode		= []( GLenum face, GLenum mode )							{ GLCALL( glPolygonMode( face, mode ) ); }
+		};
+	}
+
+	StateCache::StateCache( const FunctionTable& function_table )
+		:
+		functions( function_table ),
+		statistics{}
+	{
+		Invalidate();
+	}
+
+	StateCache& StateCache::Instance()
+	{
+		static StateCache instance;
+		return instance;
+	}
+
+	void StateCache::UseProgram( const GLuint program_id )
+	{
+		if( program_current == program_id )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		functions.UseProgram( program_id );
+		program_current = program_id;
+		statistics.program_change_count++;
+	}
+
+	void StateCache::BindVertexArray( const GLuint vertex_array_id )
+	{
+		if( vertex_array_current == vertex_array_id )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		functions.BindVertexArray( vertex_array_id );
+		vertex_array_current = vertex_array_id;
+		buffer_binding_list[ ( int )BufferTarget::ElementArray ] = UNKNOWN;
+		statistics.vertex_array_change_count++;
+	}
+
+	void StateCache::BindTexture( const GLenum texture_unit, const GLenum target, const GLuint texture_id )
+	{
+		const std::size_t unit_index = texture_unit - GL_TEXTURE0;
+		ASSERT_DEBUG_ONLY( unit_index < MAX_TEXTURE_UNIT_COUNT );
+
+		auto& binding = texture_binding_list[ unit_index ];
+		if( binding.id == texture_id && binding.target == target )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		if( texture_unit_active != texture_unit )
+		{
+			functions.ActiveTexture( texture_unit );
+			texture_unit_active = texture_unit;
+		}
+
+		functions.BindTexture( target, texture_id );
+		binding = { target, texture_id };
+		statistics.texture_change_count++;
+	}
+
+	void StateCache::BindTexture( const GLenum target, const GLuint texture_id )
+	{
+		if( texture_unit_active == UNKNOWN )
+		{
+			/* Can not know which unit's binding changes; bind without caching. */
+			functions.BindTexture( target, texture_id );
+			statistics.texture_change_count++;
+			return;
+		}
+
+		BindTexture( texture_unit_active, target, texture_id );
+	}
+
+	void StateCache::BindBuffer( const GLenum target, const GLuint buffer_id )
+	{
+		const BufferTarget buffer_target = ToBufferTarget( target );
+		if( buffer_target == BufferTarget::Count )
+		{
+			functions.BindBuffer( target, buffer_id );
+			statistics.buffer_change_count++;
+			return;
+		}
+
+		auto& binding = buffer_binding_list[ ( int )buffer_target ];
+		if( binding == buffer_id )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		functions.BindBuffer( target, buffer_id );
+		binding = buffer_id;
+		statistics.buffer_change_count++;
+	}
+
+	void StateCache::BindUniformBuffer( const GLuint binding_point, const GLuint buffer_id )
+	{
+		ASSERT_DEBUG_ONLY( binding_point < MAX_UNIFORM_BUFFER_COUNT );
+
+		if( uniform_buffer_binding_list[ binding_point ] == buffer_id )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		functions.BindBufferBase( GL_UNIFORM_BUFFER, binding_point, buffer_id );
+		uniform_buffer_binding_list[ binding_point ]		   = buffer_id;
+		buffer_binding_list[ ( int )BufferTarget::Uniform ] = buffer_id;
+		statistics.uniform_buffer_change_count++;
+	}
+
+	void StateCache::SetDepthTest( const bool enable )
+	{
+		const Toggle requested = enable ? Toggle::Enabled : Toggle::Disabled;
+		if( depth_test == requested )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		if( enable )
+			functions.Enable( GL_DEPTH_TEST );
+		else
+			functions.Disable( GL_DEPTH_TEST );
+
+		depth_test = requested;
+		statistics.render_state_change_count++;
+	}
+
+	void StateCache::SetPolygonMode( const GLenum mode )
+	{
+		if( polygon_mode == mode )
+		{
+			statistics.redundant_bind_count++;
+			return;
+		}
+
+		functions.PolygonMode( GL_FRONT_AND_BACK, mode );
+		polygon_mode = mode;
+		statistics.render_state_change_count++;
+	}
+
+	void StateCache::OnProgramDeleted( const GLuint program_id )
+	{
+		if( program_current == program_id )
+			program_current = UNKNOWN;
+	}
+
+	void StateCache::OnVertexArrayDeleted( const GLuint vertex_array_id )
+	{
+		if( vertex_array_current == vertex_array_id )
+		{
+			vertex_array_current = UNKNOWN;
+			buffer_binding_list[ ( int )BufferTarget::ElementArray ] = UNKNOWN;
+		}
+	}
+
+	void StateCache::OnTextureDeleted( const GLuint texture_id )
+	{
+		for( auto& binding : texture_binding_list )
+			if( binding.id == texture_id )
+				binding = { GL_NONE, UNKNOWN };
+	}
+
+	void StateCache::OnBufferDeleted( const GLuint buffer_id )
+	{
+		for( auto& binding : buffer_binding_list )
+			if( binding == buffer_id )
+				binding = UNKNOWN;
+
+		for( auto& binding : uniform_buffer_binding_list )
+			if( binding == buffer_id )
+				binding = UNKNOWN;
+	}
+
+	void StateCache::Invalidate()
+	{
+		program_current		 = UNKNOWN;
+		vertex_array_current = UNKNOWN;
+		texture_unit_active	 = UNKNOWN;
+		texture_binding_list.fill( { GL_NONE, UNKNOWN } );
+		buffer_binding_list.fill( UNKNOWN );
+		uniform_buffer_binding_list.fill( UNKNOWN );
+		depth_test			 = Toggle::Unknown;
+		polygon_mode		 = UNKNOWN;
+	}
+
+	StateCache::BufferTarget StateCache::ToBufferTarget( const GLenum target )
+	{
+		switch( target )
+		{
+			case GL_ARRAY_BUFFER:			return BufferTarget::Array;
+			case GL_ELEMENT_ARRAY_BUFFER:	return BufferTarget::ElementArray;
+			case GL_UNIFORM_BUFFER:			return BufferTarget::Uniform;
+			case GL_PIXEL_PACK_BUFFER:		return BufferTarget::PixelPack;
+			case GL_PIXEL_UNPACK_BUFFER:	return BufferTarget::PixelUnpack;
+
+			default:						return BufferTarget::Count;
+		}
+	}
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+// Vendor GLAD Includes (Has to be included before GLFW!).
+#include "Vendor/OpenGL/glad/glad.h"
+
+// std Includes.
+#include <array>
+#include <cstddef>
+
+namespace Framework
+{
+	/* Shadows the GL binding & render state that changes per draw & skips calls that would not change anything.
+	 * All binds of programs, vertex arrays, textures & buffers, as well as depth test & polygon mode changes, are expected to go through the Instance() of this class;
+	 * call Invalidate() after any code that changes this state behind its back.
+	 * GL is reached only through the FunctionTable given at construction, so the cache can be exercised against a fake table without a GL context. */
+	class StateCache
+	{
+	public:
+		static constexpr std::size_t MAX_TEXTURE_UNIT_COUNT	  = 32;
+		static constexpr std::size_t MAX_UNIFORM_BUFFER_COUNT = 16;
+
+		/* The GL entry points the cache issues. Error checking (if any) is up to the functions themselves. */
+		struct FunctionTable
+		{
+			void ( *UseProgram )( GLuint program_id );
+			void ( *BindVertexArray )( GLuint vertex_array_id );
+			void ( *ActiveTexture )( GLenum texture_unit );
+			void ( *BindTexture )( GLenum target, GLuint texture_id );
+			void ( *BindBuffer )( GLenum target, GLuint buffer_id );
+			void ( *BindBufferBase )( GLenum target, GLuint index, GLuint buffer_id );
+			void ( *Enable )( GLenum capability );
+			void ( *Disable )( GLenum capability );
+			void ( *PolygonMode )( GLenum face, GLenum mode );
+
+			/* Forwards to the GLAD function pointers (via GLCALL), resolved at call time; safe to create before GLAD is loaded. */
+			static FunctionTable GLAD();
+		};
+
+		struct Statistics
+		{
+			std::size_t program_change_count;
+			std::size_t vertex_array_change_count;
+			std::size_t texture_change_count;
+			std::size_t buffer_change_count;
+			std::size_t uniform_buffer_change_count;
+			/* Depth test & polygon mode. */
+			std::size_t render_state_change_count;
+			/* Calls that were skipped as they would not have changed anything. */
+			std::size_t redundant_bind_count;
+
+			inline std::size_t StateChangeCount() const
+			{
+				return program_change_count + vertex_array_change_count + texture_change_count + buffer_change_count + uniform_buffer_change_count + render_state_change_count;
+			}
+		};
+
+	public:
+		explicit StateCache( const FunctionTable& function_table = FunctionTable::GLAD() );
+
+		StateCache( const StateCache& )				= delete;
+		StateCache& operator= ( const StateCache& )	= delete;
+
+		/* Used by Shader, VertexArray, the buffers, Texture, Material & the Renderer. Created on first use. */
+		static StateCache& Instance();
+
+		void UseProgram( const GLuint program_id );
+		/* False after Invalidate(), until the next UseProgram(). */
+		inline bool IsProgramInUse( const GLuint program_id ) const { return program_current == program_id; }
+		/* Also forgets the element array buffer binding, as it is part of the vertex array's state. */
+		void BindVertexArray( const GLuint vertex_array_id );
+		/* Activates the given unit (GL_TEXTURE0 + i) only if the texture is not already bound to it. */
+		void BindTexture( const GLenum texture_unit, const GLenum target, const GLuint texture_id );
+		/* Binds to the currently active texture unit. */
+		void BindTexture( const GLenum target, const GLuint texture_id );
+		/* Generic (non-indexed) binding points: GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_PIXEL_PACK_BUFFER & GL_PIXEL_UNPACK_BUFFER.
+		 * Other targets are passed through uncached. */
+		void BindBuffer( const GLenum target, const GLuint buffer_id );
+		/* Indexed GL_UNIFORM_BUFFER binding. When issued, glBindBufferBase also changes the generic GL_UNIFORM_BUFFER binding (tracked accordingly);
+		 * when skipped, the generic binding is left as is. Use BindBuffer() before updating the buffer's contents. */
+		void BindUniformBuffer( const GLuint binding_point, const GLuint buffer_id );
+
+		void SetDepthTest( const bool enable );
+		/* GL_POINT, GL_LINE or GL_FILL, for GL_FRONT_AND_BACK (the only face core profiles accept). */
+		void SetPolygonMode( const GLenum mode );
+
+		/* Deleted names may be reused by GL for new objects; forget them so that a new object with the same name is not considered bound. */
+		void OnProgramDeleted( const GLuint program_id );
+		void OnVertexArrayDeleted( const GLuint vertex_array_id );
+		void OnTextureDeleted( const GLuint texture_id );
+		void OnBufferDeleted( const GLuint buffer_id );
+
+		/* Forgets all cached state; the next call of each kind always reaches GL. */
+		void Invalidate();
+
+		inline const Statistics& GetStatistics() const { return statistics; }
+		inline void ResetStatistics() { statistics = {}; }
+
+	private:
+		/* Never a valid GL name, as names are generated sequentially starting from 1 & GL does not reach this in practice. */
+		static constexpr GLuint UNKNOWN = ~GLuint( 0 );
+
+		enum class BufferTarget
+		{
+			Array, ElementArray, Uniform, PixelPack, PixelUnpack,
+
+			Count
+		};
+
+		struct TextureBinding
+		{
+			GLenum target;
+			GLuint id;
+		};
+
+		enum class Toggle : unsigned char
+		{
+			Unknown, Disabled, Enabled
+		};
+
+	private:
+		/* Returns BufferTarget::Count for targets that are not cached. */
+		static BufferTarget ToBufferTarget( const GLenum target );
+
+	private:
+		FunctionTable functions;
+
+		GLuint program_current;
+		GLuint vertex_array_current;
+		GLenum texture_unit_active;
+		std::array< TextureBinding, MAX_TEXTURE_UNIT_COUNT > texture_binding_list;
+		std::array< GLuint, std::size_t( BufferTarget::Count ) > buffer_binding_list;
+		std::array< GLuint, MAX_UNIFORM_BUFFER_COUNT > uniform_buffer_binding_list;
+		Toggle depth_test;
+		GLenum polygon_mode;
+
+		Statistics statistics;
+	};
+}
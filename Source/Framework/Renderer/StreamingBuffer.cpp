@@ -0,0 +1,228 @@
+// Framework Includes.
+#include "Renderer/Graphics.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/StreamingBuffer.h"
+
+/* ARB_buffer_storage is not part of the GL 3.3 GLAD loader. */
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT	0x0040
+#define GL_MAP_COHERENT_BIT		0x0080
+#endif
+
+namespace Framework
+{
+	StreamingBuffer::StreamingBuffer( const GLenum target, const unsigned int frame_size, const Mode requested_mode )
+		:
+		id( 0 ),
+		generation( 0 ),
+		target( target ),
+		mode( requested_mode == Mode::PersistentMapped && IsGLBufferStorageAvailable() ? Mode::PersistentMapped : Mode::Orphaning ),
+		frame_size( frame_size ),
+		frame_index( 0 ),
+		frame_offset( 0 ),
+		mapped_data( nullptr ),
+		allocation_is_pending( false ),
+		fence_list{},
+		statistics{}
+	{
+		Create();
+	}
+
+	StreamingBuffer::~StreamingBuffer()
+	{
+		Destroy();
+	}
+
+	void StreamingBuffer::BeginFrame()
+	{
+		ASSERT_DEBUG_ONLY( !allocation_is_pending && "StreamingBuffer::BeginFrame(): Last allocation was not committed." );
+
+		frame_index  = ( frame_index + 1 ) % FRAME_COUNT;
+		frame_offset = 0;
+
+		GLsync& fence = fence_list[ frame_index ];
+		if( !fence )
+			return;
+
+		if( mode == Mode::PersistentMapped )
+		{
+			if( WaitForFence( fence ) )
+				statistics.stall_count++;
+		}
+		else if( !IsFenceSignaled( fence ) )
+		{
+			/* Fresh storage for the whole buffer; the other regions' fences guard storage that is no longer ours to write into anyway. */
+			Bind();
+			GLCALL( glBufferData( target, FRAME_COUNT * frame_size, nullptr, GL_STREAM_DRAW ) );
+			statistics.orphan_count++;
+
+			DeleteFences();
+			return;
+		}
+
+		GLCALL( glDeleteSync( fence ) );
+		fence = nullptr;
+	}
+
+	void StreamingBuffer::EndFrame()
+	{
+		ASSERT_DEBUG_ONLY( !allocation_is_pending && "StreamingBuffer::EndFrame(): Last allocation was not committed." );
+
+		GLsync& fence = fence_list[ frame_index ];
+		if( fence )
+			GLCALL( glDeleteSync( fence ) );
+
+		GLCALL( fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) );
+	}
+
+	StreamingBuffer::Allocation StreamingBuffer::Allocate( const unsigned int size, const unsigned int alignment )
+	{
+		ASSERT_DEBUG_ONLY( !allocation_is_pending && "StreamingBuffer::Allocate(): Last allocation was not committed." );
+
+		const unsigned int offset_in_frame = ( frame_offset + alignment - 1 ) / alignment * alignment;
+		if( offset_in_frame + size > frame_size )
+		{
+			statistics.overflow_count++;
+			return {};
+		}
+
+		frame_offset = offset_in_frame + size;
+
+		statistics.allocation_count++;
+		statistics.allocated_byte_count += size;
+
+		const unsigned int offset = frame_index * frame_size + offset_in_frame;
+
+		if( mode == Mode::PersistentMapped )
+			return { mapped_data + offset, offset, size };
+
+		/* The fences (or the orphaning in BeginFrame()) guarantee that the GPU is not reading this range anymore; no need for the driver to synchronize. */
+		void* data = nullptr;
+		Bind();
+		GLCALL( data = glMapBufferRange( target, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT ) );
+		allocation_is_pending = true;
+
+		return { data, offset, size };
+	}
+
+	void StreamingBuffer::Commit( const Allocation& allocation )
+	{
+		if( mode == Mode::PersistentMapped || !allocation.data ) // Coherent mapping; nothing to do.
+			return;
+
+		ASSERT_DEBUG_ONLY( allocation_is_pending );
+
+		Bind();
+		GLCALL( glUnmapBuffer( target ) );
+		allocation_is_pending = false;
+	}
+
+	void StreamingBuffer::Reserve( const unsigned int new_frame_size )
+	{
+		if( new_frame_size <= frame_size )
+			return;
+
+		ASSERT_DEBUG_ONLY( !allocation_is_pending && "StreamingBuffer::Reserve(): Last allocation was not committed." );
+
+		frame_size	 = new_frame_size;
+		frame_offset = 0;
+
+		/* GL keeps the old storage alive for the pending draws reading it; no need to wait. */
+		DeleteFences();
+
+		if( mode == Mode::Orphaning )
+		{
+			Bind();
+			GLCALL( glBufferData( target, FRAME_COUNT * frame_size, nullptr, GL_STREAM_DRAW ) );
+			return;
+		}
+
+		/* Immutable storage can not be re-specified; create a new buffer. It may get the name of the old one (or of any other deleted buffer) back later,
+		 * which is why it also gets a new Generation(). */
+		const GLuint id_old = id;
+
+		Bind();
+		GLCALL( glUnmapBuffer( target ) );
+
+		Create();
+
+		GLCALL( glDeleteBuffers( 1, &id_old ) );
+		StateCache::Instance().OnBufferDeleted( id_old );
+	}
+
+	void StreamingBuffer::Bind() const
+	{
+		StateCache::Instance().BindBuffer( target, id );
+	}
+
+	void StreamingBuffer::Create()
+	{
+		static unsigned int generation_last = 0;
+		generation = ++generation_last;
+
+		GLCALL( glGenBuffers( 1, &id ) );
+		Bind();
+
+		const unsigned int size = FRAME_COUNT * frame_size;
+
+		if( mode == Mode::PersistentMapped )
+		{
+			constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			GLBufferStorage( target, size, nullptr, flags );
+			GLCALL( mapped_data = static_cast< std::byte* >( glMapBufferRange( target, 0, size, flags ) ) );
+		}
+		else
+			GLCALL( glBufferData( target, size, nullptr, GL_STREAM_DRAW ) );
+	}
+
+	void StreamingBuffer::Destroy()
+	{
+		DeleteFences();
+
+		if( mapped_data )
+		{
+			Bind();
+			GLCALL( glUnmapBuffer( target ) );
+			mapped_data = nullptr;
+		}
+
+		GLCALL( glDeleteBuffers( 1, &id ) );
+		StateCache::Instance().OnBufferDeleted( id );
+	}
+
+	void StreamingBuffer::DeleteFences()
+	{
+		for( auto& fence : fence_list )
+		{
+			if( fence )
+				GLCALL( glDeleteSync( fence ) );
+
+			fence = nullptr;
+		}
+	}
+
+	bool StreamingBuffer::WaitForFence( const GLsync fence ) const
+	{
+		if( IsFenceSignaled( fence ) )
+			return false;
+
+		constexpr GLuint64 timeout_in_nanoseconds = 1'000'000;
+
+		GLenum result;
+		do
+		{
+			/* The flush makes sure the fence reaches the GPU at all; otherwise the wait could block forever. */
+			GLCALL( result = glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout_in_nanoseconds ) );
+		}
+		while( result == GL_TIMEOUT_EXPIRED );
+
+		return true;
+	}
+
+	bool StreamingBuffer::IsFenceSignaled( const GLsync fence ) const
+	{
+		GLenum result;
+		GLCALL( result = glClientWaitSync( fence, 0, 0 ) );
+		return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+// Vendor GLAD Includes (Has to be included before GLFW!).
+#include "Vendor/OpenGL/glad/glad.h"
+
+// std Includes.
+#include <array>
+#include <cstddef>
+
+namespace Framework
+{
+	/* A ring of FRAME_COUNT regions inside a single GL buffer, for data that is rewritten every frame (instance data, uniform block chunks, dynamic vertices).
+	 * Each frame sub-allocates from its own region via Allocate(). EndFrame() fences the region, so that it is only reused FRAME_COUNT frames later,
+	 * once the GPU is done reading it; the driver never has to synchronize (or copy) on our behalf.
+	 *	PersistentMapped: Immutable storage (glBufferStorage; GL 4.4 or ARB_buffer_storage), mapped once (coherent) for the lifetime of the buffer.
+	 *					  Reusing a region the GPU has not yet finished with waits on its fence; these waits are counted as stalls.
+	 *	Orphaning:		  GL 3.3 fallback. Each allocation is mapped unsynchronized & unmapped by Commit(). Instead of waiting on a region the GPU has not yet
+	 *					  finished with, the whole buffer is orphaned: the driver hands out fresh storage while the pending draws keep reading the old one. */
+	class StreamingBuffer
+	{
+	public:
+		static constexpr unsigned int FRAME_COUNT = 3;
+
+		enum class Mode
+		{
+			Orphaning, PersistentMapped
+		};
+
+		struct Allocation
+		{
+			void* data;
+			/* From the start of the buffer, i.e., what glVertexAttribPointer(), glBindBufferRange() etc. expect. */
+			unsigned int offset;
+			unsigned int size;
+		};
+
+		struct Statistics
+		{
+			std::size_t allocation_count;
+			std::size_t allocated_byte_count;
+			/* Waits on a fence that was not signaled yet (PersistentMapped). */
+			std::size_t stall_count;
+			/* Orphans done instead of waiting (Orphaning). */
+			std::size_t orphan_count;
+			/* Allocations that did not fit into what was left of the current region. */
+			std::size_t overflow_count;
+		};
+
+	public:
+		/* Falls back to Orphaning when PersistentMapped is requested but glBufferStorage is not available. */
+		StreamingBuffer( const GLenum target, const unsigned int frame_size, const Mode requested_mode = Mode::PersistentMapped );
+		~StreamingBuffer();
+
+		StreamingBuffer( const StreamingBuffer& )				= delete;
+		StreamingBuffer& operator= ( const StreamingBuffer& )	= delete;
+
+		/* Moves on to the next region; waits for (or orphans) it if the GPU may still be reading it. */
+		void BeginFrame();
+		/* Fences the current region. To be called after the last draw call reading from it has been issued. */
+		void EndFrame();
+
+		/* Returns an Allocation with data == nullptr if the size does not fit into what is left of the current region (see Reserve()).
+		 * Use GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT as the alignment for uniform block chunks. */
+		Allocation Allocate( const unsigned int size, const unsigned int alignment = 16 );
+		/* Makes the written data visible to GL; has to be called before issuing draw calls that read it. Only one allocation can be pending at a time. */
+		void Commit( const Allocation& allocation );
+
+		/* Grows each region to at least frame_size (new storage; earlier allocations & their contents are gone afterwards). */
+		void Reserve( const unsigned int frame_size );
+
+		void Bind() const;
+
+		inline GLuint ID() const { return id; }
+		/* Process-wide unique per GL buffer created (see Reserve()). GL may hand out the name of a deleted buffer again, so caches of attachments
+		 * (e.g., VertexArray::AttachInstanceBuffer()) compare this along with the ID(). */
+		inline unsigned int Generation() const { return generation; }
+		inline Mode GetMode() const { return mode; }
+		inline unsigned int FrameSize() const { return frame_size; }
+
+		inline const Statistics& GetStatistics() const { return statistics; }
+		inline void ResetStatistics() { statistics = {}; }
+
+	private:
+		void Create();
+		void Destroy();
+
+		void DeleteFences();
+		/* Returns whether the GPU was still busy, i.e., whether the wait actually blocked. */
+		bool WaitForFence( const GLsync fence ) const;
+		bool IsFenceSignaled( const GLsync fence ) const;
+
+	private:
+		GLuint id;
+		unsigned int generation;
+		GLenum target;
+		Mode mode;
+		unsigned int frame_size;
+		unsigned int frame_index;
+		/* Bytes used in the current region. */
+		unsigned int frame_offset;
+
+		std::byte* mapped_data; // Whole buffer; PersistentMapped only.
+		bool allocation_is_pending;
+
+		std::array< GLsync, FRAME_COUNT > fence_list;
+
+		Statistics statistics;
+	};
+}
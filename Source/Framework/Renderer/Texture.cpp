@@ -1,5 +1,8 @@
 // Framework Includes.
+#include "Renderer/StateCache.h"
 #include "Renderer/Texture.h"
+#include "Renderer/TextureCompression.h"
+#include "Renderer/TextureFile.h"
 
 // Vendor Includes.
 #include "Vendor/stb/stb_image.h"
@@ -8,7 +11,8 @@ namespace Framework
 {
 	Texture::Texture( const char* file_path, GLenum color_format )
 		:
-		id( 0 )
+		id( 0 ),
+		is_loaded( false )
 	{
 		stbi_set_flip_vertically_on_load( 1 );
 
@@ -17,16 +21,12 @@ namespace Framework
 		{
 			GLCALL( glGenTextures( 1, &id ) );
 			Bind();
-
-			GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER ) );
-			GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER ) );
-			GLCALL( glTexParameterfv( GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, DefaultBorderColor().Data() ) );
-
-			GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR ) );
-			GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR ) );
+			SetParameters();
 
 			GLCALL( glTexImage2D( GL_TEXTURE_2D, 0, color_format, width, height, 0, color_format, GL_UNSIGNED_BYTE, local_buffer ) );
 			GLCALL( glGenerateMipmap( GL_TEXTURE_2D ) );
+
+			is_loaded = true;
 		}
 		else
 			std::cerr << "ERROR::TEXTURE::COULD_NOT_READ_FROM_FILE!\n";
@@ -34,24 +34,89 @@ namespace Framework
 		stbi_image_free( local_buffer );
 	}
 
+	Texture::Texture( const TextureFile& texture_file )
+		:
+		id( 0 ),
+		width( texture_file.Width() ),
+		height( texture_file.Height() ),
+		channels_in_file( texture_file.BaseInternalFormat() == GL_RG ? 2 : texture_file.BaseInternalFormat() == GL_RGB ? 3 : 4 ),
+		is_loaded( false )
+	{
+		if( !texture_file.IsValid() )
+			return;
+
+		/* Valid files are of a known format. */
+		const auto format = *TextureCompression::FormatOf( texture_file.InternalFormat() );
+		if( !TextureCompression::IsSupported( format ) )
+		{
+			std::cerr << "ERROR::TEXTURE::COMPRESSED_FORMAT_NOT_SUPPORTED: " << TextureCompression::NameOf( format ) << "\n";
+			return;
+		}
+
+		GLCALL( glGenTextures( 1, &id ) );
+		Bind();
+		SetParameters();
+
+		/* Levels missing from the file are never sampled. */
+		GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture_file.LevelCount() - 1 ) );
+
+		for( int level = 0; level < texture_file.LevelCount(); level++ )
+			GLCALL( glCompressedTexImage2D( GL_TEXTURE_2D, level, texture_file.InternalFormat(), texture_file.LevelWidth( level ), texture_file.LevelHeight( level ), 0,
+											GLsizei( texture_file.LevelSize( level ) ), texture_file.LevelData( level ) ) );
+
+		is_loaded = true;
+	}
+
+	Texture::Texture( const unsigned int placeholder_id )
+		:
+		id( placeholder_id ),
+		width( 1 ),
+		height( 1 ),
+		channels_in_file( 0 ),
+		is_loaded( false )
+	{
+	}
+
 	Texture::~Texture()
 	{
+		if( !is_loaded ) // The placeholder (if any) belongs to the loader.
+			return;
+
 		GLCALL( glDeleteTextures( 1, &id ) );
+		StateCache::Instance().OnTextureDeleted( id );
+	}
+
+	void Texture::OnLoaded( const unsigned int texture_id, const int width, const int height, const int channels_in_file )
+	{
+		id						= texture_id;
+		this->width				= width;
+		this->height			= height;
+		this->channels_in_file	= channels_in_file;
+		is_loaded				= true;
+	}
+
+	void Texture::SetParameters()
+	{
+		GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER ) );
+		GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER ) );
+		GLCALL( glTexParameterfv( GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, DefaultBorderColor().Data() ) );
+
+		GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR ) );
+		GLCALL( glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR ) );
 	}
 
 	void Texture::Bind() const
 	{
-		GLCALL( glBindTexture( GL_TEXTURE_2D, id ) );
+		StateCache::Instance().BindTexture( GL_TEXTURE_2D, id );
 	}
 
 	void Texture::Unbind() const
 	{
-		GLCALL( glBindTexture( GL_TEXTURE_2D, 0 ) );
+		StateCache::Instance().BindTexture( GL_TEXTURE_2D, 0 );
 	}
 
 	void Texture::ActivateAndBind( GLenum texture_unit ) const
 	{
-		GLCALL( glActiveTexture( texture_unit ) );
-		Bind();
+		StateCache::Instance().BindTexture( texture_unit, GL_TEXTURE_2D, id );
 	}
 }
@@ -7,27 +7,51 @@
 
 namespace Framework
 {
+	class TextureFile;
+
 	class Texture
 	{
+		friend class AsyncTextureLoader;
+
 	public:
+		/* Decodes & uploads synchronously; see AsyncTextureLoader for loading without blocking the render thread. */
 		Texture( const char* file_path, GLenum color_format );
+		/* Uploads the file's compressed levels as they are (no mipmaps are generated). Not loaded if the file is invalid or the context does not support its format. */
+		explicit Texture( const TextureFile& texture_file );
 		~Texture();
 
+		Texture( const Texture& )				= delete;
+		Texture& operator= ( const Texture& )	= delete;
+
 		void Bind() const;
 		void Unbind() const;
 		void ActivateAndBind( GLenum texture_unit ) const;
 
+		inline unsigned int ID() const { return id; }
 		inline int Width() const { return width; }
 		inline int Height() const { return height; }
 		inline int ChannelsInFile() const { return channels_in_file; }
+		/* False while an AsyncTextureLoader is still loading it (ID() is the loader's placeholder then) & if loading failed. */
+		inline bool IsLoaded() const { return is_loaded; }
 
 	public:
 		static constexpr Color4 DefaultBorderColor() { return Color4{ 1.0f, 1.0f, 0.0f, 1.0f }; }
 
+	private:
+		/* For AsyncTextureLoader: Shows the given placeholder texture (not owned) until OnLoaded() hands over the actual one. */
+		explicit Texture( const unsigned int placeholder_id );
+
+		/* Takes ownership of texture_id. */
+		void OnLoaded( const unsigned int texture_id, const int width, const int height, const int channels_in_file );
+
+		/* Wrapping, border color & filtering of the currently bound texture. */
+		static void SetParameters();
+
 	private:
 		unsigned int id;
 		int width;
 		int height;
 		int channels_in_file;
+		bool is_loaded;
 	};
 }
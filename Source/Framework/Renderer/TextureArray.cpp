@@ -0,0 +1,100 @@
+// Framework Includes.
+#include "Renderer/StateCache.h"
+#include "Renderer/TextureArray.h"
+
+// std Includes.
+#include <algorithm>
+#include <iostream>
+
+namespace Framework
+{
+	TextureArray::TextureArray( const int width, const int height, const int layer_count, const GLenum color_format )
+		:
+		id( 0 ),
+		width( width ),
+		height( height ),
+		layer_count( layer_count ),
+		color_format( color_format )
+	{
+		if( width <= 0 || height <= 0 || layer_count <= 0 || width > MaxSize() || height > MaxSize() || layer_count > MaxLayerCount() )
+		{
+			std::cerr << "ERROR::TEXTURE_ARRAY::UNSUPPORTED_SIZE_OR_LAYER_COUNT: " << width << "x" << height << "x" << layer_count << "\n";
+			return;
+		}
+
+		GLCALL( glGenTextures( 1, &id ) );
+		Bind();
+
+		GLCALL( glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE ) );
+		GLCALL( glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE ) );
+		GLCALL( glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR ) );
+		GLCALL( glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR ) );
+
+		/* Storage only; no pixel unpack buffer may be bound here, as the null pointer would be taken as an offset into it. */
+		StateCache::Instance().BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+		for( int level = 0, level_width = width, level_height = height; ; level++, level_width = std::max( level_width / 2, 1 ), level_height = std::max( level_height / 2, 1 ) )
+		{
+			GLCALL( glTexImage3D( GL_TEXTURE_2D_ARRAY, level, color_format, level_width, level_height, layer_count, 0, color_format, GL_UNSIGNED_BYTE, nullptr ) );
+
+			if( level_width == 1 && level_height == 1 )
+				break;
+		}
+	}
+
+	TextureArray::~TextureArray()
+	{
+		if( id == 0 )
+			return;
+
+		GLCALL( glDeleteTextures( 1, &id ) );
+		StateCache::Instance().OnTextureDeleted( id );
+	}
+
+	void TextureArray::Upload( const int layer, const int x, const int y, const int width, const int height, const unsigned char* pixels )
+	{
+		ASSERT_DEBUG_ONLY( layer >= 0 && layer < layer_count && x >= 0 && y >= 0 && x + width <= this->width && y + height <= this->height );
+
+		Bind();
+		StateCache::Instance().BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+		/* Rows are tightly packed. */
+		GLCALL( glPixelStorei( GL_UNPACK_ALIGNMENT, 1 ) );
+		GLCALL( glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, x, y, layer, width, height, 1, color_format, GL_UNSIGNED_BYTE, pixels ) );
+		GLCALL( glPixelStorei( GL_UNPACK_ALIGNMENT, 4 ) );
+	}
+
+	void TextureArray::GenerateMipmaps()
+	{
+		Bind();
+		GLCALL( glGenerateMipmap( GL_TEXTURE_2D_ARRAY ) );
+	}
+
+	void TextureArray::Bind() const
+	{
+		StateCache::Instance().BindTexture( GL_TEXTURE_2D_ARRAY, id );
+	}
+
+	void TextureArray::Unbind() const
+	{
+		StateCache::Instance().BindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+	}
+
+	void TextureArray::ActivateAndBind( GLenum texture_unit ) const
+	{
+		StateCache::Instance().BindTexture( texture_unit, GL_TEXTURE_2D_ARRAY, id );
+	}
+
+	int TextureArray::MaxLayerCount()
+	{
+		GLint max_layer_count = 0;
+		GLCALL( glGetIntegerv( GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layer_count ) );
+		return max_layer_count;
+	}
+
+	int TextureArray::MaxSize()
+	{
+		GLint max_size = 0;
+		GLCALL( glGetIntegerv( GL_MAX_TEXTURE_SIZE, &max_size ) );
+		return max_size;
+	}
+}
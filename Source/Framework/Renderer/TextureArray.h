@@ -0,0 +1,49 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/Graphics.h"
+
+namespace Framework
+{
+	/* 2D array texture (GL_TEXTURE_2D_ARRAY): layers of the same size & format, sampled through a single binding (sampler2DArray, with the layer as the third
+	 * texture coordinate). Draws sampling different layers need no rebinding in between. Filtered like Texture, but clamped to the edge rather than to
+	 * a border color, as layers usually hold several images (see TextureAtlas). */
+	class TextureArray
+	{
+	public:
+		/* Allocates all layers (& their full mipmap chains), with undefined contents; fill them with Upload(). Not loaded if the size or layer count exceeds
+		 * what the context supports. color_format: GL_RED, GL_RG, GL_RGB or GL_RGBA. */
+		TextureArray( const int width, const int height, const int layer_count, const GLenum color_format );
+		~TextureArray();
+
+		TextureArray( const TextureArray& )				= delete;
+		TextureArray& operator= ( const TextureArray& )	= delete;
+
+		/* A region of level 0 of a layer. pixels: Tightly packed rows of the array's color format, bottom row first (as Texture uploads images). */
+		void Upload( const int layer, const int x, const int y, const int width, const int height, const unsigned char* pixels );
+		/* From level 0, for all layers; after uploading. */
+		void GenerateMipmaps();
+
+		void Bind() const;
+		void Unbind() const;
+		void ActivateAndBind( GLenum texture_unit ) const;
+
+		inline unsigned int ID() const { return id; }
+		inline int Width() const { return width; }
+		inline int Height() const { return height; }
+		inline int LayerCount() const { return layer_count; }
+		inline GLenum ColorFormat() const { return color_format; }
+		inline bool IsLoaded() const { return id != 0; }
+
+		/* GL_MAX_ARRAY_TEXTURE_LAYERS & GL_MAX_TEXTURE_SIZE of the current context. */
+		static int MaxLayerCount();
+		static int MaxSize();
+
+	private:
+		unsigned int id;
+		int width;
+		int height;
+		int layer_count;
+		GLenum color_format;
+	};
+}
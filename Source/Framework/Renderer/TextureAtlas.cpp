@@ -0,0 +1,145 @@
+// Framework Includes.
+#include "Renderer/TextureAtlas.h"
+
+// Vendor Includes.
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "Vendor/imgui/imstb_rectpack.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace Framework
+{
+	namespace
+	{
+		/* 0 for unsupported formats. */
+		int ChannelCountOf( const GLenum color_format )
+		{
+			switch( color_format )
+			{
+				case GL_RED:	return 1;
+				case GL_RG:		return 2;
+				case GL_RGB:	return 3;
+				case GL_RGBA:	return 4;
+				default:		return 0;
+			}
+		}
+	}
+
+	double TextureAtlas::Layout::Efficiency() const
+	{
+		if( layer_count == 0 )
+			return 0.0;
+
+		std::size_t used_texel_count = 0;
+		for( const auto& placement : placement_list )
+			used_texel_count += std::size_t( placement.width ) * placement.height;
+
+		return double( used_texel_count ) / ( double( layer_size ) * layer_size * layer_count );
+	}
+
+	TextureAtlas::TextureAtlas( const std::vector< Image >& image_list, const GLenum color_format, const int layer_size, const int padding )
+		:
+		layout( Pack( image_list, layer_size, padding ) )
+	{
+		if( !layout )
+		{
+			std::cerr << "ERROR::TEXTURE_ATLAS::IMAGE_LARGER_THAN_LAYER\n";
+			return;
+		}
+
+		const int channel_count = ChannelCountOf( color_format );
+		if( channel_count == 0 )
+		{
+			std::cerr << "ERROR::TEXTURE_ATLAS::UNSUPPORTED_COLOR_FORMAT: " << color_format << "\n";
+			return;
+		}
+
+		/* Packs to 0 layers; there is nothing to allocate. */
+		if( image_list.empty() )
+			return;
+
+		texture_array.emplace( layer_size, layer_size, layout->layer_count, color_format );
+		if( !texture_array->IsLoaded() )
+			return;
+
+		/* Each image is uploaded along with its padding, in one go. */
+		std::vector< unsigned char > padded_pixels;
+		for( std::size_t image_index = 0; image_index < image_list.size(); image_index++ )
+		{
+			const Image& image			= image_list[ image_index ];
+			const Placement& placement	= layout->placement_list[ image_index ];
+
+			const int padded_width = image.width + 2 * padding, padded_height = image.height + 2 * padding;
+			padded_pixels.resize( std::size_t( padded_width ) * padded_height * channel_count );
+
+			for( int y = 0; y < padded_height; y++ )
+			{
+				const unsigned char* source_row = image.pixels + std::size_t( std::clamp( y - padding, 0, image.height - 1 ) ) * image.width * channel_count;
+				unsigned char* destination_row	= padded_pixels.data() + std::size_t( y ) * padded_width * channel_count;
+
+				for( int x = 0; x < padding; x++ )
+				{
+					std::memcpy( destination_row + std::size_t( x ) * channel_count, source_row, channel_count );
+					std::memcpy( destination_row + std::size_t( padding + image.width + x ) * channel_count, source_row + std::size_t( image.width - 1 ) * channel_count, channel_count );
+				}
+
+				std::memcpy( destination_row + std::size_t( padding ) * channel_count, source_row, std::size_t( image.width ) * channel_count );
+			}
+
+			texture_array->Upload( placement.layer, placement.x - padding, placement.y - padding, padded_width, padded_height, padded_pixels.data() );
+		}
+
+		texture_array->GenerateMipmaps();
+	}
+
+	std::optional< TextureAtlas::Layout > TextureAtlas::Pack( const std::vector< Image >& image_list, const int layer_size, const int padding )
+	{
+		Layout layout{ layer_size, 0, std::vector< Placement >( image_list.size() ) };
+
+		std::vector< stbrp_rect > rect_list( image_list.size() );
+		for( std::size_t image_index = 0; image_index < image_list.size(); image_index++ )
+		{
+			const Image& image = image_list[ image_index ];
+			if( image.width <= 0 || image.height <= 0 || image.width + 2 * padding > layer_size || image.height + 2 * padding > layer_size )
+				return std::nullopt;
+
+			rect_list[ image_index ] = { int( image_index ), image.width + 2 * padding, image.height + 2 * padding, 0, 0, 0 };
+		}
+
+		/* One node per texel column; fewer would make the packer round widths up. */
+		std::vector< stbrp_node > node_list( layer_size );
+
+		while( !rect_list.empty() )
+		{
+			stbrp_context context;
+			stbrp_init_target( &context, layer_size, layer_size, node_list.data(), int( node_list.size() ) );
+			stbrp_pack_rects( &context, rect_list.data(), int( rect_list.size() ) );
+
+			for( const auto& rect : rect_list )
+				if( rect.was_packed )
+					layout.placement_list[ rect.id ] = { layout.layer_count, rect.x + padding, rect.y + padding, rect.w - 2 * padding, rect.h - 2 * padding };
+
+			std::erase_if( rect_list, []( const stbrp_rect& rect ) { return rect.was_packed != 0; } );
+			layout.layer_count++;
+		}
+
+		return layout;
+	}
+
+	TextureAtlas::Region TextureAtlas::GetRegion( const std::size_t image_index ) const
+	{
+		const Placement& placement = layout->placement_list[ image_index ];
+		const float layer_size	   = float( layout->layer_size );
+
+		return
+		{
+			Vector2( placement.x / layer_size, placement.y / layer_size ),
+			Vector2( ( placement.x + placement.width ) / layer_size, ( placement.y + placement.height ) / layer_size ),
+			placement.layer
+		};
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Vector.hpp"
+
+#include "Renderer/TextureArray.h"
+
+// std Includes.
+#include <optional>
+#include <vector>
+
+namespace Framework
+{
+	/* Packs many small images into the layers of a TextureArray, so that draws using different images share one texture binding: Region() gives an image's
+	 * layer & UV rectangle, to remap the mesh's [0, 1] UVs into (uv_min + uv * ( uv_max - uv_min ), layer). Layers are filled one after the other with the
+	 * skyline packer of the vendored imstb_rectpack (bottom-left, tallest images first); each pass packs what still fits into a fresh layer.
+	 * Images are surrounded by padding texels repeating their edges, so that filtering does not bleed neighbors in (down to the level where the padding
+	 * shrinks below a texel, i.e., log2( padding ) + 1 levels). */
+	class TextureAtlas
+	{
+	public:
+		/* Supported by any GL 3.3 context. */
+		static constexpr int DEFAULT_LAYER_SIZE = 1024;
+		static constexpr int DEFAULT_PADDING	= 2;
+
+		/* Tightly packed rows of the atlas' color format, bottom row first (as Texture uploads images). Not owned; read during construction only. */
+		struct Image
+		{
+			int width;
+			int height;
+			const unsigned char* pixels;
+		};
+
+		/* In texels of the layer, padding excluded. */
+		struct Placement
+		{
+			int layer;
+			int x;
+			int y;
+			int width;
+			int height;
+		};
+
+		struct Region
+		{
+			Vector2 uv_min;
+			Vector2 uv_max;
+			int layer;
+		};
+
+		struct Layout
+		{
+			int layer_size;
+			int layer_count;
+			/* In the order of the images. */
+			std::vector< Placement > placement_list;
+
+			/* Fraction of all layers' texels covered by images (padding excluded). */
+			double Efficiency() const;
+		};
+
+	public:
+		/* Uploads the images into a new TextureArray & generates its mipmaps. Not loaded if an image (with its padding) is larger than a layer, color_format
+		 * is not one of GL_RED, GL_RG, GL_RGB or GL_RGBA or the layers needed exceed what the context supports; no TextureArray is created in the first
+		 * two cases. An empty image_list gives an empty atlas: nothing is created either & it is not loaded, as there is nothing to sample. */
+		TextureAtlas( const std::vector< Image >& image_list, const GLenum color_format, const int layer_size = DEFAULT_LAYER_SIZE, const int padding = DEFAULT_PADDING );
+
+		TextureAtlas( const TextureAtlas& )				= delete;
+		TextureAtlas& operator= ( const TextureAtlas& )	= delete;
+
+		/* CPU only; the images' pixels are not read. Returns nullopt if an image (with its padding) is larger than a layer. */
+		static std::optional< Layout > Pack( const std::vector< Image >& image_list, const int layer_size = DEFAULT_LAYER_SIZE, const int padding = DEFAULT_PADDING );
+
+		inline bool IsLoaded() const { return texture_array.has_value() && texture_array->IsLoaded(); }
+
+		inline std::size_t ImageCount() const { return layout ? layout->placement_list.size() : 0; }
+		Region GetRegion( const std::size_t image_index ) const;
+
+		/* nullptr if no TextureArray was created (see the constructor). */
+		inline const TextureArray* GetTextureArray() const { return texture_array ? &*texture_array : nullptr; }
+		inline const std::optional< Layout >& GetLayout() const { return layout; }
+
+	private:
+		std::optional< Layout > layout;
+		std::optional< TextureArray > texture_array;
+	};
+}
@@ -0,0 +1,134 @@
+// Framework Includes.
+#include "Renderer/TextureCache.h"
+
+// Vendor Includes.
+#include "Vendor/stb/stb_image.h"
+
+// std Includes.
+#include <filesystem>
+
+namespace Framework
+{
+	void TextureCache::PixelDeleter::operator()( unsigned char* pixels ) const
+	{
+		stbi_image_free( pixels );
+	}
+
+	std::size_t TextureCache::Image::ByteCount() const
+	{
+		std::size_t byte_count = std::size_t( width ) * height * channel_count;
+		for( const auto& mip_level : mip_level_list )
+			byte_count += mip_level.pixels.size();
+
+		return byte_count;
+	}
+
+	TextureCache::TextureCache( const std::size_t image_budget )
+		:
+		image_byte_count( 0 ),
+		image_budget( image_budget ),
+		statistics{}
+	{
+	}
+
+	TextureCache& TextureCache::Instance()
+	{
+		static TextureCache texture_cache;
+		return texture_cache;
+	}
+
+	std::string TextureCache::KeyOf( const std::string& file_path, const GLenum color_format, const std::optional< MipmapGenerator::Settings >& mipmap_settings )
+	{
+		/* So that e.g. "Asset/Texture/../Texture/x.png" & "Asset\Texture\x.png" share an entry. */
+		std::string key = std::filesystem::path( file_path ).lexically_normal().generic_string() + '|' + std::to_string( color_format );
+
+		if( mipmap_settings )
+			key += "|mips:" + std::to_string( int( mipmap_settings->filter ) ) + ',' + std::to_string( mipmap_settings->is_srgb ) + ',' +
+				   ( mipmap_settings->preserve_alpha_coverage ? std::to_string( mipmap_settings->alpha_reference ) : std::string( "-" ) );
+
+		return key;
+	}
+
+	std::shared_ptr< Texture > TextureCache::FindTexture( const std::string& key )
+	{
+		const auto iterator = texture_map.find( key );
+		if( iterator == texture_map.cend() )
+			return nullptr;
+
+		auto texture = iterator->second.lock();
+		if( !texture )
+		{
+			texture_map.erase( iterator );
+			return nullptr;
+		}
+
+		statistics.texture_hit_count++;
+		return texture;
+	}
+
+	std::shared_ptr< const TextureCache::Image > TextureCache::FindImage( const std::string& key )
+	{
+		const auto iterator = image_map.find( key );
+		if( iterator == image_map.cend() )
+			return nullptr;
+
+		lru_list.splice( lru_list.begin(), lru_list, iterator->second.lru_position );
+
+		statistics.image_hit_count++;
+		return iterator->second.image;
+	}
+
+	void TextureCache::AddTexture( const std::string& key, const std::shared_ptr< Texture >& texture )
+	{
+		texture_map[ key ] = texture;
+	}
+
+	void TextureCache::AddImage( const std::string& key, const std::shared_ptr< const Image >& image )
+	{
+		const std::size_t byte_count = image->ByteCount();
+		if( byte_count > image_budget )
+			return;
+
+		if( const auto iterator = image_map.find( key ); iterator != image_map.end() )
+		{
+			image_byte_count -= iterator->second.image->ByteCount();
+			iterator->second.image = image;
+			lru_list.splice( lru_list.begin(), lru_list, iterator->second.lru_position );
+		}
+		else
+		{
+			lru_list.push_front( key );
+			image_map.emplace( key, ImageEntry{ image, lru_list.begin() } );
+		}
+
+		image_byte_count += byte_count;
+		EvictToBudget();
+	}
+
+	void TextureCache::Clear()
+	{
+		texture_map.clear();
+		image_map.clear();
+		lru_list.clear();
+		image_byte_count = 0;
+	}
+
+	void TextureCache::SetImageBudget( const std::size_t new_image_budget )
+	{
+		image_budget = new_image_budget;
+		EvictToBudget();
+	}
+
+	void TextureCache::EvictToBudget()
+	{
+		while( image_byte_count > image_budget )
+		{
+			const auto iterator = image_map.find( lru_list.back() );
+			image_byte_count -= iterator->second.image->ByteCount();
+			image_map.erase( iterator );
+			lru_list.pop_back();
+
+			statistics.eviction_count++;
+		}
+	}
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/MipmapGenerator.h"
+#include "Renderer/Texture.h"
+
+// std Includes.
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+	/* Deduplicates textures loaded through AsyncTextureLoader, keyed by the normalized file path, the color format & the CPU mipmap settings:
+	 *	Textures: As long as any owner holds on to a texture, loading the same key again returns that texture (the shared_ptr is the reference count).
+	 *	Images:	  Decoded pixels are kept in an LRU within a byte budget, so that a texture released & loaded again (e.g., when re-entering a test) is only
+	 *			  re-uploaded, not re-decoded.
+	 * Not thread-safe; used on the render thread only (the loader decodes on workers but hands the images over in AsyncTextureLoader::Update()). */
+	class TextureCache
+	{
+	public:
+		static constexpr std::size_t DEFAULT_IMAGE_BUDGET = 256 * 1024 * 1024;
+
+		struct PixelDeleter
+		{
+			void operator()( unsigned char* pixels ) const;
+		};
+
+		/* Rows are tightly packed, bottom row first (i.e., flipped for GL, as Texture does). */
+		struct Image
+		{
+			std::unique_ptr< unsigned char, PixelDeleter > pixels;
+			int width;
+			int height;
+			int channels_in_file;
+			int channel_count;
+			/* Levels 1 & up, if generated on the CPU (see AsyncTextureLoader::Load()); empty otherwise. */
+			std::vector< MipmapGenerator::Level > mip_level_list;
+
+			/* Including the mip levels. */
+			std::size_t ByteCount() const;
+
+			inline int LevelCount() const { return 1 + int( mip_level_list.size() ); }
+			inline int LevelWidth( const int level ) const { return level == 0 ? width : mip_level_list[ level - 1 ].width; }
+			inline int LevelHeight( const int level ) const { return level == 0 ? height : mip_level_list[ level - 1 ].height; }
+			inline const unsigned char* LevelPixels( const int level ) const { return level == 0 ? pixels.get() : mip_level_list[ level - 1 ].pixels.data(); }
+		};
+
+		struct Statistics
+		{
+			/* Loads answered with a texture that was still alive. */
+			std::size_t texture_hit_count;
+			/* Loads answered with cached pixels; upload only. */
+			std::size_t image_hit_count;
+			/* Loads that had to decode. */
+			std::size_t miss_count;
+			std::size_t eviction_count;
+		};
+
+	public:
+		explicit TextureCache( const std::size_t image_budget = DEFAULT_IMAGE_BUDGET );
+
+		TextureCache( const TextureCache& )				= delete;
+		TextureCache& operator= ( const TextureCache& )	= delete;
+
+		/* Shared cache, used by AsyncTextureLoader unless told otherwise. Outlives all tests, so switching between them does not re-decode. */
+		static TextureCache& Instance();
+
+		/* mipmap_settings: Of mipmaps generated on the CPU; images with & without (or with different settings) are cached separately. */
+		static std::string KeyOf( const std::string& file_path, const GLenum color_format,
+								  const std::optional< MipmapGenerator::Settings >& mipmap_settings = std::nullopt );
+
+		/* Count as hits; nullptr if there is nothing cached for the key (not counted; see CountMiss()). Finding an image makes it the most recently used. */
+		std::shared_ptr< Texture > FindTexture( const std::string& key );
+		std::shared_ptr< const Image > FindImage( const std::string& key );
+
+		void AddTexture( const std::string& key, const std::shared_ptr< Texture >& texture );
+		/* Evicts the least recently used images until the budget is met again. Images larger than the whole budget are not cached. */
+		void AddImage( const std::string& key, const std::shared_ptr< const Image >& image );
+
+		inline void CountMiss() { statistics.miss_count++; }
+
+		/* Forgets all images (textures stay alive as long as their owners hold them, but are not returned for their keys anymore). */
+		void Clear();
+
+		inline std::size_t ImageByteCount() const { return image_byte_count; }
+		inline std::size_t ImageCount() const { return image_map.size(); }
+		inline std::size_t ImageBudget() const { return image_budget; }
+		void SetImageBudget( const std::size_t new_image_budget );
+
+		inline const Statistics& GetStatistics() const { return statistics; }
+		inline void ResetStatistics() { statistics = {}; }
+
+	private:
+		struct ImageEntry
+		{
+			std::shared_ptr< const Image > image;
+			std::list< std::string >::iterator lru_position;
+		};
+
+		void EvictToBudget();
+
+	private:
+		std::unordered_map< std::string, std::weak_ptr< Texture > > texture_map;
+
+		std::unordered_map< std::string, ImageEntry > image_map;
+		/* Most recently used first. */
+		std::list< std::string > lru_list;
+		std::size_t image_byte_count;
+		std::size_t image_budget;
+
+		Statistics statistics;
+	};
+}
@@ -0,0 +1,950 @@
+// Framework Includes.
+#include "Renderer/TextureCompression.h"
+
+// std Includes.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace Framework::TextureCompression
+{
+	namespace
+	{
+		constexpr int BLOCK_TEXEL_COUNT = 16;
+
+		/* Texel i is at ( i % 4, i / 4 ). */
+		struct Block
+		{
+			float texels[ BLOCK_TEXEL_COUNT ][ 4 ];
+		};
+
+		using DecodedBlock = unsigned char[ BLOCK_TEXEL_COUNT ][ 4 ];
+
+		Block LoadBlock( const unsigned char* rgba, const int width, const int height, const int block_x, const int block_y )
+		{
+			Block block;
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+			{
+				const int x = std::min( block_x * 4 + i % 4, width  - 1 );
+				const int y = std::min( block_y * 4 + i / 4, height - 1 );
+
+				const unsigned char* texel = rgba + ( std::size_t( y ) * width + x ) * 4;
+				for( int channel = 0; channel < 4; channel++ )
+					block.texels[ i ][ channel ] = texel[ channel ];
+			}
+
+			return block;
+		}
+
+		/* [0, 255] -> [0, max]. */
+		int Quantize( const float value, const int max )
+		{
+			return int( std::lround( std::clamp( value, 0.0f, 255.0f ) * max / 255.0f ) );
+		}
+
+		void WriteLittleEndian( std::byte* output, const std::uint64_t value, const int byte_count )
+		{
+			for( int i = 0; i < byte_count; i++ )
+				output[ i ] = std::byte( ( value >> ( 8 * i ) ) & 0xFF );
+		}
+
+		std::uint64_t ReadLittleEndian( const std::byte* input, const int byte_count )
+		{
+			std::uint64_t value = 0;
+			for( int i = 0; i < byte_count; i++ )
+				value |= std::uint64_t( input[ i ] ) << ( 8 * i );
+
+			return value;
+		}
+
+		/* BC7 blocks are one 128-bit little-endian number, with fields packed from the least significant bit up. */
+		class BitWriter
+		{
+		public:
+			void Write( const std::uint32_t value, const int bit_count )
+			{
+				for( int i = 0; i < bit_count; i++, position++ )
+					if( ( value >> i ) & 1 )
+						word_list[ position / 64 ] |= std::uint64_t( 1 ) << ( position % 64 );
+			}
+
+			void Store( std::byte* output ) const
+			{
+				WriteLittleEndian( output,	   word_list[ 0 ], 8 );
+				WriteLittleEndian( output + 8, word_list[ 1 ], 8 );
+			}
+
+		private:
+			std::uint64_t word_list[ 2 ] = {};
+			int position = 0;
+		};
+
+		class BitReader
+		{
+		public:
+			explicit BitReader( const std::byte* input )
+				:
+				word_list{ ReadLittleEndian( input, 8 ), ReadLittleEndian( input + 8, 8 ) }
+			{
+			}
+
+			std::uint32_t Read( const int bit_count )
+			{
+				std::uint32_t value = 0;
+				for( int i = 0; i < bit_count; i++, position++ )
+					value |= std::uint32_t( ( word_list[ position / 64 ] >> ( position % 64 ) ) & 1 ) << i;
+
+				return value;
+			}
+
+		private:
+			std::uint64_t word_list[ 2 ];
+			int position = 0;
+		};
+
+	/* Endpoint fitting, shared by BC1 & BC7: */
+
+		/* The line through the block's texels (first ChannelCount channels) along their principal axis (power iteration on the covariance),
+		 * clipped to the texels' extent along it. Flat blocks yield start == end. */
+		template< int ChannelCount >
+		void FitLine( const Block& block, float ( &start )[ 4 ], float ( &end )[ 4 ] )
+		{
+			float mean[ ChannelCount ] = {};
+			for( const auto& texel : block.texels )
+				for( int channel = 0; channel < ChannelCount; channel++ )
+					mean[ channel ] += texel[ channel ] / BLOCK_TEXEL_COUNT;
+
+			float covariance[ ChannelCount ][ ChannelCount ] = {};
+			for( const auto& texel : block.texels )
+				for( int row = 0; row < ChannelCount; row++ )
+					for( int column = 0; column < ChannelCount; column++ )
+						covariance[ row ][ column ] += ( texel[ row ] - mean[ row ] ) * ( texel[ column ] - mean[ column ] );
+
+			/* Starting from the row of the largest variance, which can not be orthogonal to the principal axis. */
+			int largest_variance_row = 0;
+			for( int row = 1; row < ChannelCount; row++ )
+				if( covariance[ row ][ row ] > covariance[ largest_variance_row ][ largest_variance_row ] )
+					largest_variance_row = row;
+
+			float axis[ ChannelCount ];
+			for( int channel = 0; channel < ChannelCount; channel++ )
+				axis[ channel ] = covariance[ largest_variance_row ][ channel ];
+
+			for( int iteration = 0; iteration < 8; iteration++ )
+			{
+				float next_axis[ ChannelCount ] = {};
+				float largest_component = 0.0f;
+				for( int row = 0; row < ChannelCount; row++ )
+				{
+					for( int column = 0; column < ChannelCount; column++ )
+						next_axis[ row ] += covariance[ row ][ column ] * axis[ column ];
+
+					largest_component = std::max( largest_component, std::abs( next_axis[ row ] ) );
+				}
+
+				if( largest_component == 0.0f )
+					break;
+
+				for( int channel = 0; channel < ChannelCount; channel++ )
+					axis[ channel ] = next_axis[ channel ] / largest_component;
+			}
+
+			float length_squared = 0.0f;
+			for( int channel = 0; channel < ChannelCount; channel++ )
+				length_squared += axis[ channel ] * axis[ channel ];
+
+			float projection_min = 0.0f, projection_max = 0.0f;
+			if( length_squared > 0.0f )
+			{
+				projection_min = std::numeric_limits< float >::max(), projection_max = std::numeric_limits< float >::lowest();
+				for( const auto& texel : block.texels )
+				{
+					float projection = 0.0f;
+					for( int channel = 0; channel < ChannelCount; channel++ )
+						projection += ( texel[ channel ] - mean[ channel ] ) * axis[ channel ];
+
+					projection_min = std::min( projection_min, projection / length_squared );
+					projection_max = std::max( projection_max, projection / length_squared );
+				}
+			}
+
+			for( int channel = 0; channel < ChannelCount; channel++ )
+			{
+				start[ channel ] = std::clamp( mean[ channel ] + axis[ channel ] * projection_min, 0.0f, 255.0f );
+				end[ channel ]	 = std::clamp( mean[ channel ] + axis[ channel ] * projection_max, 0.0f, 255.0f );
+			}
+		}
+
+		/* Least squares endpoints for the given per-texel weights of the end point (0 = start, 1 = end). False if the weights do not determine them
+		 * (e.g., all texels use the same weight). */
+		template< int ChannelCount >
+		bool FitEndpoints( const Block& block, const float ( &weights )[ BLOCK_TEXEL_COUNT ], float ( &start )[ 4 ], float ( &end )[ 4 ] )
+		{
+			float start_start = 0.0f, start_end = 0.0f, end_end = 0.0f;
+			float start_texel[ ChannelCount ] = {}, end_texel[ ChannelCount ] = {};
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+			{
+				const float start_weight = 1.0f - weights[ i ], end_weight = weights[ i ];
+
+				start_start += start_weight * start_weight;
+				start_end	+= start_weight * end_weight;
+				end_end		+= end_weight	* end_weight;
+
+				for( int channel = 0; channel < ChannelCount; channel++ )
+				{
+					start_texel[ channel ] += start_weight * block.texels[ i ][ channel ];
+					end_texel[ channel ]   += end_weight   * block.texels[ i ][ channel ];
+				}
+			}
+
+			const float determinant = start_start * end_end - start_end * start_end;
+			if( std::abs( determinant ) < 1e-6f )
+				return false;
+
+			for( int channel = 0; channel < ChannelCount; channel++ )
+			{
+				start[ channel ] = std::clamp( ( start_texel[ channel ] * end_end	  - end_texel[ channel ]   * start_end ) / determinant, 0.0f, 255.0f );
+				end[ channel ]	 = std::clamp( ( end_texel[ channel ]	* start_start - start_texel[ channel ] * start_end ) / determinant, 0.0f, 255.0f );
+			}
+
+			return true;
+		}
+
+		/* Nearest palette entry per texel over the first ChannelCount channels; returns the summed squared error. */
+		template< int PaletteSize, int ChannelCount >
+		float SelectIndices( const Block& block, const int ( &palette )[ PaletteSize ][ 4 ], int ( &indices )[ BLOCK_TEXEL_COUNT ] )
+		{
+			float total_error = 0.0f;
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+			{
+				float best_error = std::numeric_limits< float >::max();
+				for( int entry = 0; entry < PaletteSize; entry++ )
+				{
+					float error = 0.0f;
+					for( int channel = 0; channel < ChannelCount; channel++ )
+					{
+						const float difference = block.texels[ i ][ channel ] - palette[ entry ][ channel ];
+						error += difference * difference;
+					}
+
+					if( error < best_error )
+					{
+						best_error	 = error;
+						indices[ i ] = entry;
+					}
+				}
+
+				total_error += best_error;
+			}
+
+			return total_error;
+		}
+
+	/* BC1 (also the color half of BC3): */
+
+		std::uint16_t Pack565( const float ( &color )[ 4 ] )
+		{
+			return std::uint16_t( ( Quantize( color[ 0 ], 31 ) << 11 ) | ( Quantize( color[ 1 ], 63 ) << 5 ) | Quantize( color[ 2 ], 31 ) );
+		}
+
+		void Unpack565( const std::uint16_t value, int ( &color )[ 4 ] )
+		{
+			const int red = ( value >> 11 ) & 31, green = ( value >> 5 ) & 63, blue = value & 31;
+
+			color[ 0 ] = ( red	 << 3 ) | ( red	  >> 2 );
+			color[ 1 ] = ( green << 2 ) | ( green >> 4 );
+			color[ 2 ] = ( blue	 << 3 ) | ( blue  >> 2 );
+			color[ 3 ] = 255;
+		}
+
+		/* three_color_mode: BC1 blocks with color_0 <= color_1 (the 4th entry is transparent black then); BC3 always uses 4 colors. */
+		void ColorPalette( const std::uint16_t color_0, const std::uint16_t color_1, const bool three_color_mode, int ( &palette )[ 4 ][ 4 ] )
+		{
+			Unpack565( color_0, palette[ 0 ] );
+			Unpack565( color_1, palette[ 1 ] );
+
+			for( int channel = 0; channel < 3; channel++ )
+			{
+				if( three_color_mode )
+				{
+					palette[ 2 ][ channel ] = ( palette[ 0 ][ channel ] + palette[ 1 ][ channel ] ) / 2;
+					palette[ 3 ][ channel ] = 0;
+				}
+				else
+				{
+					palette[ 2 ][ channel ] = ( 2 * palette[ 0 ][ channel ] + palette[ 1 ][ channel ] ) / 3;
+					palette[ 3 ][ channel ] = ( palette[ 0 ][ channel ] + 2 * palette[ 1 ][ channel ] ) / 3;
+				}
+			}
+
+			palette[ 2 ][ 3 ] = 255;
+			palette[ 3 ][ 3 ] = three_color_mode ? 0 : 255;
+		}
+
+		/* Always in 4-color mode (color_0 > color_1), so that the block decodes the same as BC1 & as the color half of BC3. */
+		void EncodeColorBlock( const Block& block, std::byte* output )
+		{
+			constexpr float WEIGHTS[ 4 ] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+			float start[ 4 ], end[ 4 ];
+			FitLine< 3 >( block, start, end );
+
+			std::uint16_t best_color_0 = 0, best_color_1 = 0;
+			int best_indices[ BLOCK_TEXEL_COUNT ] = {};
+			float best_error = std::numeric_limits< float >::max();
+
+			/* Refines the endpoints for the indices they were given, until that stops paying off. */
+			for( int iteration = 0; iteration < 3; iteration++ )
+			{
+				const std::uint16_t color_0 = Pack565( start ), color_1 = Pack565( end );
+
+				int palette[ 4 ][ 4 ];
+				ColorPalette( color_0, color_1, false, palette );
+
+				int indices[ BLOCK_TEXEL_COUNT ];
+				const float error = SelectIndices< 4, 3 >( block, palette, indices );
+				if( error >= best_error )
+					break;
+
+				best_error	 = error;
+				best_color_0 = color_0;
+				best_color_1 = color_1;
+				std::copy( std::begin( indices ), std::end( indices ), best_indices );
+
+				float weights[ BLOCK_TEXEL_COUNT ];
+				for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+					weights[ i ] = WEIGHTS[ indices[ i ] ];
+
+				if( !FitEndpoints< 3 >( block, weights, start, end ) )
+					break;
+			}
+
+			if( best_color_0 < best_color_1 )
+			{
+				std::swap( best_color_0, best_color_1 );
+				for( auto& index : best_indices )
+					index ^= 1; // 0 <-> 1 & 2 <-> 3.
+			}
+			else if( best_color_0 == best_color_1 )
+				std::fill( std::begin( best_indices ), std::end( best_indices ), 0 ); // Would be 3-color mode, where index 3 is black.
+
+			std::uint32_t index_bits = 0;
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+				index_bits |= std::uint32_t( best_indices[ i ] ) << ( 2 * i );
+
+			WriteLittleEndian( output,	   best_color_0, 2 );
+			WriteLittleEndian( output + 2, best_color_1, 2 );
+			WriteLittleEndian( output + 4, index_bits,	 4 );
+		}
+
+		void DecodeColorBlock( const std::byte* input, const bool is_bc1, DecodedBlock& texels )
+		{
+			const auto color_0	  = std::uint16_t( ReadLittleEndian( input,		2 ) );
+			const auto color_1	  = std::uint16_t( ReadLittleEndian( input + 2, 2 ) );
+			const auto index_bits = std::uint32_t( ReadLittleEndian( input + 4, 4 ) );
+
+			int palette[ 4 ][ 4 ];
+			ColorPalette( color_0, color_1, is_bc1 && color_0 <= color_1, palette );
+
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+			{
+				const int index = ( index_bits >> ( 2 * i ) ) & 3;
+
+				/* BC3's alpha comes from its alpha block. */
+				for( int channel = 0; channel < ( is_bc1 ? 4 : 3 ); channel++ )
+					texels[ i ][ channel ] = ( unsigned char )palette[ index ][ channel ];
+			}
+		}
+
+	/* BC4 (the alpha half of BC3 & both halves of BC5): */
+
+		void BC4Palette( const int value_0, const int value_1, int ( &palette )[ 8 ] )
+		{
+			palette[ 0 ] = value_0;
+			palette[ 1 ] = value_1;
+
+			if( value_0 > value_1 )
+			{
+				for( int i = 2; i < 8; i++ )
+					palette[ i ] = ( ( 8 - i ) * value_0 + ( i - 1 ) * value_1 ) / 7;
+			}
+			else
+			{
+				for( int i = 2; i < 6; i++ )
+					palette[ i ] = ( ( 6 - i ) * value_0 + ( i - 1 ) * value_1 ) / 5;
+
+				palette[ 6 ] = 0;
+				palette[ 7 ] = 255;
+			}
+		}
+
+		/* Of the given channel; the block's extremes as the endpoints, in 8-value mode. */
+		void EncodeBC4Block( const Block& block, const int channel, std::byte* output )
+		{
+			float min = 255.0f, max = 0.0f;
+			for( const auto& texel : block.texels )
+			{
+				min = std::min( min, texel[ channel ] );
+				max = std::max( max, texel[ channel ] );
+			}
+
+			const int value_0 = int( max ), value_1 = int( min );
+			std::uint64_t bits = std::uint64_t( value_0 ) | ( std::uint64_t( value_1 ) << 8 );
+
+			/* Flat blocks keep all indices at 0 (value_0). */
+			if( value_0 > value_1 )
+			{
+				int palette[ 8 ];
+				BC4Palette( value_0, value_1, palette );
+
+				for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+				{
+					int best_index = 0;
+					for( int index = 1; index < 8; index++ )
+						if( std::abs( block.texels[ i ][ channel ] - palette[ index ] ) < std::abs( block.texels[ i ][ channel ] - palette[ best_index ] ) )
+							best_index = index;
+
+					bits |= std::uint64_t( best_index ) << ( 16 + 3 * i );
+				}
+			}
+
+			WriteLittleEndian( output, bits, 8 );
+		}
+
+		void DecodeBC4Block( const std::byte* input, const int channel, DecodedBlock& texels )
+		{
+			const std::uint64_t bits = ReadLittleEndian( input, 8 );
+
+			int palette[ 8 ];
+			BC4Palette( int( bits & 0xFF ), int( ( bits >> 8 ) & 0xFF ), palette );
+
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+				texels[ i ][ channel ] = ( unsigned char )palette[ ( bits >> ( 16 + 3 * i ) ) & 7 ];
+		}
+
+	/* BC7, mode 6: 7-bit RGBA endpoints, each with its own shared least significant bit ("p-bit"), & 4-bit indices. */
+
+		constexpr int BC7_WEIGHTS[ 16 ] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		int BC7Interpolate( const int value_0, const int value_1, const int index )
+		{
+			return ( ( 64 - BC7_WEIGHTS[ index ] ) * value_0 + BC7_WEIGHTS[ index ] * value_1 + 32 ) >> 6;
+		}
+
+		void EncodeBC7Block( const Block& block, std::byte* output )
+		{
+			float start[ 4 ], end[ 4 ];
+			FitLine< 4 >( block, start, end );
+
+			int best_endpoints[ 2 ][ 4 ] = {}, best_p_bits[ 2 ] = {};
+			int best_indices[ BLOCK_TEXEL_COUNT ] = {};
+			float best_error = std::numeric_limits< float >::max();
+
+			for( int iteration = 0; iteration < 3; iteration++ )
+			{
+				const float previous_best_error = best_error;
+
+				/* Each p-bit combination quantizes the endpoints differently; all 4 are tried. */
+				for( int p_bits = 0; p_bits < 4; p_bits++ )
+				{
+					const int p_bit_list[ 2 ] = { p_bits & 1, p_bits >> 1 };
+
+					int endpoints[ 2 ][ 4 ];
+					for( int channel = 0; channel < 4; channel++ )
+					{
+						endpoints[ 0 ][ channel ] = std::clamp( int( std::lround( ( start[ channel ] - p_bit_list[ 0 ] ) / 2.0f ) ), 0, 127 );
+						endpoints[ 1 ][ channel ] = std::clamp( int( std::lround( ( end[ channel ]	 - p_bit_list[ 1 ] ) / 2.0f ) ), 0, 127 );
+					}
+
+					int palette[ 16 ][ 4 ];
+					for( int index = 0; index < 16; index++ )
+						for( int channel = 0; channel < 4; channel++ )
+							palette[ index ][ channel ] = BC7Interpolate( endpoints[ 0 ][ channel ] << 1 | p_bit_list[ 0 ], endpoints[ 1 ][ channel ] << 1 | p_bit_list[ 1 ], index );
+
+					int indices[ BLOCK_TEXEL_COUNT ];
+					const float error = SelectIndices< 16, 4 >( block, palette, indices );
+					if( error < best_error )
+					{
+						best_error = error;
+						std::copy( &endpoints[ 0 ][ 0 ], &endpoints[ 0 ][ 0 ] + 8, &best_endpoints[ 0 ][ 0 ] );
+						best_p_bits[ 0 ] = p_bit_list[ 0 ];
+						best_p_bits[ 1 ] = p_bit_list[ 1 ];
+						std::copy( std::begin( indices ), std::end( indices ), best_indices );
+					}
+				}
+
+				if( best_error >= previous_best_error )
+					break;
+
+				float weights[ BLOCK_TEXEL_COUNT ];
+				for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+					weights[ i ] = BC7_WEIGHTS[ best_indices[ i ] ] / 64.0f;
+
+				if( !FitEndpoints< 4 >( block, weights, start, end ) )
+					break;
+			}
+
+			/* The first texel's index is stored without its most significant bit, which therefore has to be 0. */
+			if( best_indices[ 0 ] >= 8 )
+			{
+				std::swap( best_endpoints[ 0 ], best_endpoints[ 1 ] );
+				std::swap( best_p_bits[ 0 ], best_p_bits[ 1 ] );
+				for( auto& index : best_indices )
+					index = 15 - index;
+			}
+
+			BitWriter writer;
+			writer.Write( 1 << 6, 7 ); // Mode 6: 6 zeroes, then a 1.
+
+			for( int channel = 0; channel < 4; channel++ )
+			{
+				writer.Write( best_endpoints[ 0 ][ channel ], 7 );
+				writer.Write( best_endpoints[ 1 ][ channel ], 7 );
+			}
+
+			writer.Write( best_p_bits[ 0 ], 1 );
+			writer.Write( best_p_bits[ 1 ], 1 );
+
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+				writer.Write( best_indices[ i ], i == 0 ? 3 : 4 );
+
+			writer.Store( output );
+		}
+
+		/* Returns false for modes other than 6. */
+		bool DecodeBC7Block( const std::byte* input, DecodedBlock& texels )
+		{
+			BitReader reader( input );
+			if( reader.Read( 7 ) != 1 << 6 )
+				return false;
+
+			int endpoints[ 2 ][ 4 ];
+			for( int channel = 0; channel < 4; channel++ )
+			{
+				endpoints[ 0 ][ channel ] = reader.Read( 7 );
+				endpoints[ 1 ][ channel ] = reader.Read( 7 );
+			}
+
+			const int p_bit_list[ 2 ] = { int( reader.Read( 1 ) ), int( reader.Read( 1 ) ) };
+
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+			{
+				const int index = reader.Read( i == 0 ? 3 : 4 );
+				for( int channel = 0; channel < 4; channel++ )
+					texels[ i ][ channel ] = ( unsigned char )BC7Interpolate( endpoints[ 0 ][ channel ] << 1 | p_bit_list[ 0 ], endpoints[ 1 ][ channel ] << 1 | p_bit_list[ 1 ], index );
+			}
+
+			return true;
+		}
+
+	/* ETC1/ETC2: Two halves (2x4, or 4x2 if flipped) with a base color each, offset per texel by one of 4 modifiers from a table chosen per half.
+	 * The block is stored as two big-endian 32-bit words: bases, tables & the flip/differential bits in the first; the 2-bit texel indices in the second. */
+
+		/* Per table: the modifiers for the indices 0-3. */
+		constexpr int ETC_MODIFIER_TABLE[ 8 ][ 4 ] =
+		{
+			{ 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+			{ 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+		};
+
+		struct ETCHalfFit
+		{
+			int table;
+			int indices[ 8 ];
+			float error;
+		};
+
+		void ETCHalfTexels( const bool flip, const int half, int ( &texel_list )[ 8 ] )
+		{
+			int count = 0;
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+				if( ( flip ? i / 4 : i % 4 ) / 2 == half )
+					texel_list[ count++ ] = i;
+		}
+
+		/* The best table & indices for the given base color. */
+		ETCHalfFit FitETCHalf( const Block& block, const int ( &texel_list )[ 8 ], const int ( &base )[ 3 ] )
+		{
+			ETCHalfFit best_fit{ 0, {}, std::numeric_limits< float >::max() };
+
+			for( int table = 0; table < 8; table++ )
+			{
+				float palette[ 4 ][ 3 ];
+				for( int index = 0; index < 4; index++ )
+					for( int channel = 0; channel < 3; channel++ )
+						palette[ index ][ channel ] = float( std::clamp( base[ channel ] + ETC_MODIFIER_TABLE[ table ][ index ], 0, 255 ) );
+
+				ETCHalfFit fit{ table, {}, 0.0f };
+				for( int i = 0; i < 8 && fit.error < best_fit.error; i++ )
+				{
+					const auto& texel = block.texels[ texel_list[ i ] ];
+
+					float best_error = std::numeric_limits< float >::max();
+					for( int index = 0; index < 4; index++ )
+					{
+						float error = 0.0f;
+						for( int channel = 0; channel < 3; channel++ )
+						{
+							const float difference = texel[ channel ] - palette[ index ][ channel ];
+							error += difference * difference;
+						}
+
+						if( error < best_error )
+						{
+							best_error		 = error;
+							fit.indices[ i ] = index;
+						}
+					}
+
+					fit.error += best_error;
+				}
+
+				if( fit.error < best_fit.error )
+					best_fit = fit;
+			}
+
+			return best_fit;
+		}
+
+		/* The texel index word; texel ( x, y ) has its index's high bit at bit 16 + x * 4 + y & its low bit at x * 4 + y. */
+		std::uint32_t ETCIndexBits( const int ( &texel_list )[ 2 ][ 8 ], const ETCHalfFit ( &fit_list )[ 2 ] )
+		{
+			std::uint32_t bits = 0;
+			for( int half = 0; half < 2; half++ )
+				for( int i = 0; i < 8; i++ )
+				{
+					const int texel = texel_list[ half ][ i ], index = fit_list[ half ].indices[ i ];
+					const int bit	= ( texel % 4 ) * 4 + texel / 4;
+					bits |= std::uint32_t( index >> 1 ) << ( 16 + bit ) | std::uint32_t( index & 1 ) << bit;
+				}
+
+			return bits;
+		}
+
+		/* Base colors are the averages of the halves, as 4-bit colors each (individual mode) or as a 5-bit color & a 3-bit signed delta to it (differential
+		 * mode; the delta is clamped, so the block never overflows into the ETC2-only modes). The best of both modes & both flips is kept. */
+		void EncodeETCBlock( const Block& block, std::byte* output )
+		{
+			std::uint32_t best_base_word = 0, best_index_word = 0;
+			float best_error = std::numeric_limits< float >::max();
+
+			for( int flip = 0; flip < 2; flip++ )
+			{
+				int texel_list[ 2 ][ 8 ];
+				float average[ 2 ][ 3 ] = {};
+				for( int half = 0; half < 2; half++ )
+				{
+					ETCHalfTexels( flip, half, texel_list[ half ] );
+					for( const int texel : texel_list[ half ] )
+						for( int channel = 0; channel < 3; channel++ )
+							average[ half ][ channel ] += block.texels[ texel ][ channel ] / 8.0f;
+				}
+
+				for( const bool differential : { false, true } )
+				{
+					int quantized[ 2 ][ 3 ], base[ 2 ][ 3 ];
+					for( int channel = 0; channel < 3; channel++ )
+					{
+						if( differential )
+						{
+							quantized[ 0 ][ channel ] = Quantize( average[ 0 ][ channel ], 31 );
+							quantized[ 1 ][ channel ] = std::clamp( Quantize( average[ 1 ][ channel ], 31 ), quantized[ 0 ][ channel ] - 4, quantized[ 0 ][ channel ] + 3 );
+							for( int half = 0; half < 2; half++ )
+								base[ half ][ channel ] = ( quantized[ half ][ channel ] << 3 ) | ( quantized[ half ][ channel ] >> 2 );
+						}
+						else
+						{
+							for( int half = 0; half < 2; half++ )
+							{
+								quantized[ half ][ channel ] = Quantize( average[ half ][ channel ], 15 );
+								base[ half ][ channel ]		 = quantized[ half ][ channel ] * 17;
+							}
+						}
+					}
+
+					const ETCHalfFit fit_list[ 2 ] = { FitETCHalf( block, texel_list[ 0 ], base[ 0 ] ), FitETCHalf( block, texel_list[ 1 ], base[ 1 ] ) };
+					if( fit_list[ 0 ].error + fit_list[ 1 ].error >= best_error )
+						continue;
+
+					best_error = fit_list[ 0 ].error + fit_list[ 1 ].error;
+
+					best_base_word = fit_list[ 0 ].table << 5 | fit_list[ 1 ].table << 2 | int( differential ) << 1 | flip;
+					for( int channel = 0; channel < 3; channel++ )
+					{
+						const int shift = 24 - 8 * channel;
+						if( differential )
+							best_base_word |= std::uint32_t( quantized[ 0 ][ channel ] ) << ( shift + 3 ) |
+											  std::uint32_t( ( quantized[ 1 ][ channel ] - quantized[ 0 ][ channel ] ) & 7 ) << shift;
+						else
+							best_base_word |= std::uint32_t( quantized[ 0 ][ channel ] ) << ( shift + 4 ) | std::uint32_t( quantized[ 1 ][ channel ] ) << shift;
+					}
+
+					best_index_word = ETCIndexBits( texel_list, fit_list );
+				}
+			}
+
+			for( int i = 0; i < 4; i++ )
+			{
+				output[ i ]		= std::byte( ( best_base_word  >> ( 24 - 8 * i ) ) & 0xFF );
+				output[ 4 + i ] = std::byte( ( best_index_word >> ( 24 - 8 * i ) ) & 0xFF );
+			}
+		}
+
+		/* Returns false for the ETC2-only T, H & planar modes. */
+		bool DecodeETCBlock( const std::byte* input, DecodedBlock& texels )
+		{
+			std::uint32_t base_word = 0, index_word = 0;
+			for( int i = 0; i < 4; i++ )
+			{
+				base_word  = base_word	<< 8 | std::uint32_t( input[ i ] );
+				index_word = index_word << 8 | std::uint32_t( input[ 4 + i ] );
+			}
+
+			const bool differential = base_word & 2, flip = base_word & 1;
+
+			int base[ 2 ][ 3 ];
+			for( int channel = 0; channel < 3; channel++ )
+			{
+				const int shift = 24 - 8 * channel;
+				if( differential )
+				{
+					const int value_0 = ( base_word >> ( shift + 3 ) ) & 31;
+					const int delta	  = ( base_word >> shift ) & 7;
+					const int value_1 = value_0 + ( delta >= 4 ? delta - 8 : delta );
+					if( value_1 < 0 || value_1 > 31 )
+						return false;
+
+					base[ 0 ][ channel ] = ( value_0 << 3 ) | ( value_0 >> 2 );
+					base[ 1 ][ channel ] = ( value_1 << 3 ) | ( value_1 >> 2 );
+				}
+				else
+				{
+					base[ 0 ][ channel ] = ( ( base_word >> ( shift + 4 ) ) & 15 ) * 17;
+					base[ 1 ][ channel ] = ( ( base_word >> shift ) & 15 ) * 17;
+				}
+			}
+
+			const int table_list[ 2 ] = { int( base_word >> 5 ) & 7, int( base_word >> 2 ) & 7 };
+
+			for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+			{
+				const int half	= ( flip ? i / 4 : i % 4 ) / 2;
+				const int bit	= ( i % 4 ) * 4 + i / 4;
+				const int index = int( ( index_word >> ( 16 + bit ) ) & 1 ) << 1 | int( ( index_word >> bit ) & 1 );
+
+				for( int channel = 0; channel < 3; channel++ )
+					texels[ i ][ channel ] = ( unsigned char )std::clamp( base[ half ][ channel ] + ETC_MODIFIER_TABLE[ table_list[ half ] ][ index ], 0, 255 );
+			}
+
+			return true;
+		}
+
+		int StoredChannelCountOf( const Format format )
+		{
+			switch( format )
+			{
+				case Format::BC1:
+				case Format::ETC2_RGB:	return 3;
+				case Format::BC5:		return 2;
+				case Format::BC3:
+				case Format::BC7:		return 4;
+			}
+
+			throw std::runtime_error( "TextureCompression: Unknown format." );
+		}
+	}
+
+	GLenum InternalFormatOf( const Format format )
+	{
+		switch( format )
+		{
+			case Format::BC1:		return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+			case Format::BC3:		return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			case Format::BC5:		return GL_COMPRESSED_RG_RGTC2;
+			case Format::BC7:		return GL_COMPRESSED_RGBA_BPTC_UNORM;
+			case Format::ETC2_RGB:	return GL_COMPRESSED_RGB8_ETC2;
+		}
+
+		throw std::runtime_error( "TextureCompression: Unknown format." );
+	}
+
+	GLenum BaseInternalFormatOf( const Format format )
+	{
+		switch( StoredChannelCountOf( format ) )
+		{
+			case 2:		return GL_RG;
+			case 3:		return GL_RGB;
+			default:	return GL_RGBA;
+		}
+	}
+
+	std::optional< Format > FormatOf( const GLenum internal_format )
+	{
+		for( const Format format : { Format::BC1, Format::BC3, Format::BC5, Format::BC7, Format::ETC2_RGB } )
+			if( InternalFormatOf( format ) == internal_format )
+				return format;
+
+		return std::nullopt;
+	}
+
+	const char* NameOf( const Format format )
+	{
+		switch( format )
+		{
+			case Format::BC1:		return "BC1";
+			case Format::BC3:		return "BC3";
+			case Format::BC5:		return "BC5";
+			case Format::BC7:		return "BC7";
+			case Format::ETC2_RGB:	return "ETC2";
+		}
+
+		throw std::runtime_error( "TextureCompression: Unknown format." );
+	}
+
+	bool IsSupported( const Format format )
+	{
+		switch( format )
+		{
+			case Format::BC1:
+			case Format::BC3:		return IsGLExtensionSupported( "GL_EXT_texture_compression_s3tc" );
+			case Format::BC5:		return IsGLVersionSupported( 3, 0 );
+			case Format::BC7:		return IsGLVersionSupported( 4, 2 ) || IsGLExtensionSupported( "GL_ARB_texture_compression_bptc" );
+			case Format::ETC2_RGB:	return IsGLVersionSupported( 4, 3 ) || IsGLExtensionSupported( "GL_ARB_ES3_compatibility" );
+		}
+
+		throw std::runtime_error( "TextureCompression: Unknown format." );
+	}
+
+	unsigned int BlockByteCountOf( const Format format )
+	{
+		return format == Format::BC1 || format == Format::ETC2_RGB ? 8 : 16;
+	}
+
+	std::size_t CompressedSizeOf( const Format format, const int width, const int height )
+	{
+		return std::size_t( ( width + 3 ) / 4 ) * ( ( height + 3 ) / 4 ) * BlockByteCountOf( format );
+	}
+
+	std::vector< std::byte > Encode( const unsigned char* rgba, const int width, const int height, const Format format, Utility::ThreadPool& thread_pool )
+	{
+		std::vector< std::byte > blocks( CompressedSizeOf( format, width, height ) );
+
+		const int block_column_count		= ( width + 3 ) / 4;
+		const unsigned int block_byte_count = BlockByteCountOf( format );
+
+		thread_pool.ParallelFor( ( height + 3 ) / 4, 1, [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			for( int block_y = int( begin ); block_y < int( end ); block_y++ )
+				for( int block_x = 0; block_x < block_column_count; block_x++ )
+				{
+					const Block block = LoadBlock( rgba, width, height, block_x, block_y );
+					std::byte* output = blocks.data() + ( std::size_t( block_y ) * block_column_count + block_x ) * block_byte_count;
+
+					switch( format )
+					{
+						case Format::BC1:
+							EncodeColorBlock( block, output );
+							break;
+						case Format::BC3:
+							EncodeBC4Block( block, 3, output );
+							EncodeColorBlock( block, output + 8 );
+							break;
+						case Format::BC5:
+							EncodeBC4Block( block, 0, output );
+							EncodeBC4Block( block, 1, output + 8 );
+							break;
+						case Format::BC7:
+							EncodeBC7Block( block, output );
+							break;
+						case Format::ETC2_RGB:
+							EncodeETCBlock( block, output );
+							break;
+					}
+				}
+		} );
+
+		return blocks;
+	}
+
+	std::vector< unsigned char > Decode( const std::byte* blocks, const int width, const int height, const Format format )
+	{
+		std::vector< unsigned char > rgba( std::size_t( width ) * height * 4 );
+
+		const int block_column_count		= ( width + 3 ) / 4;
+		const unsigned int block_byte_count = BlockByteCountOf( format );
+
+		for( int block_y = 0; block_y < ( height + 3 ) / 4; block_y++ )
+			for( int block_x = 0; block_x < block_column_count; block_x++ )
+			{
+				const std::byte* input = blocks + ( std::size_t( block_y ) * block_column_count + block_x ) * block_byte_count;
+
+				DecodedBlock texels;
+				for( auto& texel : texels )
+				{
+					texel[ 0 ] = texel[ 1 ] = texel[ 2 ] = 0;
+					texel[ 3 ] = 255;
+				}
+
+				bool is_decoded = true;
+				switch( format )
+				{
+					case Format::BC1:
+						DecodeColorBlock( input, true, texels );
+						break;
+					case Format::BC3:
+						DecodeBC4Block( input, 3, texels );
+						DecodeColorBlock( input + 8, false, texels );
+						break;
+					case Format::BC5:
+						DecodeBC4Block( input, 0, texels );
+						DecodeBC4Block( input + 8, 1, texels );
+						break;
+					case Format::BC7:
+						is_decoded = DecodeBC7Block( input, texels );
+						break;
+					case Format::ETC2_RGB:
+						is_decoded = DecodeETCBlock( input, texels );
+						break;
+				}
+
+				for( int i = 0; i < BLOCK_TEXEL_COUNT; i++ )
+				{
+					const int x = block_x * 4 + i % 4, y = block_y * 4 + i / 4;
+					if( x >= width || y >= height )
+						continue;
+
+					unsigned char* texel = rgba.data() + ( std::size_t( y ) * width + x ) * 4;
+					if( is_decoded )
+						std::copy( texels[ i ], texels[ i ] + 4, texel );
+					else
+					{
+						texel[ 0 ] = texel[ 2 ] = texel[ 3 ] = 255;
+						texel[ 1 ] = 0;
+					}
+				}
+			}
+
+		return rgba;
+	}
+
+	double PSNR( const unsigned char* rgba_original, const unsigned char* rgba_decoded, const int width, const int height, const Format format )
+	{
+		const int channel_count = StoredChannelCountOf( format );
+
+		double squared_error_sum = 0.0;
+		for( std::size_t texel = 0; texel < std::size_t( width ) * height; texel++ )
+			for( int channel = 0; channel < channel_count; channel++ )
+			{
+				const double difference = double( rgba_original[ texel * 4 + channel ] ) - rgba_decoded[ texel * 4 + channel ];
+				squared_error_sum += difference * difference;
+			}
+
+		if( squared_error_sum == 0.0 )
+			return std::numeric_limits< double >::infinity();
+
+		const double mean_squared_error = squared_error_sum / ( double( width ) * height * channel_count );
+		return 10.0 * std::log10( 255.0 * 255.0 / mean_squared_error );
+	}
+}
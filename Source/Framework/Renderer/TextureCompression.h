@@ -0,0 +1,67 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/Graphics.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/* S3TC, BPTC & ETC2 are not part of the GL 3.3 GLAD loader (RGTC is core since GL 3.0). */
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT		0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT	0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM		0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2				0x9274
+#endif
+
+namespace Framework::TextureCompression
+{
+	/* Block compressed formats (4x4 texel blocks) the CPU encoder produces:
+	 *	BC1:	  RGB, 4 bits/texel (alpha dropped).
+	 *	BC3:	  RGBA, 8 bits/texel (BC1 color & a BC4 alpha block).
+	 *	BC5:	  RG, 8 bits/texel (two BC4 blocks); for normal maps.
+	 *	BC7:	  RGBA, 8 bits/texel; mode 6 only (a single RGBA line per block, 4-bit indices).
+	 *	ETC2_RGB: RGB, 4 bits/texel; ETC1-compatible individual/differential blocks only (valid ETC2, as those never overflow into the ETC2-only modes).
+	 * Which of them the GL context can sample from is reported by IsSupported(). */
+	enum class Format
+	{
+		BC1, BC3, BC5, BC7, ETC2_RGB
+	};
+
+	GLenum InternalFormatOf( const Format format );
+	/* GL_RGB, GL_RG or GL_RGBA. */
+	GLenum BaseInternalFormatOf( const Format format );
+	std::optional< Format > FormatOf( const GLenum internal_format );
+	const char* NameOf( const Format format );
+
+	/* By the current context: BC1/BC3 need EXT_texture_compression_s3tc, BC5 GL 3.0, BC7 GL 4.2 (or ARB_texture_compression_bptc) & ETC2 GL 4.3
+	 * (or ARB_ES3_compatibility). Walks the extension list. */
+	bool IsSupported( const Format format );
+
+	/* 8 or 16. */
+	unsigned int BlockByteCountOf( const Format format );
+	/* Partial blocks at the right & bottom edges count as whole blocks. */
+	std::size_t CompressedSizeOf( const Format format, const int width, const int height );
+
+	/* rgba: Tightly packed RGBA8 texels, width x height; channels the format does not store are ignored. Texels of partial blocks are replicated from the edges.
+	 * Block rows are encoded in parallel on the given pool. */
+	std::vector< std::byte > Encode( const unsigned char* rgba, const int width, const int height, const Format format,
+									 Utility::ThreadPool& thread_pool = Utility::ThreadPool::Default() );
+
+	/* Back to tightly packed RGBA8; channels the format does not store are 0 (blue) & 255 (alpha). Decodes everything Encode() produces;
+	 * other BC7 modes & the ETC2-only T/H/planar modes decode as magenta. */
+	std::vector< unsigned char > Decode( const std::byte* blocks, const int width, const int height, const Format format );
+
+	/* Peak signal-to-noise ratio (dB) between two RGBA8 images, over the channels the format stores; infinity if they are identical. */
+	double PSNR( const unsigned char* rgba_original, const unsigned char* rgba_decoded, const int width, const int height, const Format format );
+}
@@ -0,0 +1,179 @@
+// Framework Includes.
+#include "Renderer/TextureCompression.h"
+#include "Renderer/TextureFile.h"
+
+// std Includes.
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace Framework
+{
+	namespace
+	{
+		constexpr std::uint8_t IDENTIFIER[ 12 ] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+		constexpr std::uint32_t ENDIANNESS	  = 0x04030201;
+		constexpr int MAX_SIZE				  = 1 << 16;
+
+		/* Key & value, both null terminated: T (rows) increase upwards, i.e., the first row stored is the bottom one. */
+		constexpr char ORIENTATION_KEY_VALUE[] = "KTXorientation\0S=r,T=u";
+
+		std::size_t AlignUp( const std::size_t offset ) { return ( offset + 3 ) / 4 * 4; }
+
+		int FullLevelCount( const int width, const int height )
+		{
+			int level_count = 1;
+			for( int size = std::max( width, height ); size > 1; size /= 2 )
+				level_count++;
+
+			return level_count;
+		}
+	}
+
+	TextureFile::TextureFile( const std::string& file_path )
+		:
+		file( file_path ),
+		header{},
+		is_valid( false )
+	{
+		if( !file.IsOpen() )
+		{
+			std::cerr << "ERROR::TEXTURE_FILE::COULD_NOT_OPEN_FILE: " << file_path << "\n";
+			return;
+		}
+
+		if( file.Size() >= sizeof( Header ) )
+			std::memcpy( &header, file.Data(), sizeof( Header ) );
+
+		is_valid = Validate();
+		if( !is_valid )
+		{
+			std::cerr << "ERROR::TEXTURE_FILE::INVALID_OR_UNSUPPORTED_FILE: " << file_path << "\n";
+			header = {};
+			level_list.clear();
+		}
+	}
+
+	bool TextureFile::Write( const std::string& file_path, const GLenum internal_format, const int width, const int height,
+							 const std::vector< std::vector< std::byte > >& level_list )
+	{
+		const auto format = TextureCompression::FormatOf( internal_format );
+		if( !format )
+		{
+			std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_FORMAT: " << file_path << "\n";
+			return false;
+		}
+
+		if( width <= 0 || height <= 0 || width > MAX_SIZE || height > MAX_SIZE || level_list.empty() || int( level_list.size() ) > FullLevelCount( width, height ) )
+		{
+			std::cerr << "ERROR::TEXTURE_FILE::INVALID_SIZE_OR_LEVEL_COUNT: " << file_path << "\n";
+			return false;
+		}
+
+		for( std::size_t level = 0; level < level_list.size(); level++ )
+		{
+			if( level_list[ level ].size() != TextureCompression::CompressedSizeOf( *format, std::max( width >> level, 1 ), std::max( height >> level, 1 ) ) )
+			{
+				std::cerr << "ERROR::TEXTURE_FILE::LEVEL_SIZE_DOES_NOT_MATCH_FORMAT: " << file_path << "\n";
+				return false;
+			}
+		}
+
+		const std::uint32_t key_value_size = sizeof( ORIENTATION_KEY_VALUE );
+
+		Header header{};
+		std::memcpy( header.identifier, IDENTIFIER, sizeof( IDENTIFIER ) );
+		header.endianness				= ENDIANNESS;
+		header.gl_type_size				= 1;
+		header.gl_internal_format		= internal_format;
+		header.gl_base_internal_format	= TextureCompression::BaseInternalFormatOf( *format );
+		header.pixel_width				= width;
+		header.pixel_height				= height;
+		header.face_count				= 1;
+		header.level_count				= ( std::uint32_t )level_list.size();
+		header.key_value_data_size		= ( std::uint32_t )AlignUp( sizeof( key_value_size ) + key_value_size );
+
+		std::ofstream stream( file_path, std::ios::binary | std::ios::trunc );
+		if( !stream )
+		{
+			std::cerr << "ERROR::TEXTURE_FILE::COULD_NOT_CREATE_FILE: " << file_path << "\n";
+			return false;
+		}
+
+		const char zeroes[ 4 ] = {};
+		const auto pad_to_4_bytes = [ & ]() { stream.write( zeroes, std::streamsize( AlignUp( std::size_t( stream.tellp() ) ) - std::size_t( stream.tellp() ) ) ); };
+
+		stream.write( reinterpret_cast< const char* >( &header ), sizeof( Header ) );
+
+		stream.write( reinterpret_cast< const char* >( &key_value_size ), sizeof( key_value_size ) );
+		stream.write( ORIENTATION_KEY_VALUE, key_value_size );
+		pad_to_4_bytes();
+
+		for( const auto& level : level_list )
+		{
+			const auto level_size = ( std::uint32_t )level.size();
+			stream.write( reinterpret_cast< const char* >( &level_size ), sizeof( level_size ) );
+			stream.write( reinterpret_cast< const char* >( level.data() ), std::streamsize( level_size ) );
+			pad_to_4_bytes();
+		}
+
+		if( !stream )
+		{
+			std::cerr << "ERROR::TEXTURE_FILE::COULD_NOT_WRITE_TO_FILE: " << file_path << "\n";
+			return false;
+		}
+
+		return true;
+	}
+
+	std::size_t TextureFile::DataSize() const
+	{
+		std::size_t data_size = 0;
+		for( const auto& level : level_list )
+			data_size += level.size;
+
+		return data_size;
+	}
+
+	bool TextureFile::Validate()
+	{
+		if( file.Size() < sizeof( Header ) || std::memcmp( header.identifier, IDENTIFIER, sizeof( IDENTIFIER ) ) != 0 || header.endianness != ENDIANNESS )
+			return false;
+
+		/* Compressed (no type & format), 2D (no depth, array or faces). */
+		if( header.gl_type != 0 || header.gl_type_size != 1 || header.gl_format != 0 ||
+			header.pixel_depth != 0 || header.array_element_count != 0 || header.face_count != 1 )
+			return false;
+
+		const auto format = TextureCompression::FormatOf( header.gl_internal_format );
+		if( !format || header.gl_base_internal_format != TextureCompression::BaseInternalFormatOf( *format ) )
+			return false;
+
+		if( header.pixel_width == 0 || header.pixel_height == 0 || header.pixel_width > MAX_SIZE || header.pixel_height > MAX_SIZE ||
+			header.level_count == 0 || int( header.level_count ) > FullLevelCount( Width(), Height() ) )
+			return false;
+
+		/* Subtractions instead of additions, so that huge (corrupt) sizes can not overflow. */
+		if( header.key_value_data_size > file.Size() - sizeof( Header ) )
+			return false;
+
+		std::size_t offset = sizeof( Header ) + header.key_value_data_size;
+		for( int level = 0; level < int( header.level_count ); level++ )
+		{
+			std::uint32_t level_size;
+			if( offset > file.Size() || sizeof( level_size ) > file.Size() - offset )
+				return false;
+
+			std::memcpy( &level_size, file.Data() + offset, sizeof( level_size ) );
+			offset += sizeof( level_size );
+
+			if( level_size != TextureCompression::CompressedSizeOf( *format, LevelWidth( level ), LevelHeight( level ) ) || level_size > file.Size() - offset )
+				return false;
+
+			level_list.push_back( { offset, level_size } );
+			offset = AlignUp( offset + level_size );
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/Graphics.h"
+
+#include "Utility/MemoryMappedFile.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+	/* Block compressed 2D texture with precomputed mipmaps, in a KTX (1.1) container (".ktx"): a fixed-size header naming the GL internal format, followed
+	 * by each level's size & blocks, stored exactly as glCompressedTexImage2D() expects them. The file is memory mapped; LevelData() points into the mapping.
+	 * Only the formats of TextureCompression are accepted; rows are stored bottom row first (as Texture uploads images), noted as "KTXorientation" metadata.
+	 * Little-endian only. */
+	class TextureFile
+	{
+	public:
+		/* Check IsValid() afterwards; files that can not be opened, are not compressed 2D textures of a known format or are inconsistent (e.g., truncated)
+		 * are reported as invalid. */
+		explicit TextureFile( const std::string& file_path );
+
+		TextureFile( const TextureFile& )				= delete;
+		TextureFile& operator= ( const TextureFile& )	= delete;
+
+		/* level_list: The compressed blocks of each level, from the given size down; each level half the size of the previous one (rounded down, at least 1). */
+		static bool Write( const std::string& file_path, const GLenum internal_format, const int width, const int height,
+						   const std::vector< std::vector< std::byte > >& level_list );
+
+		inline bool IsValid() const { return is_valid; }
+
+		inline GLenum InternalFormat() const { return header.gl_internal_format; }
+		/* GL_RG, GL_RGB or GL_RGBA. */
+		inline GLenum BaseInternalFormat() const { return header.gl_base_internal_format; }
+		inline int Width() const { return int( header.pixel_width ); }
+		inline int Height() const { return int( header.pixel_height ); }
+
+		inline int LevelCount() const { return int( level_list.size() ); }
+		inline int LevelWidth( const int level ) const { return std::max( Width() >> level, 1 ); }
+		inline int LevelHeight( const int level ) const { return std::max( Height() >> level, 1 ); }
+		inline const std::byte* LevelData( const int level ) const { return file.Data() + level_list[ level ].offset; }
+		inline std::size_t LevelSize( const int level ) const { return level_list[ level ].size; }
+		/* Of all levels. */
+		std::size_t DataSize() const;
+
+	private:
+		/* Exactly as stored in the file. */
+		struct Header
+		{
+			std::uint8_t identifier[ 12 ];
+			std::uint32_t endianness;
+			std::uint32_t gl_type;
+			std::uint32_t gl_type_size;
+			std::uint32_t gl_format;
+			std::uint32_t gl_internal_format;
+			std::uint32_t gl_base_internal_format;
+			std::uint32_t pixel_width;
+			std::uint32_t pixel_height;
+			std::uint32_t pixel_depth;
+			std::uint32_t array_element_count;
+			std::uint32_t face_count;
+			std::uint32_t level_count;
+			std::uint32_t key_value_data_size;
+		};
+
+		static_assert( sizeof( Header ) == 64, "TextureFile::Header: Has to match the KTX 1.1 header." );
+
+		struct LevelRange
+		{
+			std::size_t offset;
+			std::size_t size;
+		};
+
+		/* Also fills level_list. */
+		bool Validate();
+
+	private:
+		Utility::MemoryMappedFile file;
+		/* Copied out of the mapping, as the mapping gives no alignment guarantees beyond the page it starts at. */
+		Header header;
+		std::vector< LevelRange > level_list;
+		bool is_valid;
+	};
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Vendor GLAD Includes (Has to be included before GLFW!).
+#include "Vendor/OpenGL/glad/glad.h"
+
+// Framework Includes.
+#include "Math/Matrix.hpp"
+
+namespace Framework::UniformBlock
+{
+	/* Uniform blocks with reserved names. Shaders declaring a block with one of the names below get it bound to the matching binding point on creation.
+	 * Camera is shared by all shaders, so a single UniformBuffer (owned by the Renderer) feeds every shader.
+	 * Material holds per-material parameters; each Material owns a UniformBuffer & binds it to this point when it is bound. */
+
+	enum class BindingPoint : GLuint
+	{
+		Camera	 = 0,
+		Material = 1
+	};
+
+	/* CPU-side mirrors of the blocks, in std140 layout.
+	 * Matrices are stored row-major, as on the CPU side; blocks are declared with layout( std140, row_major ) in GLSL, so no transposing is needed. */
+
+	/* GLSL:
+	 * layout( std140, row_major ) uniform Camera
+	 * {
+	 *     mat4 transform_view;
+	 *     mat4 transform_projection;
+	 * }; */
+	struct Camera
+	{
+		static constexpr const char* NAME = "Camera";
+		static constexpr BindingPoint BINDING_POINT = BindingPoint::Camera;
+
+		Matrix4x4 transform_view;
+		Matrix4x4 transform_projection;
+	};
+
+	static_assert( sizeof( Camera ) == 2 * 16 * sizeof( float ), "UniformBlock::Camera does not match its std140 layout." );
+
+	/* GLSL:
+	 * layout( std140, row_major ) uniform Material
+	 * {
+	 *     ...
+	 * };
+	 * Contents differ per shader; the layout is reflected on shader creation (see ShaderUniformInformation::is_in_material_block) & mirrored by Material's uniform blob. */
+	struct Material
+	{
+		static constexpr const char* NAME = "Material";
+		static constexpr BindingPoint BINDING_POINT = BindingPoint::Material;
+	};
+}
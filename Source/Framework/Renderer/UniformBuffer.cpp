@@ -0,0 +1,45 @@
+// Framework Includes.
+#include "Renderer/Graphics.h"
+#include "Renderer/StateCache.h"
+#include "Renderer/UniformBuffer.h"
+
+namespace Framework
+{
+	UniformBuffer::UniformBuffer( const unsigned int size, const GLenum usage )
+		:
+		size( size )
+	{
+		GLCALL( glGenBuffers( 1, &id ) );
+		Bind();
+		GLCALL( glBufferData( GL_UNIFORM_BUFFER, size, nullptr, usage ) );
+	}
+
+	UniformBuffer::~UniformBuffer()
+	{
+		GLCALL( glDeleteBuffers( 1, &id ) );
+		StateCache::Instance().OnBufferDeleted( id );
+	}
+
+	void UniformBuffer::Bind() const
+	{
+		StateCache::Instance().BindBuffer( GL_UNIFORM_BUFFER, id );
+	}
+
+	void UniformBuffer::Unbind() const
+	{
+		StateCache::Instance().BindBuffer( GL_UNIFORM_BUFFER, 0 );
+	}
+
+	void UniformBuffer::BindToBindingPoint( const GLuint binding_point ) const
+	{
+		StateCache::Instance().BindUniformBuffer( binding_point, id );
+	}
+
+	void UniformBuffer::Update( const void* data, const unsigned int size, const unsigned int offset ) const
+	{
+		ASSERT_DEBUG_ONLY( offset + size <= this->size );
+
+		Bind();
+		GLCALL( glBufferSubData( GL_UNIFORM_BUFFER, offset, size, data ) );
+	}
+}
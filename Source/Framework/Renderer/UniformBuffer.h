@@ -0,0 +1,39 @@
+#pragma once
+
+// Vendor GLAD Includes (Has to be included before GLFW!).
+#include "Vendor/OpenGL/glad/glad.h"
+
+namespace Framework
+{
+	/* GPU-side storage for one uniform block. The contents are expected to follow the block's std140 layout (see Renderer/UniformBlock.h). */
+	class UniformBuffer
+	{
+	public:
+		UniformBuffer( const unsigned int size, const GLenum usage = GL_DYNAMIC_DRAW );
+		~UniformBuffer();
+
+		UniformBuffer( const UniformBuffer& )				= delete;
+		UniformBuffer& operator= ( const UniformBuffer& )	= delete;
+
+		void Bind() const;
+		void Unbind() const;
+
+		/* Binds the whole buffer to the indexed binding point; every uniform block bound to the same point (via glUniformBlockBinding) then reads from this buffer. */
+		void BindToBindingPoint( const GLuint binding_point ) const;
+
+		void Update( const void* data, const unsigned int size, const unsigned int offset = 0 ) const;
+
+		template< typename BlockType >
+		void Update( const BlockType& block ) const
+		{
+			Update( static_cast< const void* >( &block ), sizeof( BlockType ) );
+		}
+
+		inline GLuint ID() const { return id; }
+		inline unsigned int Size() const { return size; }
+
+	private:
+		GLuint id;
+		unsigned int size;
+	};
+}
@@ -1,44 +1,84 @@
 // Framework Includes.
 #include "Renderer/Graphics.h"
+#include "Renderer/StateCache.h"
 #include "Renderer/VertexArray.h"
 
 namespace Framework
 {
-	VertexArray::VertexArray( const VertexBuffer& vertex_buffer, const VertexBufferLayout& vertex_buffer_layout )
+	VertexArray::VertexArray( const VertexBuffer& vertex_buffer, const VertexBufferLayout& vertex_buffer_layout, const IndexBuffer* index_buffer )
 		:
 		vertex_count( vertex_buffer.VertexCount() ),
-		id_vertex_buffer( vertex_buffer.ID() )
+		index_count( index_buffer ? index_buffer->Count() : 0 ),
+		index_type( index_buffer ? index_buffer->IndexType() : GL_NONE ),
+		id_vertex_buffer( vertex_buffer.ID() ),
+		id_instance_buffer( 0 ),
+		instance_buffer_generation( 0 ),
+		instance_buffer_byte_offset( 0 ),
+		instance_buffer_first_location( 0 )
 	{
 		GLCALL( glGenVertexArrays( 1, &id ) );
 
 		Bind();
 		vertex_buffer.Bind();
 
-		const auto& attribute_list = vertex_buffer_layout.GetAttributes();
-		const unsigned int stride = vertex_buffer_layout.GetStride();
-		unsigned int offset = 0;
-		for( auto i = 0; i < attribute_list.size(); i++ )
-		{
-			const auto& attribute = attribute_list[ i ];
-			GLCALL( glEnableVertexAttribArray( /* Location: */ i ) );
-			GLCALL( glVertexAttribPointer( /* Location: */ i, attribute.count, attribute.type, attribute.normalized, stride, BUFFER_OFFSET( offset ) ) );
-			offset += attribute.count * attribute.GetSizeOfType();
-		}
+		SetAttributes( vertex_buffer_layout, 0, 0 );
+
+		if( index_buffer )
+			index_buffer->Bind();
 	}
 
 	VertexArray::~VertexArray()
 	{
 		GLCALL( glDeleteBuffers( 1, &id_vertex_buffer ) );
+		StateCache::Instance().OnBufferDeleted( id_vertex_buffer );
 		GLCALL( glDeleteVertexArrays( 1, &id ) );
+		StateCache::Instance().OnVertexArrayDeleted( id );
 	}
 
 	void VertexArray::Bind() const
 	{
-		GLCALL( glBindVertexArray( id ) );
+		StateCache::Instance().BindVertexArray( id );
 	}
 
 	void VertexArray::Unbind() const
 	{
-		GLCALL( glBindVertexArray( 0 ) );
+		StateCache::Instance().BindVertexArray( 0 );
+	}
+
+	void VertexArray::AttachInstanceBuffer( const GLuint instance_buffer_id, const unsigned int instance_buffer_generation, const VertexBufferLayout& instance_buffer_layout,
+											const unsigned int first_location, const unsigned int byte_offset ) const
+	{
+		Bind();
+
+		if( id_instance_buffer == instance_buffer_id && this->instance_buffer_generation == instance_buffer_generation &&
+			instance_buffer_byte_offset == byte_offset && instance_buffer_first_location == first_location )
+			return;
+
+		StateCache::Instance().BindBuffer( GL_ARRAY_BUFFER, instance_buffer_id );
+		SetAttributes( instance_buffer_layout, first_location, byte_offset );
+
+		id_instance_buffer			   = instance_buffer_id;
+		this->instance_buffer_generation = instance_buffer_generation;
+		instance_buffer_byte_offset	   = byte_offset;
+		instance_buffer_first_location = first_location;
+	}
+
+	void VertexArray::SetAttributes( const VertexBufferLayout& vertex_buffer_layout, const unsigned int first_location, const unsigned int byte_offset )
+	{
+		const auto& attribute_list = vertex_buffer_layout.GetAttributes();
+		const unsigned int stride = vertex_buffer_layout.GetStride();
+		unsigned int offset = byte_offset;
+		for( auto i = 0; i < attribute_list.size(); i++ )
+		{
+			const auto& attribute = attribute_list[ i ];
+			const unsigned int location = first_location + i;
+			GLCALL( glEnableVertexAttribArray( location ) );
+			GLCALL( glVertexAttribPointer( location, attribute.count, attribute.type, attribute.normalized, stride, BUFFER_OFFSET( offset ) ) );
+			if( attribute.divisor != 0 )
+			{
+				GLCALL( glVertexAttribDivisor( location, attribute.divisor ) );
+			}
+			offset += attribute.GetSize();
+		}
 	}
 }
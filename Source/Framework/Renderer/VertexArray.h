@@ -1,9 +1,15 @@
 #pragma once
 
 // Framework Includes
+#include "Renderer/IndexBuffer.h"
 #include "Renderer/VertexBuffer.h"
 #include "Renderer/VertexBufferLayout.h"
 
+#include "Math/Bounds.h"
+
+// std Includes.
+#include <optional>
+
 namespace Framework
 {
 	class VertexArray
@@ -11,18 +17,52 @@ namespace Framework
 	public:
 		// We could make it so the buffer & layout are "Add()ed" after construction. This way, a VA could change its vb & layout after creation.
 		// We won't make it so in the beginning to see if the need arises & learn through experience.
-		VertexArray( const VertexBuffer& vertex_buffer, const VertexBufferLayout& vertex_buffer_layout );
+		/* The index buffer (optional) becomes part of the vertex array's state; Drawables using this vertex array then draw indexed.
+		 * It is not owned & has to outlive the vertex array. */
+		VertexArray( const VertexBuffer& vertex_buffer, const VertexBufferLayout& vertex_buffer_layout, const IndexBuffer* index_buffer = nullptr );
 		~VertexArray();
 
 		void Bind() const;
 		void Unbind() const;
 
+		/* Sources the attributes of the given (per-instance) layout from the given buffer (a VertexBuffer, StreamingBuffer etc.), starting at first_location & byte_offset
+		 * into the buffer. Binds this vertex array. Re-attaching the same buffer at the same offset & location is a no-op. The buffer is not owned.
+		 * As GL reuses the names of deleted buffers, the buffer is identified by its name & generation (see StreamingBuffer::Generation(); 0 for buffers that
+		 * live at least as long as this vertex array). */
+		void AttachInstanceBuffer( const GLuint instance_buffer_id, const unsigned int instance_buffer_generation, const VertexBufferLayout& instance_buffer_layout,
+								   const unsigned int first_location, const unsigned int byte_offset ) const;
+
+		inline unsigned int ID() const { return id; }
 		inline unsigned int VertexCount() const { return vertex_count; }
 
+		inline bool IsIndexed() const { return index_count != 0; }
+		inline unsigned int IndexCount() const { return index_count; }
+		/* GL_UNSIGNED_SHORT or GL_UNSIGNED_INT; GL_NONE if not indexed. */
+		inline GLenum IndexType() const { return index_type; }
+
+		/* Of the vertex positions, in model space; for culling (see Renderer). Not derived from the buffer, as the data may no longer be around on the CPU.
+		 * Without bounds, Drawables using this vertex array are never culled. */
+		inline void SetBounds( const Math::AABB& bounds ) { this->bounds = bounds; }
+		inline const std::optional< Math::AABB >& GetBounds() const { return bounds; }
+
+	private:
+		/* Expects this vertex array & the source buffer to be bound. */
+		static void SetAttributes( const VertexBufferLayout& vertex_buffer_layout, const unsigned int first_location, const unsigned int byte_offset );
+
 	private:
 		unsigned int id;
 		unsigned int vertex_count;
+		unsigned int index_count;
+		GLenum index_type;
 
 		unsigned int id_vertex_buffer;
+
+		std::optional< Math::AABB > bounds;
+
+		/* What is currently attached via AttachInstanceBuffer(). */
+		mutable unsigned int id_instance_buffer;
+		mutable unsigned int instance_buffer_generation;
+		mutable unsigned int instance_buffer_byte_offset;
+		mutable unsigned int instance_buffer_first_location;
 	};
 }
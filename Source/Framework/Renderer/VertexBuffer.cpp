@@ -1,24 +1,64 @@
 // Framework Includes.
+#include "Renderer/StateCache.h"
 #include "Renderer/VertexBuffer.h"
 
 namespace Framework
 {
+	VertexBuffer::VertexBuffer( const std::byte* data, const unsigned int vertex_count, const unsigned int stride )
+		:
+		vertex_count( vertex_count ),
+		size( stride * vertex_count ),
+		usage( GL_STATIC_DRAW )
+	{
+		GLCALL( glGenBuffers( 1, &id ) );
+		Bind();
+		GLCALL( glBufferData( GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW ) );
+	}
+
+	VertexBuffer::VertexBuffer( const unsigned int size, const GLenum usage )
+		:
+		vertex_count( 0 ),
+		size( size ),
+		usage( usage )
+	{
+		GLCALL( glGenBuffers( 1, &id ) );
+		Bind();
+		GLCALL( glBufferData( GL_ARRAY_BUFFER, size, nullptr, usage ) );
+	}
+
 	VertexBuffer::~VertexBuffer()
 	{
 	}
 
 	void VertexBuffer::Bind() const
 	{
-		GLCALL( glBindBuffer( GL_ARRAY_BUFFER, id ) );
+		StateCache::Instance().BindBuffer( GL_ARRAY_BUFFER, id );
 	}
 
 	void VertexBuffer::Unbind() const
 	{
-		GLCALL( glBindBuffer( GL_ARRAY_BUFFER, 0 ) );
+		StateCache::Instance().BindBuffer( GL_ARRAY_BUFFER, 0 );
+	}
+
+	void VertexBuffer::Update( const void* data, const unsigned int size, const unsigned int offset ) const
+	{
+		ASSERT_DEBUG_ONLY( offset + size <= this->size );
+
+		Bind();
+		GLCALL( glBufferSubData( GL_ARRAY_BUFFER, offset, size, data ) );
+	}
+
+	void VertexBuffer::Orphan( const unsigned int new_size )
+	{
+		size = new_size;
+
+		Bind();
+		GLCALL( glBufferData( GL_ARRAY_BUFFER, size, nullptr, usage ) );
 	}
 
 	void VertexBuffer::CleanUp() const
 	{
 		GLCALL( glDeleteBuffers( 1, &id ) );
+		StateCache::Instance().OnBufferDeleted( id );
 	}
 }
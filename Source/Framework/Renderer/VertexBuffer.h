@@ -3,6 +3,9 @@
 // Framework Includes.
 #include "Renderer/Graphics.h"
 
+// std Includes.
+#include <cstddef>
+
 namespace Framework
 {
 	/* While a CleanUp() function is provided, expected usage is to not invoke it, as a VertexArray will take care of this on destruction. */
@@ -13,12 +16,17 @@ namespace Framework
 		VertexBuffer( const Type* data, const unsigned int vertex_count )
 			:
 			vertex_count( vertex_count ),
-			size( sizeof( Type )* vertex_count )
+			size( sizeof( Type )* vertex_count ),
+			usage( GL_STATIC_DRAW )
 		{
 			GLCALL( glGenBuffers( 1, &id ) );
 			Bind();
 			glBufferData( GL_ARRAY_BUFFER, size, static_cast< const void* >( data ), GL_STATIC_DRAW );
 		}
+		/* For vertices without a C++ type of their own, e.g., MeshUtility::Quantize() output. */
+		VertexBuffer( const std::byte* data, const unsigned int vertex_count, const unsigned int stride );
+		/* Uninitialized storage of the given size, to be filled via Update(); for data that changes often (usage GL_DYNAMIC_DRAW or GL_STREAM_DRAW). */
+		VertexBuffer( const unsigned int size, const GLenum usage );
 		~VertexBuffer();
 
 		void Bind() const;
@@ -26,6 +34,11 @@ namespace Framework
 
 		void CleanUp() const;
 
+		void Update( const void* data, const unsigned int size, const unsigned int offset = 0 ) const;
+		/* Re-specifies the storage with the given size (discarding the contents), so that the driver can hand out fresh memory instead of waiting for
+		 * pending draws that still read the old contents. */
+		void Orphan( const unsigned int new_size );
+
 		inline GLuint ID() const { return id; }
 
 		inline unsigned int Size() const { return size; }
@@ -35,5 +48,6 @@ namespace Framework
 		GLuint id;
 		unsigned int vertex_count;
 		unsigned int size;
+		GLenum usage;
 	};
 }
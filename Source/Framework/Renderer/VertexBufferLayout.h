@@ -1,6 +1,8 @@
 #pragma once
 
 // Framework Includes.
+#include "Math/Quantization.h"
+
 #include "Renderer/Graphics.h"
 #include "Renderer/ShaderTypeInformation.h"
 
@@ -14,8 +16,12 @@ namespace Framework
 		int count;
 		GLenum type;
 		GLboolean normalized;
+		/* 0: Advances per vertex. N > 0: Advances once per N instances (see glVertexAttribDivisor). */
+		unsigned int divisor;
 
 		inline unsigned int GetSizeOfType() const { return Framework::GetSizeOfType( type ); }
+		/* In bytes. Packed types hold all components in a single value. */
+		inline unsigned int GetSize() const { return type == GL_INT_2_10_10_10_REV ? GetSizeOfType() : count * GetSizeOfType(); }
 	};
 
 	class VertexBufferLayout
@@ -29,24 +35,38 @@ namespace Framework
 		inline unsigned int GetStride() const { return stride; };
 		inline std::vector< VertexAttribute > GetAttributes() const { return attribute_list; }
 
+		inline unsigned int GetAttributeCount() const { return ( unsigned int )attribute_list.size(); }
+
+		/* float & int: As is. unsigned char & unsigned short: Normalized to [0, 1] (e.g., RGBA8 colors, uvs).
+		 * Math::Half: GL_HALF_FLOAT. Math::SNorm10_10_10_2: GL_INT_2_10_10_10_REV, normalized to [-1, 1]; count has to be 4.
+		 * Attributes are tightly packed; keep their sizes multiples of 4 bytes (see MeshUtility::Quantize()) for efficient fetching. */
 		template< typename T >
-		void Push( int count )
+		void Push( int count, const unsigned int divisor = 0 )
 		{
 			if constexpr( std::is_same_v< T, float > )
-			{
-				attribute_list.push_back( { count, GL_FLOAT, GL_FALSE } );
-				stride += count * Framework::GetSizeOfType( GL_FLOAT );
-			}
+				attribute_list.push_back( { count, GL_FLOAT, GL_FALSE, divisor } );
 			if constexpr( std::is_same_v< T, int > )
-			{
-				attribute_list.push_back( { count, GL_INT, GL_FALSE } );
-				stride += count * Framework::GetSizeOfType( GL_INT );
-			}
+				attribute_list.push_back( { count, GL_INT, GL_FALSE, divisor } );
 			if constexpr( std::is_same_v< T, unsigned char > )
+				attribute_list.push_back( { count, GL_UNSIGNED_BYTE, GL_TRUE, divisor } );
+			if constexpr( std::is_same_v< T, unsigned short > )
+				attribute_list.push_back( { count, GL_UNSIGNED_SHORT, GL_TRUE, divisor } );
+			if constexpr( std::is_same_v< T, Math::Half > )
+				attribute_list.push_back( { count, GL_HALF_FLOAT, GL_FALSE, divisor } );
+			if constexpr( std::is_same_v< T, Math::SNorm10_10_10_2 > )
 			{
-				attribute_list.push_back( { count, GL_BYTE, GL_TRUE } );
-				stride += count * Framework::GetSizeOfType( GL_BYTE );
+				ASSERT_DEBUG_ONLY( count == 4 && "VertexBufferLayout::Push< Math::SNorm10_10_10_2 >(): count has to be 4." );
+				attribute_list.push_back( { count, GL_INT_2_10_10_10_REV, GL_TRUE, divisor } );
 			}
+
+			stride += attribute_list.back().GetSize();
+		}
+
+		/* For layouts only known at run time, e.g., read from a MeshFile. */
+		void Push( const VertexAttribute& attribute )
+		{
+			attribute_list.push_back( attribute );
+			stride += attribute.GetSize();
 		}
 
 	private:
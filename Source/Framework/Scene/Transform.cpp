@@ -4,68 +4,93 @@
 
 #include "Scene/Transform.h"
 
+// std Includes.
+#include <utility>
+
 namespace Framework
 {
 	Transform::Transform()
 		:
-		scale( Vector3( 1.0f, 1.0f, 1.0f ) ),
-		translation( ZERO_INITIALIZATION ),
-		rotation(),
-		scaling_needsUpdate( true ),
-		rotation_needsUpdate( true ),
-		translation_needsUpdate( true ),
-		final_matrix_needsUpdate( true ),
-		is_dirty( false )
+		index( TransformSystem::Instance().Allocate( Vector3( 1.0f, 1.0f, 1.0f ), Quaternion(), Vector3( ZERO_INITIALIZATION ) ) )
 	{
 	}
 
 	Transform::Transform( const Vector3& scale )
 		:
-		scale( scale ),
-		translation( ZERO_INITIALIZATION ),
-		rotation(),
-		scaling_needsUpdate( true ),
-		rotation_needsUpdate( true ),
-		translation_needsUpdate( true ),
-		final_matrix_needsUpdate( true ),
-		is_dirty( false )
+		index( TransformSystem::Instance().Allocate( scale, Quaternion(), Vector3( ZERO_INITIALIZATION ) ) )
 	{
 	}
 
 	Transform::Transform( const Vector3& scale, const Vector3& translation )
 		:
-		scale( scale ),
-		translation( translation ),
-		rotation(),
-		scaling_needsUpdate( true ),
-		rotation_needsUpdate( true ),
-		translation_needsUpdate( true ),
-		final_matrix_needsUpdate( true ),
-		is_dirty( false )
+		index( TransformSystem::Instance().Allocate( scale, Quaternion(), translation ) )
 	{
 	}
 
 	Transform::Transform( const Vector3& scale, const Quaternion& rotation, const Vector3& translation )
 		:
-		scale( scale ),
-		translation( translation ),
-		rotation( rotation ),
-		scaling_needsUpdate( true ),
-		rotation_needsUpdate( true ),
-		translation_needsUpdate( true ),
-		final_matrix_needsUpdate( true ),
-		is_dirty( false )
+		index( TransformSystem::Instance().Allocate( scale, rotation, translation ) )
 	{
 	}
 
 	Transform::~Transform()
 	{
+		if( index != TransformSystem::INVALID_INDEX )
+			TransformSystem::Instance().Free( index );
+	}
+
+	Transform::Transform( const Transform& other )
+		:
+		index( TransformSystem::Instance().Allocate( other.GetScaling(), other.GetRotation(), other.GetTranslation() ) )
+	{
+		TransformSystem::Instance().SetParent( index, TransformSystem::Instance().GetParent( other.index ) );
+	}
+
+	Transform& Transform::operator=( const Transform& other )
+	{
+		if( this != &other )
+		{
+			if( index == TransformSystem::INVALID_INDEX ) // Moved-from.
+				index = TransformSystem::Instance().Allocate( Vector3( 1.0f, 1.0f, 1.0f ), Quaternion(), Vector3( ZERO_INITIALIZATION ) );
+
+			SetScaling( other.GetScaling() );
+			SetRotation( other.GetRotation() );
+			SetTranslation( other.GetTranslation() );
+			TransformSystem::Instance().SetParent( index, TransformSystem::Instance().GetParent( other.index ) );
+		}
+
+		return *this;
+	}
+
+	Transform::Transform( Transform&& donor ) noexcept
+		:
+		index( std::exchange( donor.index, TransformSystem::INVALID_INDEX ) )
+	{
+	}
+
+	Transform& Transform::operator=( Transform&& donor ) noexcept
+	{
+		if( this != &donor )
+		{
+			if( index != TransformSystem::INVALID_INDEX )
+				TransformSystem::Instance().Free( index );
+
+			index = std::exchange( donor.index, TransformSystem::INVALID_INDEX );
+		}
+
+		return *this;
+	}
+
+	Transform& Transform::SetParent( Transform* parent )
+	{
+		TransformSystem::Instance().SetParent( index, parent ? parent->index : TransformSystem::INVALID_INDEX );
+
+		return *this;
 	}
 
 	Transform& Transform::SetScaling( const Vector3& scale )
 	{
-		this->scale = scale;
-		scaling_needsUpdate = final_matrix_needsUpdate = is_dirty = true;
+		TransformSystem::Instance().SetScaling( index, scale );
 
 		return *this;
 	}
@@ -76,142 +101,89 @@ namespace Framework
 		ASSERT( rotation.IsNormalized() && R"(Transform::SetRotation(): The quaternion "rotation" is not normalized!)" );
 	#endif // _DEBUG
 
-		this->rotation = rotation;
-		rotation_needsUpdate = final_matrix_needsUpdate = is_dirty = true;
+		TransformSystem::Instance().SetRotation( index, rotation );
 
 		return *this;
 	}
 
 	Transform& Transform::SetTranslation( const Vector3& translation )
 	{
-		this->translation = translation;
-		translation_needsUpdate = final_matrix_needsUpdate = is_dirty = true;
+		TransformSystem::Instance().SetTranslation( index, translation );
 
 		return *this;
 	}
 
 	Transform& Transform::OffsetScaling( const Vector3& delta )
 	{
-		return SetScaling( scale + delta );
+		return SetScaling( GetScaling() + delta );
 	}
 
 	Transform& Transform::MultiplyScaling( const Vector3& multiplier )
 	{
-		return SetScaling( scale * multiplier );
+		return SetScaling( GetScaling() * multiplier );
 	}
 
 	Transform& Transform::MultiplyScaling( const float multiplier )
 	{
-		return SetScaling( scale * multiplier );
+		return SetScaling( GetScaling() * multiplier );
 	}
 
 	Transform& Transform::OffsetTranslation( const Vector3& delta )
 	{
-		return SetTranslation( translation + delta );
+		return SetTranslation( GetTranslation() + delta );
 	}
 
 	Transform& Transform::MultiplyTranslation( const Vector3& multiplier )
 	{
-		return SetTranslation( translation * multiplier );
+		return SetTranslation( GetTranslation() * multiplier );
 	}
 
 	Transform& Transform::MultiplyTranslation( const float multiplier )
 	{
-		return SetTranslation( translation * multiplier );
+		return SetTranslation( GetTranslation() * multiplier );
 	}
 
-	const Vector3& Transform::GetScaling() const
+	Vector3 Transform::GetScaling() const
 	{
-		return scale;
+		return TransformSystem::Instance().GetScaling( index );
 	}
 
 	/* Usage: First query whether using this representation or not. */
-	const Quaternion& Transform::GetRotation() const
+	Quaternion Transform::GetRotation() const
 	{
-		return rotation;
+		return TransformSystem::Instance().GetRotation( index );
 	}
 
-	const Vector3& Transform::GetTranslation() const
+	Vector3 Transform::GetTranslation() const
 	{
-		return translation;
+		return TransformSystem::Instance().GetTranslation( index );
 	}
 
-	void Transform::UpdateScalingMatrixIfDirty()
-	{
-		if( scaling_needsUpdate )
-		{
-			scaling_matrix.SetDiagonals( scale );
-			scaling_needsUpdate = false;
-		}
-	}
-
-	void Transform::UpdateRotationPartOfMatrixIfDirty()
-	{
-		if( rotation_needsUpdate )
-		{
-			rotation_and_translation_matrix = Matrix4x4( Math::QuaternionToMatrix3x3( rotation ), rotation_and_translation_matrix.GetRow< 3 >( 3 ) );
-			rotation_needsUpdate = false;
-		}
-	}
-
-	void Transform::UpdateTranslationPartOfMatrixIfDirty()
-	{
-		if( translation_needsUpdate )
-		{
-			rotation_and_translation_matrix.SetTranslation( translation );
-			translation_needsUpdate = false;
-		}
-	}
-
-	void Transform::UpdateFinalMatrixIfDirty()
-	{
-		if( final_matrix_needsUpdate )
-		{
-			final_matrix = GetScalingMatrix() * GetRotationAndTranslationMatrix();
-			final_matrix_needsUpdate = false;
-		}
-	}
-
-	const Matrix4x4& Transform::GetScalingMatrix()
-	{
-		UpdateScalingMatrixIfDirty();
-
-		return scaling_matrix;
-	}
-
-	const Matrix4x4& Transform::GetRotationAndTranslationMatrix()
+	const Matrix4x4& Transform::GetFinalMatrix()
 	{
-		UpdateRotationPartOfMatrixIfDirty();
-		UpdateTranslationPartOfMatrixIfDirty();
-
-		return rotation_and_translation_matrix;
+		return TransformSystem::Instance().GetFinalMatrix( index );
 	}
 
-	const Matrix4x4& Transform::GetFinalMatrix()
+	const Matrix4x4& Transform::GetWorldMatrix()
 	{
-		UpdateFinalMatrixIfDirty();
-
-		return final_matrix;
+		return TransformSystem::Instance().GetWorldMatrix( index );
 	}
 
 	const Matrix4x4 Transform::GetInverseOfFinalMatrix()
 	{
-		/* Instead of actually calculating the inverse of the matrix, we'll leverage the information we have on our two current matrices:
-		 * Scaling Matrix: We can simply use the inverses (with respect to multiplication) of diagonal elements' values to reverse the scaling operation.
-		 * Rotation And Translation Matrix:
-		 *		We can simply transpose the rotation part (upper 3x3 portion of the 4x4 matrix) since rotation matrices are orthogonal.
-		 *		We can simply use the inverses (with respect to addition) of translation elements (first 3 elements of the last row of the 4x4 matrix) to reverse the translation operation.
+		/* Instead of actually calculating the inverse of the matrix, we'll leverage the information we have on our components:
+		 * Scaling: We can simply use the inverses (with respect to multiplication) of scale components to reverse the scaling operation.
+		 * Rotation: We can simply transpose the rotation matrix since rotation matrices are orthogonal.
+		 * Translation: We can simply use the inverses (with respect to addition) of translation components to reverse the translation operation.
 		*/
 
-		// Force-update the matrices to get up-to-date values.
-		GetScalingMatrix();
-		GetRotationAndTranslationMatrix();
+		const Vector3 scale( GetScaling() );
 
-		const Vector4 inverse_scale( 1.0f / scaling_matrix[ 0 ][ 0 ], 1.0f / scaling_matrix[ 1 ][ 1 ], 1.0f / scaling_matrix[ 2 ][ 2 ], 1.0f );
+		const Vector4 inverse_scale( 1.0f / scale.X(), 1.0f / scale.Y(), 1.0f / scale.Z(), 1.0f );
 
 		const Matrix4x4 inverse_scaling_matrix( inverse_scale );
-		const Matrix4x4 inverse_rotation_matrix( rotation_and_translation_matrix.SubMatrix< 3 >().Transposed() );
-		const Matrix4x4 inverse_translation_matrix( Matrix4x4{}.SetTranslation( -rotation_and_translation_matrix.GetRow< 3 >( 3 /* Last Row. */ ) ) );
+		const Matrix4x4 inverse_rotation_matrix( Math::QuaternionToMatrix3x3( GetRotation() ).Transposed() );
+		const Matrix4x4 inverse_translation_matrix( Matrix4x4{}.SetTranslation( -GetTranslation() ) );
 
 		return inverse_translation_matrix * inverse_rotation_matrix * inverse_scaling_matrix;
 	}
@@ -219,36 +191,29 @@ namespace Framework
 	/* If the caller knows there's no scaling involved (for example; Transform of a Camera), calling this function is more preferrable. */
 	const Matrix4x4 Transform::GetInverseOfFinalMatrix_NoScale()
 	{
-		/* Instead of actually calculating the inverse of the matrix, we'll leverage the information we have on our matrix:
-		 * Rotation And Translation Matrix:
-		 *		We can simply transpose the rotation part (upper 3x3 portion of the 4x4 matrix) since rotation matrices are orthogonal.
-		 *		We can simply use the inverses (with respect to addition) of translation elements (first 3 elements of the last row of the 4x4 matrix) to reverse the translation operation.
+		/* Instead of actually calculating the inverse of the matrix, we'll leverage the information we have on our components:
+		 * Rotation: We can simply transpose the rotation matrix since rotation matrices are orthogonal.
+		 * Translation: We can simply use the inverses (with respect to addition) of translation components to reverse the translation operation.
 		*/
 
-		// Force-update the matrices to get up-to-date values.
-		GetRotationAndTranslationMatrix();
-
-		const Matrix4x4 inverse_rotation_matrix( rotation_and_translation_matrix.SubMatrix< 3 >().Transposed() );
-		const Matrix4x4 inverse_translation_matrix( Matrix4x4{}.SetTranslation( -rotation_and_translation_matrix.GetRow< 3 >( 3 /* Last Row. */ ) ) );
+		const Matrix4x4 inverse_rotation_matrix( Math::QuaternionToMatrix3x3( GetRotation() ).Transposed() );
+		const Matrix4x4 inverse_translation_matrix( Matrix4x4{}.SetTranslation( -GetTranslation() ) );
 
 		return inverse_translation_matrix * inverse_rotation_matrix;
 	}
 
-	const Vector3& Transform::Right()
+	Vector3 Transform::Right()
 	{
-		UpdateRotationPartOfMatrixIfDirty();
-		return rotation_and_translation_matrix.GetRow< 3 >( 0 );
+		return Math::QuaternionToMatrix3x3( GetRotation() ).GetRow< 3 >( 0 );
 	}
 
-	const Vector3& Transform::Up()
+	Vector3 Transform::Up()
 	{
-		UpdateRotationPartOfMatrixIfDirty();
-		return rotation_and_translation_matrix.GetRow< 3 >( 1 );
+		return Math::QuaternionToMatrix3x3( GetRotation() ).GetRow< 3 >( 1 );
 	}
 
 	Vector3 Transform::Forward()
 	{
-		UpdateRotationPartOfMatrixIfDirty();
-		return -rotation_and_translation_matrix.GetRow< 3 >( 2 ); // Negates the vector, so can not return reference.
+		return -Math::QuaternionToMatrix3x3( GetRotation() ).GetRow< 3 >( 2 );
 	}
 }
@@ -6,8 +6,11 @@
 #include "Math/Quaternion.hpp"
 #include "Math/Vector.hpp"
 
+#include "Scene/TransformSystem.h"
+
 namespace Framework
 {
+	/* A handle into the TransformSystem::Instance(); the actual data lives in the system's SoA arrays. */
 	class Transform
 	{
 	public:
@@ -17,6 +20,18 @@ namespace Framework
 		Transform( const Vector3& scale, const Quaternion& rotation, const Vector3& translation );
 		~Transform();
 
+		/* Copies allocate a new slot with the same data & parent. */
+		Transform( const Transform& other );
+		Transform& operator= ( const Transform& other );
+
+		/* Moves hand the slot over (children stay attached to it); the donor is left without a slot & can only be destroyed or assigned to. */
+		Transform( Transform&& donor ) noexcept;
+		Transform& operator= ( Transform&& donor ) noexcept;
+
+		/* Pass nullptr to detach from the current parent. The local transform is kept as is; i.e. the world transform changes. */
+		Transform& SetParent( Transform* parent );
+		inline bool HasParent() const { return TransformSystem::Instance().GetParent( index ) != TransformSystem::INVALID_INDEX; }
+
 		Transform& SetScaling( const Vector3& scale );
 		Transform& SetRotation( const Quaternion& quaternion );
 		Transform& SetTranslation( const Vector3& translation );
@@ -29,52 +44,31 @@ namespace Framework
 		Transform& MultiplyTranslation( const Vector3& multiplier );
 		Transform& MultiplyTranslation( const float multiplier );
 
-		const Vector3& GetScaling() const;
-		const Quaternion& GetRotation() const;
-		const Vector3& GetTranslation() const;
+		Vector3 GetScaling() const;
+		Quaternion GetRotation() const;
+		Vector3 GetTranslation() const;
 
+		/* Local matrix; relative to the parent, if there is one. */
 		const Matrix4x4& GetFinalMatrix();
+		/* Final matrix combined with those of all the ancestors. Same as GetFinalMatrix() for transforms without a parent. */
+		const Matrix4x4& GetWorldMatrix();
 		const Matrix4x4 GetInverseOfFinalMatrix();
 		/* If the caller knows there's no scaling involved (for example; Transform of a Camera), calling this function is more preferrable. */
 		const Matrix4x4 GetInverseOfFinalMatrix_NoScale();
 
-		const Vector3& Right();
-		const Vector3& Up();
-		Vector3 Forward(); // Negates the vector, so can not return reference.
-
-		/* This must be reset (via ResetDirtyFlag()) at the beginning of every frame. */
-		inline bool IsDirty() const { return is_dirty; }
-		inline bool ResetDirtyFlag() { return is_dirty = false; }
+		/* Data is stored as components in the TransformSystem, so these can not return references. */
+		Vector3 Right();
+		Vector3 Up();
+		Vector3 Forward();
 
-	private:
-		void UpdateScalingMatrixIfDirty();
-		void UpdateRotationPartOfMatrixIfDirty();
-		void UpdateTranslationPartOfMatrixIfDirty();
-		void UpdateFinalMatrixIfDirty();
+		/* This must be reset (via ResetDirtyFlag()) at the beginning of every frame.
+		 * Once set, it remains set until the beginning of the next frame. Therefore, it reliably tells whether this Transform was modified this frame. */
+		inline bool IsDirty() const { return TransformSystem::Instance().IsModified( index ); }
+		inline bool ResetDirtyFlag() { TransformSystem::Instance().ResetModifiedFlag( index ); return false; }
 
-		const Matrix4x4& GetScalingMatrix();
-		const Matrix4x4& GetRotationAndTranslationMatrix();
+		inline TransformSystem::Index GetIndex() const { return index; }
 
 	private:
-		Vector3 scale;
-		Vector3 translation;
-		Quaternion rotation;
-
-		Matrix4x4 scaling_matrix;
-		Matrix4x4 rotation_and_translation_matrix;
-
-		Matrix4x4 final_matrix;
-
-		/* 4 flags below are for internal (Transform) use. */
-		bool scaling_needsUpdate;
-		bool rotation_needsUpdate;
-		bool translation_needsUpdate;
-
-		bool final_matrix_needsUpdate;
-
-		/* This flag is for external (clients) use. Calls to GetXXXMatrix() APIs may clear the above flags but is_dirty may still be set.
-		 * Once set, it remains set until the beginning of the next frame. Therefore, it reliably tells whether this Transform was modified this frame.
-		 * It is only reset by the ResetDirtyFlag(), which is ideally called at the beginning of every frame. */
-		bool is_dirty;
+		TransformSystem::Index index;
 	};
 }
@@ -0,0 +1,430 @@
+// Framework Includes.
+#include "Scene/TransformSystem.h"
+
+#include "Math/SIMD.h"
+
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <algorithm>
+#include <bit>
+
+namespace Framework
+{
+	TransformSystem::TransformSystem()
+		:
+		hierarchy_order_needsUpdate( false ),
+		world_matrices_needUpdate( false ),
+		capacity( 0 )
+	{
+	}
+
+	TransformSystem::~TransformSystem()
+	{
+	}
+
+	TransformSystem& TransformSystem::Instance()
+	{
+		static TransformSystem transform_system;
+		return transform_system;
+	}
+
+	TransformSystem::Index TransformSystem::Allocate( const Vector3& scale, const Quaternion& rotation, const Vector3& translation )
+	{
+		if( free_index_list.empty() )
+			Grow();
+
+		const Index index = free_index_list.back();
+		free_index_list.pop_back();
+
+		SetBit( alive_bitset, index );
+		parent_list[ index ]		   = INVALID_INDEX;
+		first_child_list[ index ]	   = INVALID_INDEX;
+		next_sibling_list[ index ]	   = INVALID_INDEX;
+		previous_sibling_list[ index ] = INVALID_INDEX;
+
+		/* A new transform is a root without children, so appending it keeps the order valid. */
+		if( !hierarchy_order_needsUpdate )
+			hierarchy_order.push_back( index );
+
+		SetScaling( index, scale );
+		SetRotation( index, rotation );
+		SetTranslation( index, translation );
+
+		ResetModifiedFlag( index ); // New transforms do not count as modified.
+
+		return index;
+	}
+
+	void TransformSystem::Free( const Index index )
+	{
+		/* Children are detached & become roots, keeping their local transforms. */
+		while( first_child_list[ index ] != INVALID_INDEX )
+			SetParent( first_child_list[ index ], INVALID_INDEX );
+
+		SetParent( index, INVALID_INDEX );
+
+		ClearBit( alive_bitset, index );
+		hierarchy_order_needsUpdate = true;
+
+		/* Reset to identity, so that rebuilding the groups this slot belongs to stays well-defined. */
+		SetScaling( index, Vector3( 1.0f, 1.0f, 1.0f ) );
+		SetRotation( index, Quaternion() );
+		SetTranslation( index, Vector3( ZERO_INITIALIZATION ) );
+
+		ResetModifiedFlag( index );
+
+		free_index_list.push_back( index );
+	}
+
+	Vector3 TransformSystem::GetScaling( const Index index ) const
+	{
+		return Vector3( scale_x[ index ], scale_y[ index ], scale_z[ index ] );
+	}
+
+	Quaternion TransformSystem::GetRotation( const Index index ) const
+	{
+		return Quaternion( rotation_x[ index ], rotation_y[ index ], rotation_z[ index ], rotation_w[ index ] );
+	}
+
+	Vector3 TransformSystem::GetTranslation( const Index index ) const
+	{
+		return Vector3( translation_x[ index ], translation_y[ index ], translation_z[ index ] );
+	}
+
+	void TransformSystem::SetScaling( const Index index, const Vector3& scale )
+	{
+		scale_x[ index ] = scale.X();
+		scale_y[ index ] = scale.Y();
+		scale_z[ index ] = scale.Z();
+
+		MarkDirty( index );
+	}
+
+	void TransformSystem::SetRotation( const Index index, const Quaternion& rotation )
+	{
+		rotation_x[ index ] = rotation.X();
+		rotation_y[ index ] = rotation.Y();
+		rotation_z[ index ] = rotation.Z();
+		rotation_w[ index ] = rotation.W();
+
+		MarkDirty( index );
+	}
+
+	void TransformSystem::SetTranslation( const Index index, const Vector3& translation )
+	{
+		translation_x[ index ] = translation.X();
+		translation_y[ index ] = translation.Y();
+		translation_z[ index ] = translation.Z();
+
+		MarkDirty( index );
+	}
+
+	const Matrix4x4& TransformSystem::GetFinalMatrix( const Index index )
+	{
+		if( IsBitSet( dirty_bitset, index ) )
+		{
+			/* Rebuild the whole group; it costs the same as rebuilding a single transform. */
+			const std::size_t first_index = index - index % GROUP_SIZE;
+			RebuildGroup( first_index );
+
+			const std::uint64_t group_mask = ( ( std::uint64_t( 1 ) << GROUP_SIZE ) - 1 ) << ( first_index % BITS_PER_WORD );
+			dirty_bitset[ index / BITS_PER_WORD ] &= ~group_mask;
+		}
+
+		return final_matrix_list[ index ];
+	}
+
+	void TransformSystem::UpdateDirtyFinalMatrices()
+	{
+		/* Below this many bitset words (64 transforms each) per thread, the threading overhead outweighs the gain. */
+		constexpr std::size_t minimum_word_count_per_thread = 64;
+
+		Utility::ThreadPool::Default().ParallelFor( dirty_bitset.size(), minimum_word_count_per_thread, [ this ]( const std::size_t begin, const std::size_t end )
+		{
+			for( std::size_t word_index = begin; word_index < end; word_index++ )
+				if( dirty_bitset[ word_index ] )
+					RebuildWord( word_index );
+		} );
+	}
+
+	void TransformSystem::SetParent( const Index index, const Index parent_index )
+	{
+		const Index parent_index_old = parent_list[ index ];
+
+		if( parent_index_old == parent_index )
+			return;
+
+	#ifdef _DEBUG
+		/* Parenting to a descendant would create a cycle. */
+		for( Index ancestor = parent_index; ancestor != INVALID_INDEX; ancestor = parent_list[ ancestor ] )
+			ASSERT( ancestor != index && R"(TransformSystem::SetParent(): The new parent is a descendant of this transform!)" );
+	#endif // _DEBUG
+
+		if( parent_index_old != INVALID_INDEX )
+		{
+			const Index previous_sibling = previous_sibling_list[ index ];
+			const Index next_sibling	 = next_sibling_list[ index ];
+
+			if( previous_sibling != INVALID_INDEX )
+				next_sibling_list[ previous_sibling ] = next_sibling;
+			else
+				first_child_list[ parent_index_old ] = next_sibling;
+
+			if( next_sibling != INVALID_INDEX )
+				previous_sibling_list[ next_sibling ] = previous_sibling;
+
+			previous_sibling_list[ index ] = next_sibling_list[ index ] = INVALID_INDEX;
+		}
+
+		if( parent_index != INVALID_INDEX )
+		{
+			const Index next_sibling = first_child_list[ parent_index ];
+
+			next_sibling_list[ index ] = next_sibling;
+			if( next_sibling != INVALID_INDEX )
+				previous_sibling_list[ next_sibling ] = index;
+
+			first_child_list[ parent_index ] = index;
+		}
+
+		parent_list[ index ] = parent_index;
+
+		hierarchy_order_needsUpdate = true;
+		MarkWorldDirty( index );
+	}
+
+	const Matrix4x4& TransformSystem::GetWorldMatrix( const Index index )
+	{
+		if( world_matrices_needUpdate )
+			UpdateWorldMatrices();
+
+		return world_matrix_list[ index ];
+	}
+
+	void TransformSystem::UpdateWorldMatrices()
+	{
+		UpdateDirtyFinalMatrices();
+		UpdateHierarchyOrderIfDirty();
+
+		if( !world_matrices_needUpdate )
+			return;
+
+		/* Parents come before their children in the order, so a parent's dirty bit (& world matrix) is always final by the time its children are visited. */
+		for( const Index index : hierarchy_order )
+		{
+			const Index parent_index = parent_list[ index ];
+
+			if( parent_index == INVALID_INDEX )
+			{
+				if( IsBitSet( world_dirty_bitset, index ) )
+					world_matrix_list[ index ] = final_matrix_list[ index ];
+			}
+			else
+			{
+				if( IsBitSet( world_dirty_bitset, parent_index ) )
+					SetBit( world_dirty_bitset, index );
+
+				if( IsBitSet( world_dirty_bitset, index ) )
+					world_matrix_list[ index ] = final_matrix_list[ index ] * world_matrix_list[ parent_index ];
+			}
+		}
+
+		std::fill( world_dirty_bitset.begin(), world_dirty_bitset.end(), 0 );
+		world_matrices_needUpdate = false;
+	}
+
+	void TransformSystem::RebuildAllWorldMatrices()
+	{
+		std::fill( dirty_bitset.begin(), dirty_bitset.end(), ~std::uint64_t( 0 ) );
+		std::fill( world_dirty_bitset.begin(), world_dirty_bitset.end(), ~std::uint64_t( 0 ) );
+		world_matrices_needUpdate = true;
+
+		UpdateWorldMatrices();
+	}
+
+	void TransformSystem::MarkDirty( const Index index )
+	{
+		SetBit( dirty_bitset, index );
+		SetBit( modified_bitset, index );
+
+		MarkWorldDirty( index );
+	}
+
+	void TransformSystem::MarkWorldDirty( const Index index )
+	{
+		SetBit( world_dirty_bitset, index );
+		world_matrices_needUpdate = true;
+	}
+
+	void TransformSystem::UpdateHierarchyOrderIfDirty()
+	{
+		if( !hierarchy_order_needsUpdate )
+			return;
+
+		/* Calculate depths; walk up the parent chain until an ancestor with a known depth is found, then assign the depths on the way back down. */
+		constexpr Index unknown_depth = INVALID_INDEX;
+
+		std::vector< Index > depth_list( capacity, unknown_depth );
+		std::vector< Index > chain;
+		Index max_depth = 0;
+
+		for( Index index = 0; index < Index( capacity ); index++ )
+		{
+			if( !IsBitSet( alive_bitset, index ) || depth_list[ index ] != unknown_depth )
+				continue;
+
+			chain.clear();
+			Index current = index;
+			while( current != INVALID_INDEX && depth_list[ current ] == unknown_depth )
+			{
+				chain.push_back( current );
+				current = parent_list[ current ];
+			}
+
+			Index depth = current == INVALID_INDEX ? 0 : depth_list[ current ] + 1;
+			for( auto iterator = chain.rbegin(); iterator != chain.rend(); iterator++, depth++ )
+				depth_list[ *iterator ] = depth;
+
+			max_depth = std::max( max_depth, depth - 1 );
+		}
+
+		/* Counting sort by depth. */
+		std::vector< Index > depth_offsets( max_depth + 2, 0 );
+		for( Index index = 0; index < Index( capacity ); index++ )
+			if( IsBitSet( alive_bitset, index ) )
+				depth_offsets[ depth_list[ index ] + 1 ]++;
+
+		for( Index depth = 1; depth < Index( depth_offsets.size() ); depth++ )
+			depth_offsets[ depth ] += depth_offsets[ depth - 1 ];
+
+		hierarchy_order.resize( Count() );
+		for( Index index = 0; index < Index( capacity ); index++ )
+			if( IsBitSet( alive_bitset, index ) )
+				hierarchy_order[ depth_offsets[ depth_list[ index ] ]++ ] = index;
+
+		hierarchy_order_needsUpdate = false;
+	}
+
+	void TransformSystem::Grow()
+	{
+		const std::size_t capacity_new = capacity == 0 ? BITS_PER_WORD : capacity * 2;
+
+		for( auto array : { &scale_x, &scale_y, &scale_z } )
+			array->resize( capacity_new, 1.0f );
+		for( auto array : { &rotation_x, &rotation_y, &rotation_z, &translation_x, &translation_y, &translation_z } )
+			array->resize( capacity_new, 0.0f );
+		rotation_w.resize( capacity_new, 1.0f );
+
+		final_matrix_list.resize( capacity_new );
+		world_matrix_list.resize( capacity_new );
+
+		for( auto array : { &parent_list, &first_child_list, &next_sibling_list, &previous_sibling_list } )
+			array->resize( capacity_new, INVALID_INDEX );
+
+		for( auto bitset : { &dirty_bitset, &world_dirty_bitset, &modified_bitset, &alive_bitset } )
+			bitset->resize( capacity_new / BITS_PER_WORD, 0 );
+
+		/* Push in reverse, so that lower indices are handed out first & the arrays stay densely packed at the front. */
+		for( std::size_t index = capacity_new; index-- > capacity; )
+			free_index_list.push_back( Index( index ) );
+
+		capacity = capacity_new;
+	}
+
+	void TransformSystem::RebuildWord( const std::size_t word_index )
+	{
+		constexpr std::uint64_t group_mask = ( std::uint64_t( 1 ) << GROUP_SIZE ) - 1;
+
+		std::uint64_t word = dirty_bitset[ word_index ];
+
+		while( word )
+		{
+			const std::size_t group_bit_offset = std::countr_zero( word ) / GROUP_SIZE * GROUP_SIZE;
+
+			RebuildGroup( word_index * BITS_PER_WORD + group_bit_offset );
+
+			word &= ~( group_mask << group_bit_offset );
+		}
+
+		dirty_bitset[ word_index ] = 0;
+	}
+
+	void TransformSystem::RebuildGroup( const std::size_t first_index )
+	{
+		using namespace Math::SIMD;
+
+		/* Same as Math::QuaternionToMatrix3x3(), with each lane holding a different transform. */
+		const Float4 x = Load( &rotation_x[ first_index ] );
+		const Float4 y = Load( &rotation_y[ first_index ] );
+		const Float4 z = Load( &rotation_z[ first_index ] );
+		const Float4 w = Load( &rotation_w[ first_index ] );
+
+		const Float4 one = Splat( 1.0f );
+		const Float4 two = Splat( 2.0f );
+
+		const Float4 two_x = Multiply( two, x );
+		const Float4 two_y = Multiply( two, y );
+		const Float4 two_z = Multiply( two, z );
+
+		const Float4 two_x2  = Multiply( two_x, x );
+		const Float4 two_y2  = Multiply( two_y, y );
+		const Float4 two_z2  = Multiply( two_z, z );
+		const Float4 two_x_y = Multiply( two_x, y );
+		const Float4 two_x_z = Multiply( two_x, z );
+		const Float4 two_y_z = Multiply( two_y, z );
+		const Float4 two_w_x = Multiply( two_x, w );
+		const Float4 two_w_y = Multiply( two_y, w );
+		const Float4 two_w_z = Multiply( two_z, w );
+
+		/* Final matrix = Scaling matrix * Rotation & Translation matrix; i.e. the rotation rows scaled by the corresponding scale component, followed by the translation row. */
+		const Float4 scale_x_4 = Load( &scale_x[ first_index ] );
+		const Float4 scale_y_4 = Load( &scale_y[ first_index ] );
+		const Float4 scale_z_4 = Load( &scale_z[ first_index ] );
+
+		Float4 row_0[ 4 ] =
+		{
+			Multiply( Subtract( Subtract( one, two_y2 ), two_z2 ), scale_x_4 ),
+			Multiply( Add( two_x_y, two_w_z ), scale_x_4 ),
+			Multiply( Subtract( two_x_z, two_w_y ), scale_x_4 ),
+			Splat( 0.0f )
+		};
+		Float4 row_1[ 4 ] =
+		{
+			Multiply( Subtract( two_x_y, two_w_z ), scale_y_4 ),
+			Multiply( Subtract( Subtract( one, two_x2 ), two_z2 ), scale_y_4 ),
+			Multiply( Add( two_y_z, two_w_x ), scale_y_4 ),
+			Splat( 0.0f )
+		};
+		Float4 row_2[ 4 ] =
+		{
+			Multiply( Add( two_x_z, two_w_y ), scale_z_4 ),
+			Multiply( Subtract( two_y_z, two_w_x ), scale_z_4 ),
+			Multiply( Subtract( Subtract( one, two_x2 ), two_y2 ), scale_z_4 ),
+			Splat( 0.0f )
+		};
+		Float4 row_3[ 4 ] =
+		{
+			Load( &translation_x[ first_index ] ),
+			Load( &translation_y[ first_index ] ),
+			Load( &translation_z[ first_index ] ),
+			one
+		};
+
+		/* Lanes hold transforms & registers hold matrix elements; transposing turns them into matrix rows, one register per transform. */
+		Transpose( row_0[ 0 ], row_0[ 1 ], row_0[ 2 ], row_0[ 3 ] );
+		Transpose( row_1[ 0 ], row_1[ 1 ], row_1[ 2 ], row_1[ 3 ] );
+		Transpose( row_2[ 0 ], row_2[ 1 ], row_2[ 2 ], row_2[ 3 ] );
+		Transpose( row_3[ 0 ], row_3[ 1 ], row_3[ 2 ], row_3[ 3 ] );
+
+		for( std::size_t lane = 0; lane < GROUP_SIZE; lane++ )
+		{
+			float* matrix = final_matrix_list[ first_index + lane ][ 0 ];
+
+			Store( matrix +  0, row_0[ lane ] );
+			Store( matrix +  4, row_1[ lane ] );
+			Store( matrix +  8, row_2[ lane ] );
+			Store( matrix + 12, row_3[ lane ] );
+		}
+	}
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+// Framework Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+#include "Math/Vector.hpp"
+
+// std Includes.
+#include <cstdint>
+#include <vector>
+
+namespace Framework
+{
+	/* Stores the data of all Transforms in SoA (Structure of Arrays) form; one array per component.
+	 * Modifications only set a bit in the dirty bitset; all dirty final (local) matrices are then rebuilt in a single vectorized pass via UpdateDirtyFinalMatrices(),
+	 * 4 transforms at a time (one per SIMD lane).
+	 * Transforms can be parented; world matrices are cached & kept in a depth-sorted flat order, so that UpdateWorldMatrices() can propagate changes down
+	 * the hierarchy in one linear sweep, recomputing only the subtrees whose local transforms (or parent links) changed.
+	 * Transform objects are lightweight handles (indices) into the Instance() of this class. */
+	class TransformSystem
+	{
+	public:
+		using Index = std::uint32_t;
+
+		static constexpr Index INVALID_INDEX = ~Index( 0 );
+
+	public:
+		TransformSystem();
+		~TransformSystem();
+
+		TransformSystem( const TransformSystem& )				= delete;
+		TransformSystem& operator= ( const TransformSystem& )	= delete;
+
+		/* Used by all Transform objects. Created on first use. */
+		static TransformSystem& Instance();
+
+		Index Allocate( const Vector3& scale, const Quaternion& rotation, const Vector3& translation );
+		void Free( const Index index );
+
+		Vector3 GetScaling( const Index index ) const;
+		Quaternion GetRotation( const Index index ) const;
+		Vector3 GetTranslation( const Index index ) const;
+
+		void SetScaling( const Index index, const Vector3& scale );
+		void SetRotation( const Index index, const Quaternion& rotation );
+		void SetTranslation( const Index index, const Vector3& translation );
+
+		/* Rebuilds the final matrix first if it is dirty.
+		 * The returned reference is invalidated by the next Allocate() call, as the storage may grow. */
+		const Matrix4x4& GetFinalMatrix( const Index index );
+
+		/* Rebuilds the final matrices of all dirty transforms. Ideally called once per frame, before the matrices are consumed. */
+		void UpdateDirtyFinalMatrices();
+
+	/* Hierarchy: */
+
+		/* Pass INVALID_INDEX to detach from the current parent. The child keeps its local transform. */
+		void SetParent( const Index index, const Index parent_index );
+		inline Index GetParent( const Index index ) const		{ return parent_list[ index ]; }
+
+		/* Brings all world matrices up to date first, if there are any pending changes.
+		 * The returned reference is invalidated by the next Allocate() call, as the storage may grow. */
+		const Matrix4x4& GetWorldMatrix( const Index index );
+
+		/* Rebuilds dirty final matrices, then sweeps the depth-sorted order once & recomputes the world matrices of changed subtrees only. */
+		void UpdateWorldMatrices();
+		/* Recomputes every final & world matrix, regardless of their dirty state. */
+		void RebuildAllWorldMatrices();
+
+		/* External "modified this frame" flag; see Transform::IsDirty(). */
+		inline bool IsModified( const Index index ) const		{ return IsBitSet( modified_bitset, index ); }
+		inline void ResetModifiedFlag( const Index index )		{ ClearBit( modified_bitset, index ); }
+
+		inline std::size_t Count() const						{ return capacity - free_index_list.size(); }
+		inline std::size_t Capacity() const						{ return capacity; }
+
+	private:
+		static constexpr std::size_t BITS_PER_WORD = 64;
+		static constexpr std::size_t GROUP_SIZE    = 4; // Transforms processed per SIMD pass.
+
+		static bool IsBitSet( const std::vector< std::uint64_t >& bitset, const Index index )	{ return ( bitset[ index / BITS_PER_WORD ] >> ( index % BITS_PER_WORD ) ) & 1; }
+		static void SetBit( std::vector< std::uint64_t >& bitset, const Index index )			{ bitset[ index / BITS_PER_WORD ] |=  ( std::uint64_t( 1 ) << ( index % BITS_PER_WORD ) ); }
+		static void ClearBit( std::vector< std::uint64_t >& bitset, const Index index )			{ bitset[ index / BITS_PER_WORD ] &= ~( std::uint64_t( 1 ) << ( index % BITS_PER_WORD ) ); }
+
+		void MarkDirty( const Index index );
+		void MarkWorldDirty( const Index index );
+
+		/* Re-sorts the hierarchy order by depth (counting sort), so that parents always come before their children. */
+		void UpdateHierarchyOrderIfDirty();
+
+		void Grow();
+
+		/* Rebuilds the final matrices of all transforms in the given dirty bitset word. */
+		void RebuildWord( const std::size_t word_index );
+		/* Rebuilds the final matrices of GROUP_SIZE consecutive transforms, starting from first_index. Does not touch the dirty bits. */
+		void RebuildGroup( const std::size_t first_index );
+
+	private:
+		std::vector< float > scale_x, scale_y, scale_z;
+		std::vector< float > rotation_x, rotation_y, rotation_z, rotation_w;
+		std::vector< float > translation_x, translation_y, translation_z;
+
+		std::vector< Matrix4x4 > final_matrix_list;
+		std::vector< Matrix4x4 > world_matrix_list;
+
+		std::vector< Index > parent_list;
+		/* Children of each transform as a doubly linked list (INVALID_INDEX terminated), so that they can be visited without scanning all transforms
+		 * & unlinked in constant time. */
+		std::vector< Index > first_child_list;
+		std::vector< Index > next_sibling_list;
+		std::vector< Index > previous_sibling_list;
+
+		/* Alive transforms, sorted by depth in the hierarchy. */
+		std::vector< Index > hierarchy_order;
+
+		std::vector< std::uint64_t > dirty_bitset;
+		std::vector< std::uint64_t > world_dirty_bitset;
+		std::vector< std::uint64_t > modified_bitset;
+		std::vector< std::uint64_t > alive_bitset;
+
+		bool hierarchy_order_needsUpdate;
+		bool world_matrices_needUpdate;
+
+		std::vector< Index > free_index_list;
+
+		/* Always a multiple of BITS_PER_WORD, so that all groups & bitset words are complete. */
+		std::size_t capacity;
+	};
+}
@@ -9,6 +9,8 @@
 
 #include "Math/Color.hpp"
 
+#include "Renderer/AsyncTextureLoader.h"
+#include "Renderer/Graphics.h"
 #include "Renderer/Renderer.h"
 
 #include "Utility/ImGuiUtility.h"
@@ -118,6 +120,8 @@ namespace Framework::Test
 
 				Update();
 
+				texture_loader.Update();
+
 				renderer.BeginFrame();
 				Render();
 				renderer.DrawFrame();
@@ -220,6 +224,23 @@ namespace Framework::Test
 				ImGui::Text( "FPS: %.1f fps", 1.0f / time_delta_real );
 				ImGui::Text( "Delta time (multiplied): %.3f ms | Delta time (real): %.3f", time_delta * 1000.0f, time_delta_real * 1000.0f );
 				ImGui::Text( "Time since start: %.3f.", time_since_start );
+
+				const auto& state_changes = renderer.GetStateChangeStatistics();
+				ImGui::Text( "State changes: %zu (Program: %zu | Vertex Array: %zu | Texture: %zu | Uniform Buffer: %zu)",
+							 state_changes.StateChangeCount(), state_changes.program_change_count, state_changes.vertex_array_change_count,
+							 state_changes.texture_change_count, state_changes.uniform_buffer_change_count );
+				ImGui::Text( "Redundant binds skipped: %zu", state_changes.redundant_bind_count );
+				if( !texture_loader.IsIdle() )
+					ImGui::Text( "Textures loading: %zu", texture_loader.PendingCount() );
+				const auto& texture_cache			 = TextureCache::Instance();
+				const auto& texture_cache_statistics = texture_cache.GetStatistics();
+				ImGui::Text( "Texture cache: %zu texture hits | %zu image hits | %zu misses | %zu images (%.1f MB)",
+							 texture_cache_statistics.texture_hit_count, texture_cache_statistics.image_hit_count, texture_cache_statistics.miss_count,
+							 texture_cache.ImageCount(), texture_cache.ImageByteCount() / ( 1024.0f * 1024.0f ) );
+
+				const char* gl_error_check_mode_names[] = { "Disabled", "Debug Output (async)", "Synchronous (glGetError)" };
+				if( int mode = ( int )GetGLErrorCheckMode(); ImGui::Combo( "GL Error Checking", &mode, gl_error_check_mode_names, IM_ARRAYSIZE( gl_error_check_mode_names ) ) )
+					SetGLErrorCheckMode( GLErrorCheckMode( mode ) );
 				ImGui::SliderFloat( "Time Multiplier", &time_multiplier, 0.01f, 5.0f, "x %.2f", ImGuiSliderFlags_Logarithmic ); ImGui::SameLine(); if( ImGui::Button( "Reset##time_multiplier" ) ) time_multiplier = 1.0f;
 				if( !TimeIsFrozen() && ImGui::Button( "Pause" ) )
 					FreezeTime();
@@ -243,6 +264,8 @@ namespace Framework::Test
 		Transform camera_transform;
 		Camera camera;
 		Renderer renderer;
+		/* Textures requested through it are uploaded over the following frames, before rendering. */
+		AsyncTextureLoader texture_loader;
 		std::string name;
 
 		bool display_frame_statistics;
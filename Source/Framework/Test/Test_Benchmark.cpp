@@ -0,0 +1,83 @@
+// Framework Includes.
+#include "Benchmark/Benchmark_Math.h"
+#include "Benchmark/Benchmark_Mesh.h"
+#include "Benchmark/Benchmark_Renderer.h"
+#include "Benchmark/Benchmark_Scene.h"
+#include "Benchmark/Benchmark_Texture.h"
+
+#include "Test/Test_Benchmark.h"
+
+namespace Framework::Test
+{
+	Test_Benchmark::Test_Benchmark()
+	{
+		Register( "Matrix4x4 Multiplication", Benchmark::Matrix4x4Multiplication );
+		Register( "Batch Transform", Benchmark::BatchTransform );
+		Register( "Frustum Culling", Benchmark::FrustumCulling );
+		Register( "Bounding Volume Hierarchy", Benchmark::BoundingVolumeHierarchyQueries );
+		Register( "Transform Update", Benchmark::TransformUpdate );
+		Register( "Transform Hierarchy Update", Benchmark::TransformHierarchyUpdate );
+		Register( "Uniform Setters", Benchmark::UniformSetters );
+		Register( "Camera Uniforms", Benchmark::CameraUniforms );
+		Register( "Material Switching", Benchmark::MaterialSwitching );
+		Register( "Render Queue", Benchmark::RenderQueueSorting );
+		Register( "State Cache", Benchmark::StateCacheRedundancy );
+		Register( "GLCALL Overhead", Benchmark::GLCallOverhead );
+		Register( "Instancing", Benchmark::Instancing );
+		Register( "Streaming Uploads", Benchmark::StreamingUploads );
+		Register( "Mesh Welding", Benchmark::MeshWelding );
+		Register( "Vertex Cache Optimization", Benchmark::VertexCacheOptimization );
+		Register( "Vertex Quantization", Benchmark::VertexQuantization );
+		Register( "Mesh Loading", Benchmark::MeshLoading );
+		Register( "Mesh Import", Benchmark::MeshImport );
+		Register( "Texture Loading", Benchmark::TextureLoading );
+		Register( "Texture Cache", Benchmark::TextureCaching );
+		Register( "Texture Compression", Benchmark::TextureEncoding );
+		Register( "Mipmap Generation", Benchmark::MipmapGeneration );
+		Register( "Texture Atlas", Benchmark::TextureAtlasPacking );
+	}
+
+	void Test_Benchmark::OnRenderImGui()
+	{
+		ImGuiUtility::SetNextWindowPos( ImGuiUtility::HorizontalWindowPositioning::CENTER, ImGuiUtility::VerticalWindowPositioning::CENTER, ImGuiCond_FirstUseEver );
+		if( ImGui::Begin( "Benchmarks", nullptr, CurrentImGuiWindowFlags() | ImGuiWindowFlags_AlwaysAutoResize ) )
+		{
+			for( auto& entry : benchmark_list )
+			{
+				ImGui::PushID( entry.name.c_str() );
+
+				if( ImGui::Button( "Run" ) )
+					entry.results = entry.run();
+				ImGui::SameLine();
+				ImGui::SeparatorText( entry.name.c_str() );
+
+				if( !entry.results.empty() && ImGui::BeginTable( "Results", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit ) )
+				{
+					ImGui::TableSetupColumn( "Case" );
+					ImGui::TableSetupColumn( "Time (ms)" );
+					ImGui::TableSetupColumn( "Detail" );
+					ImGui::TableHeadersRow();
+
+					for( const auto& result : entry.results )
+					{
+						ImGui::TableNextRow();
+						ImGui::TableNextColumn(); ImGui::TextUnformatted( result.label.c_str() );
+						ImGui::TableNextColumn(); ImGui::Text( "%.3f", result.milliseconds );
+						ImGui::TableNextColumn(); ImGui::TextUnformatted( result.detail.c_str() );
+					}
+
+					ImGui::EndTable();
+				}
+
+				ImGui::PopID();
+			}
+		}
+
+		ImGui::End();
+	}
+
+	void Test_Benchmark::Register( const std::string& name, std::function< Benchmark::ResultList() > run )
+	{
+		benchmark_list.push_back( { name, std::move( run ), {} } );
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// Framework Includes.
+#include "Benchmark/Benchmark.h"
+
+#include "Test/Test.hpp"
+
+// std Includes.
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Framework::Test
+{
+	/* Lists the CPU-side micro-benchmarks & runs them on demand. Results are displayed until the benchmark is re-run. */
+	class Test_Benchmark : public Test< Test_Benchmark >
+	{
+		friend Test< Test_Benchmark >;
+
+		struct Entry
+		{
+			std::string name;
+			std::function< Benchmark::ResultList() > run;
+			Benchmark::ResultList results;
+		};
+
+	public:
+		Test_Benchmark();
+
+	protected:
+		void OnRenderImGui();
+
+	private:
+		void Register( const std::string& name, std::function< Benchmark::ResultList() > run );
+
+	private:
+		std::vector< Entry > benchmark_list;
+	};
+}
@@ -36,17 +36,17 @@ namespace Framework::Test
 
 		material = std::make_unique< Material >( shader.get() );
 
-		/* This test does not use a Drawable as the Drawable (currently) sets the view matrix by querying it from the Camera, which may or may not be set directly in this test
-		 * (i.e., constructed by other means & uploaded to shader in OnRender() ). Using a Drawable would cause the view matrix to be set again on Submit() & lead to incorrect behaviour. */
+		/* This test does not use a Drawable as the Renderer (currently) uploads the view matrix by querying it from the Camera, which may or may not be set directly in this test
+		 * (i.e., constructed by other means & uploaded in OnRender() ). Using a Drawable would cause the view matrix to be uploaded again in DrawFrame() & lead to incorrect behaviour. */
 		/*cube_1 = std::make_unique< Drawable >( material.get(), &cube_transform, cube_vertex_array.get() );
 
 		renderer.AddDrawable( cube_1.get() );*/
 
 		renderer.SetPolygonMode( PolygonMode::FILL );
 
-		texture_test_cube = std::make_unique< Texture >( "Asset/Texture/test_tex_cube.png", GL_RGBA );
+		texture_test_cube = texture_loader.Load( "Asset/Texture/test_tex_cube.png", GL_RGBA );
 
-		texture_test_cube->ActivateAndBind( GL_TEXTURE0 );
+		material->SetTexture( 0, texture_test_cube.get() );
 
 		shader->Bind();
 		material->SetTextureSampler2D( "texture_sampler_1", 0 );
@@ -90,12 +90,14 @@ namespace Framework::Test
 
 		const auto lookAt_direction( ( target - camera_position ).Normalized() );
 
+		Matrix4x4 view_matrix;
+
 		if( method_lookAt == LookAtMethod::LookAtMatrix )
 		{
-			material->SetMatrix( "transform_view", Matrix::LookAt( camera_position, lookAt_direction,
-																	  rotation_plane == RotationPlane::ZX
-																		? Vector3::Up()
-																		: Math::Cross( Vector3::Right(), lookAt_direction ).Normalize() ) );
+			view_matrix = Matrix::LookAt( camera_position, lookAt_direction,
+										  rotation_plane == RotationPlane::ZX
+											? Vector3::Up()
+											: Math::Cross( Vector3::Right(), lookAt_direction ).Normalize() );
 		}
 		else if( method_lookAt == LookAtMethod::QuaternionLookRotation ) // Alternatively, we can also take the inverse of the camera object's transform matrix, yielding the same result.
 		{
@@ -104,7 +106,7 @@ namespace Framework::Test
 																		? Vector3::Up()
 																		: Math::Cross( Vector3::Right(), lookAt_direction ).Normalize() ) );
 
-			material->SetMatrix( "transform_view", camera_transform.GetInverseOfFinalMatrix() );
+			view_matrix = camera_transform.GetInverseOfFinalMatrix();
 		}
 		else if( method_lookAt == LookAtMethod::QuaternionLookRotation_Naive )
 		{
@@ -113,7 +115,7 @@ namespace Framework::Test
 																			? Vector3::Up()
 																			: Math::Cross( Vector3::Right(), lookAt_direction ).Normalize() ) );
 
-			material->SetMatrix( "transform_view", camera_transform.GetInverseOfFinalMatrix() );
+			view_matrix = camera_transform.GetInverseOfFinalMatrix();
 		}
 		else if( method_lookAt == LookAtMethod::ManualRotationViaQuaternionSlerp )
 		{
@@ -127,7 +129,7 @@ namespace Framework::Test
 																			time_mod_2_pi / Constants< float >::Pi() ) );
 			const auto translation = Vector3::Forward() / zoom; // Moving the scene away (i.e, toward -Z) = inverse of zooming the camera out (i.e, moving toward +Z).
 
-			material->SetMatrix( "transform_view", Matrix4x4( rotation, translation ) ); // Create the view matrix from the viewpoint of the scene objects' transformation.
+			view_matrix = Matrix4x4( rotation, translation ); // Create the view matrix from the viewpoint of the scene objects' transformation.
 		}
 		else if( method_lookAt == LookAtMethod::ManualRotationViaEulerToQuaternion )
 		{
@@ -136,20 +138,18 @@ namespace Framework::Test
 										: Math::EulerToMatrix3x3( 0_deg, 360_deg * time_mod_2_pi / Constants< float >::Two_Pi(), 0_deg ); // Counter-clockwise rotation of the scene = clockwise rotation of the camera.
 			const auto translation = Vector3::Forward() / zoom; // Moving the scene away (i.e, toward -Z) = inverse of zooming the camera out (i.e, moving toward +Z).
 
-			material->SetMatrix( "transform_view", Matrix4x4( rotation, translation ) ); // Create the view matrix from the viewpoint of the scene objects' transformation.
+			view_matrix = Matrix4x4( rotation, translation ); // Create the view matrix from the viewpoint of the scene objects' transformation.
 		}
 
 		/* For this test, "manually" issue a draw call for the cube, as we can not use a Drawable for the reasons stated above. */
 
-		material->SetMatrix( "transform_projection", camera.GetProjectionMatrix() );
+		renderer.UpdateCameraUniforms( view_matrix, camera.GetProjectionMatrix() );
 
 		cube_vertex_array->Bind();
-		shader->Bind();
+		material->Bind();
 
 		material->SetMatrix( "transform_world",	cube_transform.GetFinalMatrix() );
 
-		material->SetMatrix( "transform_projection", camera.GetProjectionMatrix() );
-
 		GLCALL( glDrawArrays( GL_TRIANGLES, 0, cube_vertex_array->VertexCount() ) );
 	}
 
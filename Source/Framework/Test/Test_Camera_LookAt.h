@@ -34,7 +34,7 @@ namespace Framework::Test
 		/* This test does not use a Drawable as the Drawable (currently) sets the view matrix by querying it from the Camera, which may or may not be set directly in this test
 		 * (i.e., constructed by some other means and uploaded to shader on OnRender() ). Using a Drawable would cause the view matrix to be set again and lead to incorrect behaviour. */
 		//std::unique_ptr< Drawable > cube_1;
-		std::unique_ptr< Texture > texture_test_cube;
+		std::shared_ptr< Texture > texture_test_cube;
 
 		Transform cube_transform;
 
@@ -29,23 +29,24 @@ namespace Framework::Test
 		shader   = std::make_unique< Shader >( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
 		material = std::make_unique< Material >( shader.get() );
 
-		constexpr auto vertices = MeshUtility::Interleave( Primitives::Cube::Positions, Primitives::Cube::UVs_CubeMap );
+		const auto cube_mesh = MeshUtility::BuildIndexed( Primitives::Cube::Positions, Primitives::Cube::UVs_CubeMap );
 
-		VertexBuffer vertex_buffer( vertices.data(), static_cast< unsigned int >( vertices.size() ) );
+		VertexBuffer vertex_buffer( cube_mesh.vertices.data(), static_cast< unsigned int >( cube_mesh.vertices.size() ) );
+		cube_index_buffer = std::make_unique< IndexBuffer >( cube_mesh.indices );
 
 		VertexBufferLayout vertex_buffer_layout;
 		vertex_buffer_layout.Push< float >( 3 ); // NDC positions.
 		vertex_buffer_layout.Push< float >( 2 ); // Tex. coords.
 		//vertex_buffer_layout.Push< float >( 4 ); // Vertex colors.
-		cube_vertex_array = std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout );
+		cube_vertex_array = std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout, cube_index_buffer.get() );
 
 		cube_1 = std::make_unique< Drawable >( material.get(), &cube_transform, cube_vertex_array.get() );
 
 		renderer.AddDrawable( cube_1.get() );
 		renderer.SetPolygonMode( PolygonMode::FILL );
 
-		texture_test_cube = std::make_unique< Texture >( "Asset/Texture/test_tex_cube.png", GL_RGBA );
-		texture_test_cube->ActivateAndBind( GL_TEXTURE0 ); // Above line may bind the texture to whatever texture slot was active before, so more than 1 slots may be bound to this texture.
+		texture_test_cube = texture_loader.Load( "Asset/Texture/test_tex_cube.png", GL_RGBA );
+		material->SetTexture( 0, texture_test_cube.get() );
 
 		shader->Bind();
 
@@ -129,12 +130,6 @@ namespace Framework::Test
 		camera_transform.OffsetTranslation( camera_delta_position );
 	}
 
-	void Test_Camera_WalkAround::OnRender()
-	{
-		material->SetMatrix( "transform_view",		  camera.GetViewMatrix() );
-		material->SetMatrix( "transform_projection", camera.GetProjectionMatrix() );
-	}
-
 	void Test_Camera_WalkAround::OnRenderImGui()
 	{
 		if( ImGui::Begin( "Test: Camera ", nullptr, CurrentImGuiWindowFlags() | ImGuiWindowFlags_AlwaysAutoResize ) )
@@ -28,7 +28,6 @@ namespace Framework::Test
 		void OnKeyboardEvent( const Platform::KeyCode key_code, const Platform::KeyAction action, const Platform::KeyMods mods );
 		void OnProcessInput();
 		void OnUpdate();
-		void OnRender();
 		void OnRenderImGui();
 
 		void ResetCameraTranslation();
@@ -36,11 +35,12 @@ namespace Framework::Test
 		float ResetCameraMoveSpeed();
 
 	private:
+		std::unique_ptr< IndexBuffer > cube_index_buffer; // Has to outlive the vertex array.
 		std::unique_ptr< VertexArray > cube_vertex_array;
 		std::unique_ptr< Shader > shader;
 		std::unique_ptr< Material > material;
 		std::unique_ptr< Drawable > cube_1;
-		std::unique_ptr< Texture > texture_test_cube;
+		std::shared_ptr< Texture > texture_test_cube;
 
 		Transform cube_transform;
 
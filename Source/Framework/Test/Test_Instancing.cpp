@@ -0,0 +1,105 @@
+// Framework Includes.
+#include "Math/Matrix.h"
+
+#include "Renderer/MeshUtility.hpp"
+#include "Renderer/Primitive/Primitive_Cube.h"
+
+#include "Test_Instancing.h"
+
+using namespace Framework::Math::Literals;
+
+namespace Framework::Test
+{
+	Test_Instancing::Test_Instancing()
+		:
+		camera_orbit_radius( 250.0f ),
+		camera_orbit_height( 80.0f ),
+		hovered_cube_index( -1 ),
+		animate_cubes( true )
+	{
+		shader   = std::make_unique< Shader >( "Source/Asset/Shader/textured_mix_instanced.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix (Instanced)" );
+		material = std::make_unique< Material >( shader.get() );
+
+		const auto cube_mesh = MeshUtility::BuildIndexed( Primitives::Cube::Positions, Primitives::Cube::UVs_CubeMap );
+
+		VertexBuffer vertex_buffer( cube_mesh.vertices.data(), static_cast< unsigned int >( cube_mesh.vertices.size() ) );
+		cube_index_buffer = std::make_unique< IndexBuffer >( cube_mesh.indices );
+
+		VertexBufferLayout vertex_buffer_layout;
+		vertex_buffer_layout.Push< float >( 3 ); // NDC positions.
+		vertex_buffer_layout.Push< float >( 2 ); // Tex. coords.
+		cube_vertex_array = std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout, cube_index_buffer.get() );
+		cube_vertex_array->SetBounds( Math::AABB::FromPoints( Primitives::Cube::Positions ) );
+
+		texture_test_cube = texture_loader.Load( "Asset/Texture/test_tex_cube.png", GL_RGBA );
+		material->SetTexture( 0, texture_test_cube.get() );
+
+		shader->Bind();
+		material->SetTextureSampler2D( "texture_sampler_1", 0 );
+		material->SetTextureSampler2D( "texture_sampler_2", 0 );
+
+		/* Drawables & the Renderer hold pointers into these; reserve up-front so that they never re-allocate. */
+		cube_transform_list.reserve( CUBE_COUNT );
+		cube_drawable_list.reserve( CUBE_COUNT );
+
+		const Vector3 grid_origin( -( GRID_SIZE_X - 1 ) * CUBE_SPACING / 2.0f, -( GRID_SIZE_Y - 1 ) * CUBE_SPACING / 2.0f, -( GRID_SIZE_Z - 1 ) * CUBE_SPACING / 2.0f );
+		for( int x = 0; x < GRID_SIZE_X; x++ )
+			for( int y = 0; y < GRID_SIZE_Y; y++ )
+				for( int z = 0; z < GRID_SIZE_Z; z++ )
+				{
+					cube_transform_list.emplace_back( Vector3::One(), grid_origin + Vector3( float( x ), float( y ), float( z ) ) * CUBE_SPACING );
+					cube_drawable_list.emplace_back( material.get(), &cube_transform_list.back(), cube_vertex_array.get() );
+					renderer.AddStaticDrawable( &cube_drawable_list.back() );
+				}
+
+		renderer.SetPolygonMode( PolygonMode::FILL );
+
+		camera.SetFarPlaneOffset( 1000.0f );
+	}
+
+	void Test_Instancing::OnUpdate()
+	{
+		/* Orbit around the grid, looking at its center. */
+		const Vector3 camera_position( time_cos * camera_orbit_radius, camera_orbit_height, time_sin * camera_orbit_radius );
+		camera_transform.SetTranslation( camera_position );
+		camera_transform.SetRotation( Quaternion::LookRotation( ( -camera_position ).Normalized(), Vector3::Up() ) );
+
+		if( animate_cubes )
+		{
+			const Quaternion rotation( time_sin * 180.0_deg, Vector3::Up() );
+			for( auto& transform : cube_transform_list )
+				transform.SetRotation( rotation );
+
+			/* Rotating in place keeps the cubes' neighbors; no need for a rebuild. */
+			renderer.RefitStaticDrawables();
+		}
+
+		/* Against the bounds of the last frame. The cursor is in screen coordinates; normalized by the window size, not the framebuffer's. */
+		const auto [ cursor_x, cursor_y ] = Platform::GetMouseCursorPositions();
+		const float window_width  = float( Platform::GetWindowWidthInScreenCoordinates() );
+		const float window_height = float( Platform::GetWindowHeightInScreenCoordinates() );
+		const Drawable* hovered_cube = renderer.PickStaticDrawable( camera.ScreenPointToRay( cursor_x, cursor_y, window_width, window_height ) );
+		hovered_cube_index = hovered_cube ? int( hovered_cube - cube_drawable_list.data() ) : -1;
+	}
+
+	void Test_Instancing::OnRenderImGui()
+	{
+		if( ImGui::Begin( "Test: Instancing", nullptr, CurrentImGuiWindowFlags() | ImGuiWindowFlags_AlwaysAutoResize ) )
+		{
+			ImGui::Text( "Cubes: %d | Draw calls: %u", CUBE_COUNT, renderer.GetDrawCallCount() );
+			const auto& culling_statistics = renderer.GetCullingStatistics();
+			ImGui::Text( "Visible: %u | Culled: %u", culling_statistics.visible_count, culling_statistics.culled_count );
+			ImGui::Text( "Hovered cube: %d", hovered_cube_index );
+
+			bool is_frustum_culling_enabled = renderer.IsFrustumCullingEnabled();
+			if( ImGui::Checkbox( "Frustum Culling", &is_frustum_culling_enabled ) )
+				renderer.SetFrustumCulling( is_frustum_culling_enabled );
+
+			ImGui::Checkbox( "Animate Cubes", &animate_cubes );
+			ImGui::SliderFloat( "Orbit Radius", &camera_orbit_radius, 50.0f, 500.0f );
+			ImGui::SliderFloat( "Orbit Height", &camera_orbit_height, -200.0f, 200.0f );
+		}
+
+		ImGui::End();
+	}
+}
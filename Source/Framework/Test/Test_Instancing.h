@@ -0,0 +1,48 @@
+#pragma once
+
+// Framework Includes.
+#include "Renderer/Drawable.h"
+#include "Renderer/Material.h"
+#include "Renderer/Texture.h"
+
+#include "Test/Test.hpp"
+
+// std Includes.
+#include <memory>
+#include <vector>
+
+namespace Framework::Test
+{
+	/* 100K cubes sharing a VertexArray & a Material of an instanced shader; the Renderer draws them with a single instanced draw call.
+	 * They are static Drawables, culled through the Renderer's hierarchy (refitted while they rotate) & picked under the mouse cursor. */
+	class Test_Instancing : public Test< Test_Instancing >
+	{
+		friend Test< Test_Instancing >;
+
+	public:
+		Test_Instancing();
+
+	protected:
+		void OnUpdate();
+		void OnRenderImGui();
+
+	private:
+		static constexpr int GRID_SIZE_X = 100, GRID_SIZE_Y = 10, GRID_SIZE_Z = 100;
+		static constexpr int CUBE_COUNT = GRID_SIZE_X * GRID_SIZE_Y * GRID_SIZE_Z;
+		static constexpr float CUBE_SPACING = 3.0f;
+
+		std::unique_ptr< IndexBuffer > cube_index_buffer; // Has to outlive the vertex array.
+		std::unique_ptr< VertexArray > cube_vertex_array;
+		std::unique_ptr< Shader > shader;
+		std::unique_ptr< Material > material;
+		std::shared_ptr< Texture > texture_test_cube;
+
+		std::vector< Transform > cube_transform_list;
+		std::vector< Drawable > cube_drawable_list;
+
+		float camera_orbit_radius;
+		float camera_orbit_height;
+		int hovered_cube_index;
+		bool animate_cubes;
+	};
+}
@@ -16,15 +16,16 @@ namespace Framework::Test
 
 		shader = std::make_unique< Shader >( "Source/Asset/Shader/textured_mix.vertex", "Source/Asset/Shader/textured_mix.fragment", "Textured Mix" );
 
-		constexpr auto vertices = MeshUtility::Interleave( Primitives::Cube::Positions, Primitives::Cube::UVs, Primitives::Cube::VertexColors );
+		const auto cube_mesh = MeshUtility::BuildIndexed( Primitives::Cube::Positions, Primitives::Cube::UVs, Primitives::Cube::VertexColors );
 
-		VertexBuffer vertex_buffer( vertices.data(), static_cast< unsigned int >( vertices.size() ) );
+		VertexBuffer vertex_buffer( cube_mesh.vertices.data(), static_cast< unsigned int >( cube_mesh.vertices.size() ) );
+		cube_index_buffer = std::make_unique< IndexBuffer >( cube_mesh.indices );
 
 		VertexBufferLayout vertex_buffer_layout;
 		vertex_buffer_layout.Push< float >( 3 ); // NDC positions.
 		vertex_buffer_layout.Push< float >( 2 ); // Tex. coords.
 		vertex_buffer_layout.Push< float >( 4 ); // Vertex colors.
-		cube_vertex_array = std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout );
+		cube_vertex_array = std::make_unique< VertexArray >( vertex_buffer, vertex_buffer_layout, cube_index_buffer.get() );
 
 		cube_material = std::make_unique< Material >( shader.get() );
 
@@ -35,11 +36,11 @@ namespace Framework::Test
 		renderer.AddDrawable( cube_2.get() );
 		renderer.SetPolygonMode( PolygonMode::FILL );
 
-		texture_container    = std::make_unique< Texture >( "Asset/Texture/container.jpg", GL_RGB );
-		texture_awesome_face = std::make_unique< Texture >( "Asset/Texture/awesomeface.png", GL_RGBA );
+		texture_container    = texture_loader.Load( "Asset/Texture/container.jpg", GL_RGB );
+		texture_awesome_face = texture_loader.Load( "Asset/Texture/awesomeface.png", GL_RGBA );
 
-		texture_container->ActivateAndBind( GL_TEXTURE0 );
-		texture_awesome_face->ActivateAndBind( GL_TEXTURE1 );
+		cube_material->SetTexture( 0, texture_container.get() );
+		cube_material->SetTexture( 1, texture_awesome_face.get() );
 
 		shader->Bind();
 		shader->SetTextureSampler2D( "texture_sampler_1", 0 );
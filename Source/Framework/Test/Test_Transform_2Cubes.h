@@ -24,13 +24,14 @@ namespace Framework::Test
 		void OnUpdate();
 
 	private:
+		std::unique_ptr< IndexBuffer > cube_index_buffer; // Has to outlive the vertex array.
 		std::unique_ptr< VertexArray > cube_vertex_array;
 		std::unique_ptr< Shader > shader;
 		std::unique_ptr< Material > cube_material;
 		std::unique_ptr< Drawable > cube_1;
 		std::unique_ptr< Drawable > cube_2;
-		std::unique_ptr< Texture > texture_container;
-		std::unique_ptr< Texture > texture_awesome_face;
+		std::shared_ptr< Texture > texture_container;
+		std::shared_ptr< Texture > texture_awesome_face;
 
 		Transform cube_1_transform;
 		Transform cube_2_transform;
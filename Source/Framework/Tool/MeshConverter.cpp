@@ -0,0 +1,124 @@
+// Framework Includes.
+#include "Renderer/MeshFile.h"
+#include "Renderer/MeshImporter.h"
+#include "Renderer/MeshUtility.hpp"
+
+#include "Tool/MeshConverter.h"
+
+// std Includes.
+#include <chrono>
+#include <iostream>
+#include <string_view>
+
+namespace Framework::Tool
+{
+	namespace
+	{
+		void Optimize( MeshData& mesh_data )
+		{
+			MeshUtility::OptimizeVertexCache( mesh_data.indices, mesh_data.vertex_count );
+			const auto remap = MeshUtility::OptimizeVertexFetch( mesh_data.indices, mesh_data.vertex_count );
+			MeshUtility::RemapVertices( mesh_data.vertex_data, mesh_data.layout.GetStride(), remap );
+		}
+
+		/* Expects the importer's layout: float positions, then normals (3 components) &/or uvs (2 components) if present. */
+		void Quantize( MeshData& mesh_data )
+		{
+			using namespace MeshUtility;
+
+			const float* vertices = reinterpret_cast< const float* >( mesh_data.vertex_data.data() );
+			const unsigned int component_count = mesh_data.layout.GetStride() / sizeof( float );
+
+			std::vector< AttributeQuantization > attribute_quantization_list;
+			std::vector< const char* > attribute_name_list;
+			unsigned int component_offset = 0;
+			for( const auto& attribute : mesh_data.layout.GetAttributes() )
+			{
+				const unsigned int attribute_component_count = ( unsigned int )attribute.count;
+
+				if( component_offset == 0 )
+				{
+					attribute_quantization_list.push_back( { attribute_component_count, AttributeFormat::Half } );
+					attribute_name_list.push_back( "position" );
+				}
+				else if( attribute_component_count == 3 )
+				{
+					attribute_quantization_list.push_back( { attribute_component_count, AttributeFormat::SNorm10_10_10_2 } );
+					attribute_name_list.push_back( "normal" );
+				}
+				else
+				{
+					bool uvs_are_in_unit_range = true;
+					for( unsigned int vertex_index = 0; vertex_index < mesh_data.vertex_count && uvs_are_in_unit_range; vertex_index++ )
+						for( unsigned int i = 0; i < attribute_component_count; i++ )
+						{
+							const float uv = vertices[ vertex_index * component_count + component_offset + i ];
+							uvs_are_in_unit_range = uvs_are_in_unit_range && uv >= 0.0f && uv <= 1.0f;
+						}
+
+					attribute_quantization_list.push_back( { attribute_component_count, uvs_are_in_unit_range ? AttributeFormat::UNorm16 : AttributeFormat::Half } );
+					attribute_name_list.push_back( "uv" );
+				}
+
+				component_offset += attribute_component_count;
+			}
+
+			auto quantized_vertices = MeshUtility::Quantize( vertices, mesh_data.vertex_count, component_count, attribute_quantization_list );
+
+			std::cout << "Quantized: " << mesh_data.layout.GetStride() << " -> " << quantized_vertices.layout.GetStride() << " bytes/vertex; largest errors:";
+			for( std::size_t i = 0; i < attribute_name_list.size(); i++ )
+				std::cout << " " << attribute_name_list[ i ] << " " << quantized_vertices.max_error_list[ i ];
+			std::cout << "\n";
+
+			mesh_data.vertex_data = std::move( quantized_vertices.data );
+			mesh_data.layout	  = quantized_vertices.layout;
+		}
+	}
+
+	int RunMeshConverter( const int argument_count, const char* const* arguments )
+	{
+		if( argument_count < 4 )
+		{
+			std::cerr << "Usage: " << arguments[ 0 ] << " --convert-mesh <input.obj/.gltf/.glb> <output.mesh> [--optimize] [--quantize]\n";
+			return 1;
+		}
+
+		const std::string input_file_path( arguments[ 2 ] ), output_file_path( arguments[ 3 ] );
+
+		bool optimize = false, quantize = false;
+		for( int i = 4; i < argument_count; i++ )
+		{
+			const std::string_view option( arguments[ i ] );
+			if( option == "--optimize" )
+				optimize = true;
+			else if( option == "--quantize" )
+				quantize = true;
+			else
+			{
+				std::cerr << "ERROR::MESH_CONVERTER::UNKNOWN_OPTION: " << option << "\n";
+				return 1;
+			}
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		auto mesh_data = MeshImporter::Import( input_file_path );
+		if( !mesh_data )
+			return 1;
+
+		std::cout << "Imported " << input_file_path << ": " << mesh_data->vertex_count << " vertices, " << mesh_data->indices.size() / 3 << " triangles\n";
+
+		if( optimize )
+			Optimize( *mesh_data );
+		if( quantize )
+			Quantize( *mesh_data );
+
+		if( !MeshFile::Write( output_file_path, *mesh_data ) )
+			return 1;
+
+		const auto milliseconds = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+		std::cout << "Wrote " << output_file_path << " in " << milliseconds << " ms\n";
+
+		return 0;
+	}
+}
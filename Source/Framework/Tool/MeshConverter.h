@@ -0,0 +1,10 @@
+#pragma once
+
+namespace Framework::Tool
+{
+	/* Command line: --convert-mesh <input.obj/.gltf/.glb> <output.mesh> [--optimize] [--quantize]
+	 *	--optimize: Reorders triangles & vertices for the post-transform cache & vertex fetch (MeshUtility::Optimize()).
+	 *	--quantize: Half positions, SNorm10_10_10_2 normals & UNorm16 uvs (Half uvs if any of them is outside [0, 1]); prints the largest errors.
+	 * Returns the process exit code. */
+	int RunMeshConverter( const int argument_count, const char* const* arguments );
+}
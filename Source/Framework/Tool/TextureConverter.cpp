@@ -0,0 +1,149 @@
+// Framework Includes.
+#include "Renderer/MipmapGenerator.h"
+#include "Renderer/TextureCompression.h"
+#include "Renderer/TextureFile.h"
+
+#include "Tool/TextureConverter.h"
+
+// Vendor Includes.
+#include "Vendor/stb/stb_image.h"
+
+// std Includes.
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+namespace Framework::Tool
+{
+	namespace
+	{
+		std::optional< TextureCompression::Format > ParseFormat( const std::string_view name )
+		{
+			using TextureCompression::Format;
+
+			if( name == "bc1" )		return Format::BC1;
+			if( name == "bc3" )		return Format::BC3;
+			if( name == "bc5" )		return Format::BC5;
+			if( name == "bc7" )		return Format::BC7;
+			if( name == "etc2" )	return Format::ETC2_RGB;
+
+			return std::nullopt;
+		}
+
+		std::optional< MipmapGenerator::Filter > ParseMipFilter( const std::string_view name )
+		{
+			using MipmapGenerator::Filter;
+
+			if( name == "box" )		return Filter::Box;
+			if( name == "kaiser" )	return Filter::Kaiser;
+			if( name == "lanczos" )	return Filter::Lanczos;
+
+			return std::nullopt;
+		}
+	}
+
+	int RunTextureConverter( const int argument_count, const char* const* arguments )
+	{
+		if( argument_count < 4 )
+		{
+			std::cerr << "Usage: " << arguments[ 0 ] << " --convert-texture <input image> <output.ktx> --format <bc1/bc3/bc5/bc7/etc2> [--no-mips] "
+						 "[--mip-filter <box/kaiser/lanczos>] [--srgb] [--alpha-coverage <reference>]\n";
+			return 1;
+		}
+
+		const std::string input_file_path( arguments[ 2 ] ), output_file_path( arguments[ 3 ] );
+
+		std::optional< TextureCompression::Format > format;
+		bool generate_mips = true;
+		MipmapGenerator::Settings mipmap_settings;
+		for( int i = 4; i < argument_count; i++ )
+		{
+			const std::string_view option( arguments[ i ] );
+			if( option == "--format" && i + 1 < argument_count )
+			{
+				format = ParseFormat( arguments[ ++i ] );
+				if( !format )
+				{
+					std::cerr << "ERROR::TEXTURE_CONVERTER::UNKNOWN_FORMAT: " << arguments[ i ] << "\n";
+					return 1;
+				}
+			}
+			else if( option == "--no-mips" )
+				generate_mips = false;
+			else if( option == "--mip-filter" && i + 1 < argument_count )
+			{
+				const auto filter = ParseMipFilter( arguments[ ++i ] );
+				if( !filter )
+				{
+					std::cerr << "ERROR::TEXTURE_CONVERTER::UNKNOWN_MIP_FILTER: " << arguments[ i ] << "\n";
+					return 1;
+				}
+
+				mipmap_settings.filter = *filter;
+			}
+			else if( option == "--srgb" )
+				mipmap_settings.is_srgb = true;
+			else if( option == "--alpha-coverage" && i + 1 < argument_count )
+			{
+				mipmap_settings.preserve_alpha_coverage = true;
+				mipmap_settings.alpha_reference			= std::strtof( arguments[ ++i ], nullptr );
+			}
+			else
+			{
+				std::cerr << "ERROR::TEXTURE_CONVERTER::UNKNOWN_OPTION: " << option << "\n";
+				return 1;
+			}
+		}
+
+		if( !format )
+		{
+			std::cerr << "ERROR::TEXTURE_CONVERTER::NO_FORMAT_GIVEN\n";
+			return 1;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		/* Bottom row first, as Texture uploads images. */
+		stbi_set_flip_vertically_on_load( 1 );
+
+		int width, height, channels_in_file;
+		stbi_uc* pixels = stbi_load( input_file_path.c_str(), &width, &height, &channels_in_file, 4 );
+		if( !pixels )
+		{
+			std::cerr << "ERROR::TEXTURE_CONVERTER::COULD_NOT_READ_FROM_FILE: " << input_file_path << "\n";
+			return 1;
+		}
+
+		const auto mip_level_list = generate_mips
+										? MipmapGenerator::Generate( pixels, width, height, 4, mipmap_settings )
+										: std::vector< MipmapGenerator::Level >{ { width, height, std::vector< unsigned char >( pixels, pixels + std::size_t( width ) * height * 4 ) } };
+		stbi_image_free( pixels );
+
+		std::vector< std::vector< std::byte > > level_list;
+		std::size_t uncompressed_size = 0, compressed_size = 0;
+		for( const auto& mip_level : mip_level_list )
+		{
+			level_list.push_back( TextureCompression::Encode( mip_level.pixels.data(), mip_level.width, mip_level.height, *format ) );
+
+			uncompressed_size += mip_level.pixels.size();
+			compressed_size	  += level_list.back().size();
+		}
+
+		const auto& base_level = mip_level_list.front();
+		const auto decoded	   = TextureCompression::Decode( level_list.front().data(), width, height, *format );
+
+		std::cout << "Compressed " << input_file_path << " (" << width << "x" << height << ", " << level_list.size() << " level(s)) to " << TextureCompression::NameOf( *format )
+				  << ": " << uncompressed_size << " -> " << compressed_size << " bytes, PSNR "
+				  << TextureCompression::PSNR( base_level.pixels.data(), decoded.data(), width, height, *format ) << " dB\n";
+
+		if( !TextureFile::Write( output_file_path, TextureCompression::InternalFormatOf( *format ), width, height, level_list ) )
+			return 1;
+
+		const auto milliseconds = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+		std::cout << "Wrote " << output_file_path << " in " << milliseconds << " ms\n";
+
+		return 0;
+	}
+}
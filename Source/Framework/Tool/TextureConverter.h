@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Framework::Tool
+{
+	/* Command line: --convert-texture <input image> <output.ktx> --format <bc1/bc3/bc5/bc7/etc2> [--no-mips]
+	 *				   [--mip-filter <box/kaiser/lanczos>] [--srgb] [--alpha-coverage <reference>]
+	 *	--format:  See TextureCompression::Format; bc5 stores the red & green channels only (e.g., of a normal map).
+	 *	--no-mips: Stores level 0 only; otherwise the full chain is generated (MipmapGenerator) & compressed.
+	 *	--mip-filter, --srgb & --alpha-coverage: See MipmapGenerator::Settings; the defaults are box, linear & no coverage preservation.
+	 * Prints the PSNR of level 0 & the size compared to uncompressed RGBA8. Returns the process exit code. */
+	int RunTextureConverter( const int argument_count, const char* const* arguments );
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+// std Includes.
+#include <cstdint>
+#include <string_view>
+
+namespace Framework::Utility::Hash
+{
+	/* 32-bit FNV-1a. Usable at compile time; see the _uniform literal for example. */
+	constexpr std::uint32_t FNV1a( const std::string_view string )
+	{
+		std::uint32_t hash = 2166136261u;
+
+		for( const char character : string )
+		{
+			hash ^= std::uint32_t( static_cast< unsigned char >( character ) );
+			hash *= 16777619u;
+		}
+
+		return hash;
+	}
+}
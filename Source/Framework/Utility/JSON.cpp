@@ -0,0 +1,297 @@
+// Framework Includes.
+#include "Utility/JSON.h"
+
+// std Includes.
+#include <charconv>
+
+namespace Framework::Utility::JSON
+{
+	class Parser
+	{
+	public:
+		Parser( const std::string_view text )
+			:
+			text( text ),
+			position( 0 ),
+			error( nullptr )
+		{}
+
+		bool ParseDocument( Value& value )
+		{
+			SkipWhiteSpace();
+			if( !ParseValue( value, 0 ) )
+				return false;
+
+			SkipWhiteSpace();
+			return position == text.size() || Fail( "Unexpected characters after the document" );
+		}
+
+		inline const char* Error() const { return error; }
+		inline std::size_t Position() const { return position; }
+
+	private:
+		static constexpr int MAX_DEPTH = 256;
+
+		bool Fail( const char* message )
+		{
+			if( !error )
+				error = message;
+
+			return false;
+		}
+
+		void SkipWhiteSpace()
+		{
+			while( position < text.size() && ( text[ position ] == ' ' || text[ position ] == '\t' || text[ position ] == '\n' || text[ position ] == '\r' ) )
+				position++;
+		}
+
+		bool Consume( const char character )
+		{
+			SkipWhiteSpace();
+			if( position < text.size() && text[ position ] == character )
+			{
+				position++;
+				return true;
+			}
+
+			return false;
+		}
+
+		bool ConsumeLiteral( const std::string_view literal )
+		{
+			if( text.substr( position, literal.size() ) != literal )
+				return Fail( "Invalid literal" );
+
+			position += literal.size();
+			return true;
+		}
+
+		bool ParseValue( Value& value, const int depth )
+		{
+			if( depth > MAX_DEPTH )
+				return Fail( "Nesting too deep" );
+
+			SkipWhiteSpace();
+			if( position == text.size() )
+				return Fail( "Unexpected end of input" );
+
+			switch( text[ position ] )
+			{
+				case '{': return ParseObject( value, depth );
+				case '[': return ParseArray( value, depth );
+				case '"': value.type = Value::Type::String; return ParseString( value.string );
+				case 't': value.type = Value::Type::Boolean; value.boolean = true;  return ConsumeLiteral( "true" );
+				case 'f': value.type = Value::Type::Boolean; value.boolean = false; return ConsumeLiteral( "false" );
+				case 'n': value.type = Value::Type::Null; return ConsumeLiteral( "null" );
+
+				default:  return ParseNumber( value );
+			}
+		}
+
+		bool ParseObject( Value& value, const int depth )
+		{
+			value.type = Value::Type::Object;
+			position++; // '{'
+
+			if( Consume( '}' ) )
+				return true;
+
+			do
+			{
+				SkipWhiteSpace();
+				if( position == text.size() || text[ position ] != '"' )
+					return Fail( "Expected a member name" );
+
+				std::string& key = value.key_list.emplace_back();
+				if( !ParseString( key ) )
+					return false;
+
+				if( !Consume( ':' ) )
+					return Fail( "Expected ':'" );
+
+				if( !ParseValue( value.element_list.emplace_back(), depth + 1 ) )
+					return false;
+			}
+			while( Consume( ',' ) );
+
+			return Consume( '}' ) || Fail( "Expected ',' or '}'" );
+		}
+
+		bool ParseArray( Value& value, const int depth )
+		{
+			value.type = Value::Type::Array;
+			position++; // '['
+
+			if( Consume( ']' ) )
+				return true;
+
+			do
+			{
+				if( !ParseValue( value.element_list.emplace_back(), depth + 1 ) )
+					return false;
+			}
+			while( Consume( ',' ) );
+
+			return Consume( ']' ) || Fail( "Expected ',' or ']'" );
+		}
+
+		bool ParseHex4( unsigned int& code_unit )
+		{
+			if( text.size() - position < 4 )
+				return Fail( "Truncated \\u escape" );
+
+			const auto [ pointer, result ] = std::from_chars( text.data() + position, text.data() + position + 4, code_unit, 16 );
+			if( result != std::errc() || pointer != text.data() + position + 4 )
+				return Fail( "Invalid \\u escape" );
+
+			position += 4;
+			return true;
+		}
+
+		static void AppendUTF8( std::string& string, const unsigned int code_point )
+		{
+			if( code_point < 0x80 )
+				string += char( code_point );
+			else if( code_point < 0x800 )
+			{
+				string += char( 0xC0 | ( code_point >> 6 ) );
+				string += char( 0x80 | ( code_point & 0x3F ) );
+			}
+			else if( code_point < 0x10000 )
+			{
+				string += char( 0xE0 | ( code_point >> 12 ) );
+				string += char( 0x80 | ( ( code_point >> 6 ) & 0x3F ) );
+				string += char( 0x80 | ( code_point & 0x3F ) );
+			}
+			else
+			{
+				string += char( 0xF0 | ( code_point >> 18 ) );
+				string += char( 0x80 | ( ( code_point >> 12 ) & 0x3F ) );
+				string += char( 0x80 | ( ( code_point >> 6 ) & 0x3F ) );
+				string += char( 0x80 | ( code_point & 0x3F ) );
+			}
+		}
+
+		bool ParseString( std::string& string )
+		{
+			position++; // '"'
+
+			while( true )
+			{
+				/* Copy runs without escapes in one go. */
+				const std::size_t run_begin = position;
+				while( position < text.size() && text[ position ] != '"' && text[ position ] != '\\' && ( unsigned char )text[ position ] >= 0x20 )
+					position++;
+
+				string.append( text.data() + run_begin, position - run_begin );
+
+				if( position == text.size() )
+					return Fail( "Unterminated string" );
+
+				const char character = text[ position++ ];
+				if( character == '"' )
+					return true;
+				if( character != '\\' )
+					return Fail( "Control character in string" );
+
+				if( position == text.size() )
+					return Fail( "Unterminated string" );
+
+				switch( text[ position++ ] )
+				{
+					case '"':	string += '"';	break;
+					case '\\':	string += '\\';	break;
+					case '/':	string += '/';	break;
+					case 'b':	string += '\b';	break;
+					case 'f':	string += '\f';	break;
+					case 'n':	string += '\n';	break;
+					case 'r':	string += '\r';	break;
+					case 't':	string += '\t';	break;
+					case 'u':
+					{
+						unsigned int code_point;
+						if( !ParseHex4( code_point ) )
+							return false;
+
+						/* UTF-16 surrogate pair. */
+						if( code_point >= 0xD800 && code_point <= 0xDBFF )
+						{
+							unsigned int low_surrogate;
+							if( text.substr( position, 2 ) != "\\u" )
+								return Fail( "Unpaired surrogate" );
+
+							position += 2;
+							if( !ParseHex4( low_surrogate ) )
+								return false;
+							if( low_surrogate < 0xDC00 || low_surrogate > 0xDFFF )
+								return Fail( "Unpaired surrogate" );
+
+							code_point = 0x10000 + ( ( code_point - 0xD800 ) << 10 ) + ( low_surrogate - 0xDC00 );
+						}
+						else if( code_point >= 0xDC00 && code_point <= 0xDFFF )
+							return Fail( "Unpaired surrogate" );
+
+						AppendUTF8( string, code_point );
+						break;
+					}
+
+					default:
+						return Fail( "Invalid escape" );
+				}
+			}
+		}
+
+		bool ParseNumber( Value& value )
+		{
+			/* from_chars() also accepts "inf" & "nan"; JSON numbers start with '-' or a digit. */
+			const char first = text[ position ];
+			if( first != '-' && ( first < '0' || first > '9' ) )
+				return Fail( "Unexpected character" );
+
+			const auto [ pointer, result ] = std::from_chars( text.data() + position, text.data() + text.size(), value.number );
+			if( result != std::errc() )
+				return Fail( "Invalid number" );
+
+			value.type = Value::Type::Number;
+			position = pointer - text.data();
+			return true;
+		}
+
+	private:
+		std::string_view text;
+		std::size_t position;
+		const char* error;
+	};
+
+	const Value& Value::operator[]( const std::size_t index ) const
+	{
+		static const Value null_value;
+		return index < element_list.size() ? element_list[ index ] : null_value;
+	}
+
+	const Value* Value::Find( const std::string_view key ) const
+	{
+		for( std::size_t i = 0; i < key_list.size(); i++ )
+			if( key_list[ i ] == key )
+				return &element_list[ i ];
+
+		return nullptr;
+	}
+
+	std::optional< Value > Parse( const std::string_view text, std::string* error_message )
+	{
+		Parser parser( text );
+		Value document;
+
+		if( !parser.ParseDocument( document ) )
+		{
+			if( error_message )
+				*error_message = std::string( parser.Error() ? parser.Error() : "Malformed document" ) + " at byte " + std::to_string( parser.Position() );
+
+			return std::nullopt;
+		}
+
+		return document;
+	}
+}
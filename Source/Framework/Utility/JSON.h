@@ -0,0 +1,58 @@
+#pragma once
+
+// std Includes.
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Framework::Utility::JSON
+{
+	/* A parsed JSON document (RFC 8259); read-only. Accessors of the wrong type return a neutral value (0, false, "", no elements) instead of failing,
+	 * so that optional properties can be read without checking the type first. Objects keep their members in document order; lookups are linear,
+	 * which is fine for the small objects of typical file formats (glTF etc.). */
+	class Value
+	{
+		friend class Parser;
+
+	public:
+		enum class Type
+		{
+			Null, Boolean, Number, String, Array, Object
+		};
+
+	public:
+		Value() : type( Type::Null ), number( 0.0 ), boolean( false ) {}
+
+		inline Type GetType() const { return type; }
+		inline bool IsNull() const		{ return type == Type::Null; }
+		inline bool IsNumber() const	{ return type == Type::Number; }
+		inline bool IsString() const	{ return type == Type::String; }
+		inline bool IsArray() const		{ return type == Type::Array; }
+		inline bool IsObject() const	{ return type == Type::Object; }
+
+		inline double AsNumber( const double fallback = 0.0 ) const		{ return type == Type::Number ? number : fallback; }
+		inline bool AsBoolean( const bool fallback = false ) const		{ return type == Type::Boolean ? boolean : fallback; }
+		/* Empty if not a string. */
+		inline const std::string& AsString() const { return string; }
+
+		/* Element count of arrays, member count of objects; 0 otherwise. */
+		inline std::size_t Size() const { return element_list.size(); }
+		/* Array elements (or object member values, in document order). Returns a null Value if out of range. */
+		const Value& operator[]( const std::size_t index ) const;
+		/* Object members; nullptr if not an object or there is no member with the given key. */
+		const Value* Find( const std::string_view key ) const;
+
+	private:
+		Type type;
+		double number;
+		bool boolean;
+		std::string string;
+		std::vector< Value > element_list;
+		std::vector< std::string > key_list; // Objects only; parallel to element_list.
+	};
+
+	/* Returns std::nullopt on malformed input; error_message (if given) receives the reason & the byte offset. Nesting is limited to 256 levels. */
+	std::optional< Value > Parse( const std::string_view text, std::string* error_message = nullptr );
+}
@@ -0,0 +1,116 @@
+// Framework Includes.
+#include "Utility/MemoryMappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Framework::Utility
+{
+#ifdef _WIN32
+	MemoryMappedFile::MemoryMappedFile( const std::string& file_path )
+		:
+		data( nullptr ),
+		size( 0 ),
+		file_handle( INVALID_HANDLE_VALUE ),
+		mapping_handle( nullptr )
+	{
+		file_handle = CreateFileA( file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+		if( file_handle == INVALID_HANDLE_VALUE )
+			return;
+
+		LARGE_INTEGER file_size;
+		if( !GetFileSizeEx( file_handle, &file_size ) || file_size.QuadPart == 0 )
+		{
+			Close();
+			return;
+		}
+
+		mapping_handle = CreateFileMappingA( file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+		if( !mapping_handle )
+		{
+			Close();
+			return;
+		}
+
+		data = static_cast< const std::byte* >( MapViewOfFile( mapping_handle, FILE_MAP_READ, 0, 0, 0 ) );
+		if( !data )
+		{
+			Close();
+			return;
+		}
+
+		size = ( std::size_t )file_size.QuadPart;
+	}
+
+	void MemoryMappedFile::Close()
+	{
+		if( data )
+			UnmapViewOfFile( data );
+		if( mapping_handle )
+			CloseHandle( mapping_handle );
+		if( file_handle != INVALID_HANDLE_VALUE )
+			CloseHandle( file_handle );
+
+		data		   = nullptr;
+		size		   = 0;
+		mapping_handle = nullptr;
+		file_handle	   = INVALID_HANDLE_VALUE;
+	}
+#else
+	MemoryMappedFile::MemoryMappedFile( const std::string& file_path )
+		:
+		data( nullptr ),
+		size( 0 ),
+		file_descriptor( -1 )
+	{
+		file_descriptor = open( file_path.c_str(), O_RDONLY );
+		if( file_descriptor < 0 )
+			return;
+
+		struct stat file_status;
+		if( fstat( file_descriptor, &file_status ) != 0 || file_status.st_size == 0 )
+		{
+			Close();
+			return;
+		}
+
+		void* mapping = mmap( nullptr, ( std::size_t )file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0 );
+		if( mapping == MAP_FAILED )
+		{
+			Close();
+			return;
+		}
+
+		/* The whole file is going to be read front to back (by the GL upload), so read-ahead pays off. */
+		madvise( mapping, ( std::size_t )file_status.st_size, MADV_SEQUENTIAL );
+
+		data = static_cast< const std::byte* >( mapping );
+		size = ( std::size_t )file_status.st_size;
+	}
+
+	void MemoryMappedFile::Close()
+	{
+		if( data )
+			munmap( const_cast< std::byte* >( data ), size );
+		if( file_descriptor >= 0 )
+			close( file_descriptor );
+
+		data			= nullptr;
+		size			= 0;
+		file_descriptor = -1;
+	}
+#endif
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Close();
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// std Includes.
+#include <cstddef>
+#include <string>
+
+namespace Framework::Utility
+{
+	/* Read-only view of a whole file, mapped into the address space. Pages are read from disk (or the OS file cache) on first access; nothing is copied up front. */
+	class MemoryMappedFile
+	{
+	public:
+		/* Check IsOpen() afterwards; an empty file can not be mapped & is reported as not open too. */
+		explicit MemoryMappedFile( const std::string& file_path );
+		~MemoryMappedFile();
+
+		MemoryMappedFile( const MemoryMappedFile& )				= delete;
+		MemoryMappedFile& operator= ( const MemoryMappedFile& )	= delete;
+
+		inline bool IsOpen() const { return data != nullptr; }
+
+		inline const std::byte* Data() const { return data; }
+		inline std::size_t Size() const { return size; }
+
+	private:
+		void Close();
+
+	private:
+		const std::byte* data;
+		std::size_t size;
+
+#ifdef _WIN32
+		void* file_handle;
+		void* mapping_handle;
+#else
+		int file_descriptor;
+#endif
+	};
+}
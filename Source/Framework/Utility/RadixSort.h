@@ -0,0 +1,60 @@
+#pragma once
+
+// std Includes.
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Framework::Utility
+{
+	/* Stable LSD radix sort on 64-bit keys, one byte per pass. Passes in which all keys share the same byte value are skipped,
+	 * so keys that only use their lower bits (or share their upper bits) cost fewer passes.
+	 * scratch is resized as needed & can be kept across calls to avoid reallocations. KeyGetter: std::uint64_t( const Type& ). */
+	template< typename Type, typename KeyGetter >
+	void RadixSort( std::vector< Type >& items, std::vector< Type >& scratch, KeyGetter&& get_key )
+	{
+		constexpr std::size_t PASS_COUNT   = sizeof( std::uint64_t );
+		constexpr std::size_t BUCKET_COUNT = 256;
+
+		const std::size_t count = items.size();
+		if( count < 2 )
+			return;
+
+		/* Build all histograms in a single read pass. */
+		std::array< std::array< std::size_t, BUCKET_COUNT >, PASS_COUNT > histograms{};
+		for( const auto& item : items )
+		{
+			const std::uint64_t key = get_key( item );
+			for( std::size_t pass = 0; pass < PASS_COUNT; pass++ )
+				histograms[ pass ][ ( key >> ( pass * 8 ) ) & 0xFF ]++;
+		}
+
+		scratch.resize( count );
+
+		std::vector< Type >* source      = &items;
+		std::vector< Type >* destination = &scratch;
+
+		for( std::size_t pass = 0; pass < PASS_COUNT; pass++ )
+		{
+			auto& histogram = histograms[ pass ];
+
+			/* Skip the pass if every key falls into the same bucket. */
+			if( histogram[ ( get_key( ( *source )[ 0 ] ) >> ( pass * 8 ) ) & 0xFF ] == count )
+				continue;
+
+			/* Exclusive prefix sum -> first output index of each bucket. */
+			std::size_t offset = 0;
+			for( auto& bucket : histogram )
+				offset += std::exchange( bucket, offset );
+
+			for( auto& item : *source )
+				( *destination )[ histogram[ ( get_key( item ) >> ( pass * 8 ) ) & 0xFF ]++ ] = std::move( item );
+
+			std::swap( source, destination );
+		}
+
+		if( source != &items )
+			items.swap( scratch );
+	}
+}
@@ -0,0 +1,119 @@
+// Framework Includes.
+#include "Utility/ThreadPool.h"
+
+// std Includes.
+#include <algorithm>
+#include <atomic>
+
+namespace Framework::Utility
+{
+	ThreadPool::ThreadPool( const unsigned int thread_count )
+		:
+		is_stopping( false )
+	{
+		worker_list.reserve( thread_count );
+		for( unsigned int i = 0; i < thread_count; i++ )
+			worker_list.emplace_back( &ThreadPool::WorkerLoop, this );
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock( mutex );
+			is_stopping = true;
+		}
+
+		condition.notify_all();
+
+		for( auto& worker : worker_list )
+			worker.join();
+	}
+
+	ThreadPool& ThreadPool::Default()
+	{
+		static ThreadPool thread_pool;
+		return thread_pool;
+	}
+
+	unsigned int ThreadPool::DefaultThreadCount()
+	{
+		const unsigned int hardware_thread_count = std::thread::hardware_concurrency();
+		return hardware_thread_count > 1 ? hardware_thread_count - 1 : 1;
+	}
+
+	void ThreadPool::ParallelFor( const std::size_t count, const std::size_t min_batch_size, const std::function< void( std::size_t begin, std::size_t end ) >& function )
+	{
+		if( count == 0 )
+			return;
+
+		const std::size_t batch_count = std::clamp< std::size_t >( count / std::max< std::size_t >( min_batch_size, 1 ), 1, ThreadCount() + 1 );
+
+		if( batch_count == 1 )
+		{
+			function( 0, count );
+			return;
+		}
+
+		/* Batches are claimed through an atomic counter, so helper tasks that start late simply find nothing left to do.
+		 * The state is shared with the helpers since they may outlive this call. */
+		struct SharedState
+		{
+			std::atomic< std::size_t > next_batch = 0;
+			std::atomic< std::size_t > completed_batch_count = 0;
+		};
+
+		auto state = std::make_shared< SharedState >();
+
+		const std::size_t batch_size = ( count + batch_count - 1 ) / batch_count;
+
+		auto process_batches = [ state, batch_count, batch_size, count, &function ]()
+		{
+			for( std::size_t batch = state->next_batch++; batch < batch_count; batch = state->next_batch++ )
+			{
+				const std::size_t begin = batch * batch_size;
+				const std::size_t end   = std::min( begin + batch_size, count );
+
+				if( begin < end )
+					function( begin, end );
+
+				if( ++state->completed_batch_count == batch_count )
+					state->completed_batch_count.notify_all();
+			}
+		};
+
+		{
+			std::lock_guard lock( mutex );
+			for( std::size_t i = 0; i < batch_count - 1; i++ )
+				task_queue.emplace( process_batches );
+		}
+
+		condition.notify_all();
+
+		process_batches();
+
+		/* Only batches already claimed by workers can be pending here, & they are being processed, so waiting can not dead-lock. */
+		for( std::size_t completed = state->completed_batch_count; completed != batch_count; completed = state->completed_batch_count )
+			state->completed_batch_count.wait( completed );
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		while( true )
+		{
+			std::function< void() > task;
+
+			{
+				std::unique_lock lock( mutex );
+				condition.wait( lock, [ this ]() { return is_stopping || !task_queue.empty(); } );
+
+				if( is_stopping && task_queue.empty() )
+					return;
+
+				task = std::move( task_queue.front() );
+				task_queue.pop();
+			}
+
+			task();
+		}
+	}
+}
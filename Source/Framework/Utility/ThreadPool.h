@@ -0,0 +1,67 @@
+#pragma once
+
+// std Includes.
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Framework::Utility
+{
+	class ThreadPool
+	{
+	public:
+		/* Defaults to one worker less than the hardware thread count, as the calling thread also takes part in ParallelFor(). */
+		explicit ThreadPool( const unsigned int thread_count = DefaultThreadCount() );
+		~ThreadPool();
+
+		ThreadPool( const ThreadPool& )				= delete;
+		ThreadPool& operator= ( const ThreadPool& )	= delete;
+
+		/* Shared pool for framework-wide use. Created on first use. */
+		static ThreadPool& Default();
+
+		static unsigned int DefaultThreadCount();
+
+		inline unsigned int ThreadCount() const { return ( unsigned int )worker_list.size(); }
+
+		template< typename Function >
+		std::future< std::invoke_result_t< Function > > Enqueue( Function&& function )
+		{
+			using ReturnType = std::invoke_result_t< Function >;
+
+			auto task   = std::make_shared< std::packaged_task< ReturnType() > >( std::forward< Function >( function ) );
+			auto future = task->get_future();
+
+			{
+				std::lock_guard lock( mutex );
+				task_queue.emplace( [ task ]() { ( *task )(); } );
+			}
+
+			condition.notify_one();
+
+			return future;
+		}
+
+		/* Splits [0, count) into batches of at least min_batch_size elements & calls function( begin, end ) for each batch.
+		 * The calling thread processes batches too & the call blocks until all batches are done, so it is safe to call from inside a worker. */
+		void ParallelFor( const std::size_t count, const std::size_t min_batch_size, const std::function< void( std::size_t begin, std::size_t end ) >& function );
+
+	private:
+		void WorkerLoop();
+
+	private:
+		std::vector< std::thread > worker_list;
+		std::queue< std::function< void() > > task_queue;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		bool is_stopping;
+	};
+}